@@ -0,0 +1,396 @@
+// Verificaciones de MathBatch y Random: cada kernel SIMD frente al escalar, prueba
+// aleatoria de las pruebas geométricas en bloque y estadísticas de los llenados.
+#include "Benchmark.h"
+#include "MathBatch.h"
+#include "Random.h"
+#include <algorithm>
+#include <cstdio>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace {
+  // Distancia bajo la cual el resultado de una prueba geométrica depende del redondeo.
+  constexpr float kGeometryEpsilon = 1.0e-3f;
+
+  // Diferencia relativa permitida entre un kernel SIMD y el escalar (unos 16 ULP del mayor valor).
+  constexpr float kKernelTolerance = 1.0e-6f;
+
+  // Conjuntos de instrucciones que el procesador puede ejecutar, del más simple al mejor.
+  std::vector<MathBatch::InstructionSet>
+  getInstructionSets() {
+    std::vector<MathBatch::InstructionSet> sets = { MathBatch::InstructionSet::Scalar };
+    const MathBatch::InstructionSet supported = MathBatch::getSupportedInstructionSet();
+    for (MathBatch::InstructionSet set : { MathBatch::InstructionSet::SSE2, MathBatch::InstructionSet::AVX2 }) {
+      if (static_cast<int>(set) <= static_cast<int>(supported)) {
+        sets.push_back(set);
+      }
+    }
+    return sets;
+  }
+
+  // Restaura el conjunto de instrucciones detectado al salir de la verificación.
+  struct
+  InstructionSetGuard {
+    ~InstructionSetGuard() { MathBatch::setInstructionSet(MathBatch::getSupportedInstructionSet()); }
+  };
+
+  /**
+   * Indica si el rayo pasa tan cerca de una frontera de Ray::intersect (tangente, origen
+   * sobre el círculo o centro justo al costado) que el redondeo puede cambiar el resultado.
+   */
+  bool
+  isAmbiguousRay(const Ray& ray, const Circle& circle) {
+    const double mx = static_cast<double>(circle.center.x) - ray.origin.x;
+    const double my = static_cast<double>(circle.center.y) - ray.origin.y;
+    const double b = mx * ray.direction.x + my * ray.direction.y;
+    const double mm = mx * mx + my * my;
+    const double rr = static_cast<double>(circle.radius) * circle.radius;
+    const double scale = mm + rr;
+    return std::fabs(b * b - (mm - rr)) <= kGeometryEpsilon * 1.0e-2 * scale ||
+           std::fabs(mm - rr) <= kGeometryEpsilon * 1.0e-2 * scale ||
+           std::fabs(b) <= kGeometryEpsilon * std::sqrt(scale);
+  }
+
+  // Indica si el punto está a menos de kGeometryEpsilon de alguna arista del polígono.
+  bool
+  isNearPolygonEdge(const std::vector<Vector2>& polygon, const Vector2& point) {
+    for (size_t i = 0, j = polygon.size() - 1; i < polygon.size(); j = i++) {
+      if (Segment(polygon[j], polygon[i]).distanceSquared(point) <= kGeometryEpsilon * kGeometryEpsilon) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * Mayor diferencia entre dos arreglos relativa al mayor valor absoluto de la referencia:
+   * los kernels combinan términos del tamaño de las entradas aunque el resultado sea pequeño.
+   */
+  float
+  maxRelativeDifference(const std::vector<float>& values, const std::vector<float>& reference) {
+    float scale = 1.0f;
+    for (float value : reference) {
+      scale = std::max(scale, std::fabs(value));
+    }
+    float maxDifference = 0.0f;
+    for (size_t i = 0; i < values.size(); ++i) {
+      const float difference = std::fabs(values[i] - reference[i]) / scale;
+      maxDifference = std::max(maxDifference, difference != difference ? 1.0f : difference);
+    }
+    return maxDifference;
+  }
+}
+
+// ---------------------------------------------------------------------------
+// Kernels de MathBatch: cada conjunto de instrucciones frente al escalar.
+// ---------------------------------------------------------------------------
+
+ALDAIR_CHECK(MathBatch, kernelsMatchScalar) {
+  constexpr float kDeltaTime = 1.0f / 60.0f;
+  InstructionSetGuard guard;
+  // Un tamaño que no es múltiplo de 8 cubre los restos de los kernels SIMD.
+  constexpr size_t kCount = 10007;
+  Random random(9);
+  std::vector<float> x(kCount), y(kCount), targetX(kCount), targetY(kCount), speeds(kCount), angles(kCount);
+  random.fillRange(x.data(), kCount, -1000.0f, 1000.0f);
+  random.fillRange(y.data(), kCount, -1000.0f, 1000.0f);
+  random.fillRange(targetX.data(), kCount, -1000.0f, 1000.0f);
+  random.fillRange(targetY.data(), kCount, -1000.0f, 1000.0f);
+  random.fillRange(speeds.data(), kCount, 50.0f, 250.0f);
+  random.fillRange(angles.data(), kCount, -MathEngine::PI, MathEngine::PI);
+  // Algunos vectores nulos y agentes ya en el objetivo.
+  for (size_t i = 0; i < kCount; i += 97) {
+    x[i] = targetX[i];
+    y[i] = targetY[i];
+  }
+
+  // Corre kernel sobre una copia de x, y con cada conjunto y compara con el escalar.
+  auto compare = [&](const char* name, auto kernel) {
+    std::vector<float> scalarX, scalarY, scalarOut;
+    for (MathBatch::InstructionSet set : getInstructionSets()) {
+      MathBatch::setInstructionSet(set);
+      std::vector<float> px = x, py = y, out(kCount);
+      kernel(MathBatch::Vector2Span{ px.data(), py.data(), kCount }, out.data());
+      if (set == MathBatch::InstructionSet::Scalar) {
+        scalarX = px;
+        scalarY = py;
+        scalarOut = out;
+        continue;
+      }
+      const float difference = std::max({ maxRelativeDifference(px, scalarX), maxRelativeDifference(py, scalarY),
+                                          maxRelativeDifference(out, scalarOut) });
+      check.expect(difference <= kKernelTolerance, "%s con %s: diferencia relativa %.3g", name,
+                   MathBatch::getInstructionSetName(set), difference);
+    }
+  };
+
+  const MathBatch::ConstVector2Span targets(targetX.data(), targetY.data(), kCount);
+  compare("seekBatch", [&](MathBatch::Vector2Span p, float*) {
+    MathBatch::seekBatch(p, targets, speeds.data(), kDeltaTime, 1.0f);
+  });
+  compare("translateBatch", [&](MathBatch::Vector2Span p, float*) {
+    MathBatch::translateBatch(p, targets, kDeltaTime);
+  });
+  compare("rotateScaleBatch", [&](MathBatch::Vector2Span p, float*) {
+    MathBatch::rotateScaleBatch(p, angles.data(), 1.5f, 0.5f);
+  });
+  compare("lengthBatch", [&](MathBatch::Vector2Span p, float* out) {
+    MathBatch::lengthBatch(p, out);
+  });
+  compare("normalizeBatch", [&](MathBatch::Vector2Span p, float*) {
+    MathBatch::normalizeBatch(p);
+  });
+}
+
+/**
+ * @brief integrateBatch promete el mismo resultado con cualquier conjunto de instrucciones:
+ * posiciones, velocidades y temporizadores deben coincidir bit a bit con el escalar tras
+ * varios pasos, también cuando el bloque no empieza alineado (como en ParticleEmitter).
+ */
+ALDAIR_CHECK(MathBatch, integrateMatchesScalar) {
+  constexpr float kDeltaTime = 1.0f / 60.0f;
+  constexpr size_t kCount = 10007;
+  constexpr size_t kOffset = 3;
+  constexpr int kSteps = 8;
+  InstructionSetGuard guard;
+  Random random(11);
+  std::vector<float> x(kCount), y(kCount), vx(kCount), vy(kCount), timers(kCount);
+  random.fillRange(x.data(), kCount, -1000.0f, 1000.0f);
+  random.fillRange(y.data(), kCount, -1000.0f, 1000.0f);
+  random.fillRange(vx.data(), kCount, -250.0f, 250.0f);
+  random.fillRange(vy.data(), kCount, -250.0f, 250.0f);
+  random.fillRange(timers.data(), kCount, 1.0f, 2.5f);
+
+  std::vector<std::vector<float>> reference;
+  for (MathBatch::InstructionSet set : getInstructionSets()) {
+    MathBatch::setInstructionSet(set);
+    std::vector<std::vector<float>> streams = { x, y, vx, vy, timers };
+    const size_t count = kCount - kOffset;
+    for (int step = 0; step < kSteps; ++step) {
+      MathBatch::integrateBatch({ streams[0].data() + kOffset, streams[1].data() + kOffset, count },
+                                { streams[2].data() + kOffset, streams[3].data() + kOffset, count },
+                                Vector2(0.0f, 98.0f), kDeltaTime, streams[4].data() + kOffset);
+    }
+    if (set == MathBatch::InstructionSet::Scalar) {
+      reference = streams;
+      continue;
+    }
+    size_t mismatches = 0;
+    for (size_t s = 0; s < streams.size(); ++s) {
+      for (size_t i = 0; i < kCount; ++i) {
+        mismatches += streams[s][i] != reference[s][i] ? 1 : 0;
+      }
+    }
+    check.expect(mismatches == 0, "integrateBatch con %s: %zu valores distintos del escalar",
+                 MathBatch::getInstructionSetName(set), mismatches);
+  }
+}
+
+/**
+ * @brief Seno y coseno por elemento de rotateScaleBatch frente a std en double: rota (1, 0)
+ * con ángulos uniformes en [-kBatchAngleRange, kBatchAngleRange] y con los floats más
+ * cercanos a cada múltiplo de pi/2, donde la reducción en float pierde más bits.
+ */
+ALDAIR_CHECK(MathBatch, rotateScaleAngles) {
+  constexpr size_t kUniform = 1 << 20;
+  constexpr int kNeighbors = 2048;
+  InstructionSetGuard guard;
+
+  std::vector<float> angles(kUniform);
+  Random random(21);
+  random.fillRange(angles.data(), kUniform, -MathBatch::kBatchAngleRange, MathBatch::kBatchAngleRange);
+  const int maxMultiple = static_cast<int>(MathBatch::kBatchAngleRange / MathEngine::HALF_PI);
+  for (int k = -maxMultiple; k <= maxMultiple; ++k) {
+    float angle = static_cast<float>(k * 1.5707963267948966);
+    for (int i = 0; i < kNeighbors; ++i) {
+      angle = std::nextafter(angle, -std::numeric_limits<float>::infinity());
+    }
+    for (int i = 0; i < 2 * kNeighbors; ++i) {
+      angles.push_back(angle);
+      angle = std::nextafter(angle, std::numeric_limits<float>::infinity());
+    }
+  }
+
+  const size_t count = angles.size();
+  for (MathBatch::InstructionSet set : getInstructionSets()) {
+    MathBatch::setInstructionSet(set);
+    std::vector<float> x(count, 1.0f), y(count, 0.0f);
+    MathBatch::rotateScaleBatch(MathBatch::Vector2Span{ x.data(), y.data(), count }, angles.data(), 1.0f, 1.0f);
+    double maxError = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+      const double angle = angles[i];
+      maxError = std::max({ maxError, std::fabs(x[i] - std::cos(angle)), std::fabs(y[i] - std::sin(angle)) });
+    }
+    char what[64];
+    std::snprintf(what, sizeof(what), "error absoluto con %s", MathBatch::getInstructionSetName(set));
+    check.expectAtMost(what, maxError, MathBatch::kBatchSinCosError);
+  }
+}
+
+/**
+ * @brief Prueba aleatoria de overlapAABBBatch, raycastCirclesBatch y pointsInPolygonBatch.
+ * En cada ronda genera cajas, círculos, puntos y un polígono cóncavo nuevos, ejecuta los
+ * kernels con cada conjunto de instrucciones y compara cada resultado con las versiones
+ * escalares de Geometry.h. No cuenta los casos que dependen del redondeo (rayos tangentes
+ * y puntos a menos de kGeometryEpsilon de una arista).
+ */
+ALDAIR_CHECK(MathBatch, geometryFuzz) {
+  constexpr size_t kCount = 100000;
+  constexpr size_t kRounds = 16;
+  constexpr float kWorld = 1000.0f;
+  InstructionSetGuard guard;
+  const std::vector<MathBatch::InstructionSet> sets = getInstructionSets();
+  size_t overlapMismatches = 0, raycastMismatches = 0, polygonMismatches = 0;
+
+  Random random(17);
+  std::vector<float> minX, minY, maxX, maxY, radius, distances;
+  std::vector<uint8_t> flags;
+  std::vector<Vector2> polygon;
+  for (size_t round = 0; round < kRounds; ++round) {
+    // Un elemento más en cada ronda para cubrir todos los restos de los kernels SIMD.
+    const size_t n = kCount + round;
+    minX.resize(n);
+    minY.resize(n);
+    maxX.resize(n);
+    maxY.resize(n);
+    radius.resize(n);
+    distances.resize(n);
+    flags.resize(n);
+    random.fillRange(minX.data(), n, -kWorld, kWorld);
+    random.fillRange(minY.data(), n, -kWorld, kWorld);
+    random.fillRange(maxX.data(), n, 0.0f, 50.0f);
+    random.fillRange(maxY.data(), n, 0.0f, 50.0f);
+    random.fillRange(radius.data(), n, 1.0f, 40.0f);
+    for (size_t i = 0; i < n; ++i) {
+      maxX[i] += minX[i];
+      maxY[i] += minY[i];
+    }
+
+    // Una caja contra todas.
+    const AABB box = AABB::fromCenter(Vector2(random.range(-kWorld, kWorld), random.range(-kWorld, kWorld)),
+                                      Vector2(random.range(10.0f, 200.0f), random.range(10.0f, 200.0f)));
+    const MathBatch::ConstAABBSpan boxes = { minX.data(), minY.data(), maxX.data(), maxY.data(), n };
+    for (MathBatch::InstructionSet set : sets) {
+      MathBatch::setInstructionSet(set);
+      const size_t hitCount = MathBatch::overlapAABBBatch(box, boxes, flags.data());
+      size_t expected = 0;
+      for (size_t i = 0; i < n; ++i) {
+        const bool hit = box.overlaps(AABB(Vector2(minX[i], minY[i]), Vector2(maxX[i], maxY[i])));
+        expected += hit ? 1 : 0;
+        overlapMismatches += (flags[i] != 0) != hit ? 1 : 0;
+      }
+      overlapMismatches += hitCount != expected ? 1 : 0;
+    }
+
+    // Un rayo contra los círculos con centro en las esquinas mínimas de las cajas.
+    const Ray ray(Vector2(random.range(-kWorld, kWorld), random.range(-kWorld, kWorld)), random.unitVector());
+    const MathBatch::ConstCircleSpan circles = { minX.data(), minY.data(), radius.data(), n };
+    for (MathBatch::InstructionSet set : sets) {
+      MathBatch::setInstructionSet(set);
+      const size_t nearest = MathBatch::raycastCirclesBatch(ray, circles, distances.data());
+      size_t expectedNearest = MathBatch::kNoHit;
+      float nearestDistance = std::numeric_limits<float>::infinity();
+      for (size_t i = 0; i < n; ++i) {
+        const Circle circle(Vector2(minX[i], minY[i]), radius[i]);
+        float t = 0.0f;
+        const bool hit = ray.intersect(circle, t);
+        if (hit && t < nearestDistance) {
+          nearestDistance = t;
+          expectedNearest = i;
+        }
+        if (isAmbiguousRay(ray, circle)) {
+          continue;
+        }
+        const bool batchHit = distances[i] != std::numeric_limits<float>::infinity();
+        if (batchHit != hit || (hit && std::fabs(distances[i] - t) > kGeometryEpsilon * (1.0f + t))) {
+          ++raycastMismatches;
+        }
+      }
+      // Otro círculo a la misma distancia también es válido.
+      if (nearest != expectedNearest &&
+          (nearest == MathBatch::kNoHit || expectedNearest == MathBatch::kNoHit ||
+           std::fabs(distances[nearest] - nearestDistance) > kGeometryEpsilon * (1.0f + nearestDistance))) {
+        ++raycastMismatches;
+      }
+    }
+
+    // Estrella cóncava de 3 a 32 vértices contra los centros de las cajas.
+    const size_t vertexCount = 3 + random.nextInt(30);
+    const Vector2 center(random.range(-kWorld, kWorld) * 0.5f, random.range(-kWorld, kWorld) * 0.5f);
+    polygon.resize(vertexCount);
+    for (size_t v = 0; v < vertexCount; ++v) {
+      const float angle = MathEngine::TWO_PI * static_cast<float>(v) / static_cast<float>(vertexCount);
+      polygon[v] = center + Vector2(MathEngine::cos(angle), MathEngine::sin(angle)) * random.range(100.0f, kWorld);
+    }
+    for (size_t i = 0; i < n; ++i) {
+      minX[i] = (minX[i] + maxX[i]) * 0.5f;
+      minY[i] = (minY[i] + maxY[i]) * 0.5f;
+    }
+    const MathBatch::ConstVector2Span points(minX.data(), minY.data(), n);
+    for (MathBatch::InstructionSet set : sets) {
+      MathBatch::setInstructionSet(set);
+      const size_t insideCount = MathBatch::pointsInPolygonBatch(polygon.data(), vertexCount, points, flags.data());
+      size_t ambiguous = 0, expected = 0;
+      for (size_t i = 0; i < n; ++i) {
+        const Vector2 point(minX[i], minY[i]);
+        const bool inside = Geometry::containsPoint(polygon.data(), vertexCount, point);
+        expected += inside ? 1 : 0;
+        if ((flags[i] != 0) != inside) {
+          ++(isNearPolygonEdge(polygon, point) ? ambiguous : polygonMismatches);
+        }
+      }
+      // El conteo solo se compara si no hubo puntos ambiguos.
+      polygonMismatches += ambiguous == 0 && insideCount != expected ? 1 : 0;
+    }
+  }
+
+  check.note("%zu elementos x %zu rondas con %zu conjuntos de instrucciones", kCount, kRounds, sets.size());
+  check.expect(overlapMismatches == 0, "overlapAABBBatch: %zu discrepancias", overlapMismatches);
+  check.expect(raycastMismatches == 0, "raycastCirclesBatch: %zu discrepancias", raycastMismatches);
+  check.expect(polygonMismatches == 0, "pointsInPolygonBatch: %zu discrepancias", polygonMismatches);
+}
+
+// ---------------------------------------------------------------------------
+// Random: intervalos y estadísticas de los llenados en bloque.
+// ---------------------------------------------------------------------------
+
+ALDAIR_CHECK(Random, fills) {
+  constexpr size_t kCount = 10000000;
+  Random random(3);
+  std::vector<float> x(kCount), y(kCount);
+
+  random.fillUniform(x.data(), kCount);
+  double sum = 0.0;
+  size_t outside = 0;
+  for (float value : x) {
+    sum += value;
+    outside += value >= 0.0f && value < 1.0f ? 0 : 1;
+  }
+  check.expect(outside == 0, "fillUniform: %zu valores fuera de [0, 1)", outside);
+  // Desviación estándar de la media: 1 / sqrt(12 n), unas 9e-5 con 10M números.
+  check.expectAtMost("|media de fillUniform - 0.5|", std::fabs(sum / kCount - 0.5), 5.0e-4);
+
+  random.fillRange(x.data(), kCount, -10.0f, 10.0f);
+  outside = 0;
+  for (float value : x) {
+    outside += value >= -10.0f && value <= 10.0f ? 0 : 1;
+  }
+  check.expect(outside == 0, "fillRange: %zu valores fuera de [-10, 10]", outside);
+
+  random.fillUnitVectors({ x.data(), y.data(), kCount });
+  double lengthError = 0.0;
+  for (size_t i = 0; i < kCount; ++i) {
+    lengthError = std::max(lengthError, std::fabs(std::sqrt(static_cast<double>(x[i]) * x[i] +
+                                                            static_cast<double>(y[i]) * y[i]) - 1.0));
+  }
+  check.expectAtMost("fillUnitVectors: | |v| - 1 |", lengthError, 1.0e-5);
+
+  // La misma semilla da la misma secuencia.
+  Random a(42), b(42);
+  bool same = true;
+  for (int i = 0; i < 1000; ++i) {
+    same = same && a.nextU64() == b.nextU64();
+  }
+  check.expect(same, "dos generadores con la misma semilla dieron secuencias distintas");
+}
@@ -0,0 +1,498 @@
+// Ejecutor de los microbenchmarks (objetivo Aldair3dBench).
+//
+// En Windows se compila con Aldair3dBench.vcxproj. En Linux se usa el CMakeLists.txt de
+// la carpeta del proyecto, que no necesita las bibliotecas de SFML:
+//
+//   cmake -S . -B build && cmake --build build && ctest --test-dir build
+//
+// Ambos fijan -ffp-contract=off (/fp:precise): MathEngine da los mismos bits en tiempo de
+// compilación y de ejecución solo sin contracción a FMA (lo comprueba
+// MathEngine/constexprMatchesRuntime). ResourceBenchmarks.cpp y ResourceChecks.cpp crean
+// texturas, así que solo se compilan con el vcxproj, que enlaza SFML.
+//
+// Opciones:
+//   --list                Lista los casos.
+//   --filter <texto>      Solo los casos cuyo "suite/nombre" contiene texto.
+//   --min-time <ms>       Duración de cada repetición (100 ms por defecto).
+//   --repetitions <n>     Repeticiones por caso (5 por defecto); se reporta la mediana.
+//   --counters            Lee contadores de hardware con perf_event_open (Linux).
+//   --label <texto>       Etiqueta del JSON, por ejemplo el commit.
+//   --json <archivo>      Escribe los resultados en JSON.
+//   --compare <archivo>   Compara contra un JSON anterior (tiempo nuevo / tiempo anterior).
+//   --check               Corre las verificaciones en lugar de medir; código 1 si alguna falla.
+#include "Benchmark.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace Bench {
+  namespace {
+    // Fallas que se imprimen por verificación; las demás solo se cuentan.
+    constexpr size_t kMaxPrinted = 10;
+  }
+
+  bool
+  Checker::expect(bool condition, const char* format, ...) {
+    if (condition) {
+      return true;
+    }
+    ++m_failures;
+    if (m_printed < kMaxPrinted) {
+      ++m_printed;
+      va_list arguments;
+      va_start(arguments, format);
+      print("  FALLA: ", format, arguments);
+      va_end(arguments);
+    }
+    return false;
+  }
+
+  bool
+  Checker::expectAtMost(const char* what, double value, double bound) {
+    const bool passed = value <= bound;
+    if (passed) {
+      note("%s: %.4g (límite %.4g)", what, value, bound);
+    }
+    return expect(passed, "%s: %.4g (límite %.4g)", what, value, bound);
+  }
+
+  void
+  Checker::note(const char* format, ...) {
+    va_list arguments;
+    va_start(arguments, format);
+    print("  ", format, arguments);
+    va_end(arguments);
+  }
+
+  void
+  Checker::print(const char* prefix, const char* format, va_list arguments) {
+    std::fputs(prefix, stdout);
+    std::vprintf(format, arguments);
+    std::fputc('\n', stdout);
+  }
+
+#if defined(__linux__)
+  namespace {
+    // Abre un contador del proceso actual en cualquier CPU; group = -1 crea el líder.
+    int
+    openCounter(uint64_t config, int group) {
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = config;
+      attr.disabled = group < 0 ? 1 : 0;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_GROUP;
+      return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group, 0));
+    }
+  }
+
+  PerfCounters::PerfCounters() {
+    const uint64_t events[] = { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                PERF_COUNT_HW_BRANCH_MISSES, PERF_COUNT_HW_CACHE_MISSES };
+    for (uint64_t event : events) {
+      const int descriptor = openCounter(event, m_leader);
+      if (descriptor < 0) {
+        break;
+      }
+      if (m_leader < 0) {
+        m_leader = descriptor;
+      }
+      m_descriptors.push_back(descriptor);
+    }
+    // Sin los cuatro contadores no se reporta ninguno.
+    if (m_descriptors.size() != 4) {
+      for (int descriptor : m_descriptors) {
+        close(descriptor);
+      }
+      m_descriptors.clear();
+      m_leader = -1;
+    }
+  }
+
+  PerfCounters::~PerfCounters() {
+    for (int descriptor : m_descriptors) {
+      close(descriptor);
+    }
+  }
+
+  void
+  PerfCounters::start() {
+    if (isAvailable()) {
+      ioctl(m_leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+      ioctl(m_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+  }
+
+  Counters
+  PerfCounters::stop(size_t operations) {
+    Counters counters;
+    if (!isAvailable()) {
+      return counters;
+    }
+    ioctl(m_leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    // Formato de grupo: número de contadores y un valor por contador.
+    uint64_t values[1 + 4] = {};
+    if (read(m_leader, values, sizeof(values)) != static_cast<ssize_t>(sizeof(values)) || values[0] != 4) {
+      return counters;
+    }
+    const double scale = operations > 0 ? 1.0 / static_cast<double>(operations) : 0.0;
+    counters.valid = true;
+    counters.cycles = static_cast<double>(values[1]) * scale;
+    counters.instructions = static_cast<double>(values[2]) * scale;
+    counters.branchMisses = static_cast<double>(values[3]) * scale;
+    counters.cacheMisses = static_cast<double>(values[4]) * scale;
+    return counters;
+  }
+#else
+  PerfCounters::PerfCounters() = default;
+  PerfCounters::~PerfCounters() = default;
+
+  void
+  PerfCounters::start() {}
+
+  Counters
+  PerfCounters::stop(size_t) { return Counters(); }
+#endif
+}
+
+namespace {
+  using Clock = std::chrono::steady_clock;
+
+  struct
+  Options {
+    std::string filter;
+    std::string label;
+    std::string jsonPath;
+    std::string comparePath;
+    double minTimeMs = 100.0;
+    size_t repetitions = 5;
+    bool counters = false;
+    bool list = false;
+    bool check = false;
+  };
+
+  // Ejecuta el caso una vez con iterations iteraciones y devuelve los nanosegundos.
+  double
+  runOnce(const Bench::Case& benchmarkCase, Bench::State& state) {
+    const Clock::time_point begin = Clock::now();
+    benchmarkCase.function(state);
+    return std::chrono::duration<double, std::nano>(Clock::now() - begin).count();
+  }
+
+  /**
+   * @brief Mide un caso: calibra las iteraciones para que una repetición dure minTimeMs
+   * y toma la mediana de las repeticiones.
+   */
+  Bench::Result
+  measure(const Bench::Case& benchmarkCase, const Options& options, Bench::PerfCounters* counters) {
+    const double target = options.minTimeMs * 1.0e6;
+    size_t iterations = 1;
+    for (;;) {
+      Bench::State state(iterations);
+      const double elapsed = runOnce(benchmarkCase, state);
+      if (elapsed >= target * 0.1 || iterations >= (size_t(1) << 30)) {
+        const double scaled = static_cast<double>(iterations) * target / std::max(elapsed, 1.0);
+        iterations = static_cast<size_t>(std::min(std::max(scaled, 1.0), 1.0e10));
+        break;
+      }
+      iterations *= 10;
+    }
+
+    struct Sample {
+      double nsPerOp;
+      Bench::Counters counters;
+    };
+    std::vector<Sample> samples;
+    size_t itemsPerIteration = 1;
+    for (size_t r = 0; r < std::max<size_t>(options.repetitions, 1); ++r) {
+      Bench::State state(iterations);
+      if (counters) {
+        counters->start();
+      }
+      const double elapsed = runOnce(benchmarkCase, state);
+      Sample sample;
+      sample.counters = counters ? counters->stop(iterations) : Bench::Counters();
+      sample.nsPerOp = elapsed / static_cast<double>(iterations);
+      samples.push_back(sample);
+      itemsPerIteration = state.getItemsPerIteration();
+    }
+    std::sort(samples.begin(), samples.end(),
+              [](const Sample& a, const Sample& b) { return a.nsPerOp < b.nsPerOp; });
+
+    const Sample& median = samples[samples.size() / 2];
+    Bench::Result result;
+    result.name = benchmarkCase.suite + "/" + benchmarkCase.name;
+    result.iterations = iterations;
+    result.repetitions = samples.size();
+    result.nsPerOp = median.nsPerOp;
+    result.minNsPerOp = samples.front().nsPerOp;
+    result.opsPerSecond = median.nsPerOp > 0.0 ? 1.0e9 / median.nsPerOp : 0.0;
+    result.itemsPerSecond = result.opsPerSecond * static_cast<double>(itemsPerIteration);
+    result.counters = median.counters;
+    return result;
+  }
+
+  std::string
+  escapeJson(const std::string& text) {
+    std::string escaped;
+    for (char c : text) {
+      if (c == '"' || c == '\\') {
+        escaped += '\\';
+        escaped += c;
+      }
+      else if (static_cast<unsigned char>(c) < 0x20) {
+        char code[8];
+        std::snprintf(code, sizeof(code), "\\u%04x", c);
+        escaped += code;
+      }
+      else {
+        escaped += c;
+      }
+    }
+    return escaped;
+  }
+
+  const char*
+  getCompilerName() {
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+#define ALDAIR_BENCH_STRING_(x) #x
+#define ALDAIR_BENCH_STRING(x) ALDAIR_BENCH_STRING_(x)
+    return "msvc " ALDAIR_BENCH_STRING(_MSC_FULL_VER);
+#else
+    return "desconocido";
+#endif
+  }
+
+  const char*
+  getPlatformName() {
+#if defined(_WIN32)
+    return "windows";
+#elif defined(__linux__)
+    return "linux";
+#else
+    return "otra";
+#endif
+  }
+
+  /**
+   * @brief Escribe los resultados en JSON.
+   * Cada caso ocupa una línea para que readJson (y diff) puedan leerlo sin un parser.
+   */
+  bool
+  writeJson(const std::string& path, const Options& options, bool counters,
+            const std::vector<Bench::Result>& results) {
+    std::ofstream file(path);
+    if (!file) {
+      return false;
+    }
+    file << "{\n";
+    file << "  \"label\": \"" << escapeJson(options.label) << "\",\n";
+    file << "  \"compiler\": \"" << escapeJson(getCompilerName()) << "\",\n";
+    file << "  \"platform\": \"" << getPlatformName() << "\",\n";
+    file << "  \"counters\": " << (counters ? "true" : "false") << ",\n";
+    file << "  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+      const Bench::Result& result = results[i];
+      char line[512];
+      std::snprintf(line, sizeof(line),
+                    "    { \"name\": \"%s\", \"iterations\": %zu, \"repetitions\": %zu, \"ns_per_op\": %.4f, "
+                    "\"min_ns_per_op\": %.4f, \"ops_per_second\": %.1f, \"items_per_second\": %.1f",
+                    escapeJson(result.name).c_str(), result.iterations, result.repetitions, result.nsPerOp,
+                    result.minNsPerOp, result.opsPerSecond, result.itemsPerSecond);
+      file << line;
+      if (result.counters.valid) {
+        std::snprintf(line, sizeof(line),
+                      ", \"cycles_per_op\": %.3f, \"instructions_per_op\": %.3f, "
+                      "\"branch_misses_per_op\": %.5f, \"cache_misses_per_op\": %.5f",
+                      result.counters.cycles, result.counters.instructions,
+                      result.counters.branchMisses, result.counters.cacheMisses);
+        file << line;
+      }
+      file << " }" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    file << "  ]\n}\n";
+    return static_cast<bool>(file);
+  }
+
+  // Lee "name" y "ns_per_op" de un JSON escrito por writeJson.
+  std::map<std::string, double>
+  readJson(const std::string& path) {
+    std::map<std::string, double> times;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+      const size_t name = line.find("\"name\": \"");
+      const size_t time = line.find("\"ns_per_op\": ");
+      if (name == std::string::npos || time == std::string::npos) {
+        continue;
+      }
+      const size_t begin = name + 9;
+      const size_t end = line.find('"', begin);
+      times[line.substr(begin, end - begin)] = std::strtod(line.c_str() + time + 13, nullptr);
+    }
+    return times;
+  }
+
+  bool
+  matchesFilter(const std::string& suite, const std::string& name, const Options& options) {
+    return (suite + "/" + name).find(options.filter) != std::string::npos;
+  }
+
+  // Corre las verificaciones que pasan el filtro; devuelve el código de salida.
+  int
+  runChecks(const Options& options) {
+    size_t failed = 0, run = 0;
+    for (const Bench::CheckCase& checkCase : Bench::Registry::getInstance().getChecks()) {
+      if (!matchesFilter(checkCase.suite, checkCase.name, options)) {
+        continue;
+      }
+      if (options.list) {
+        std::printf("%s/%s\n", checkCase.suite.c_str(), checkCase.name.c_str());
+        continue;
+      }
+      std::printf("[ .... ] %s/%s\n", checkCase.suite.c_str(), checkCase.name.c_str());
+      std::fflush(stdout);
+      Bench::Checker checker;
+      const Clock::time_point begin = Clock::now();
+      checkCase.function(checker);
+      const double ms = std::chrono::duration<double, std::milli>(Clock::now() - begin).count();
+      ++run;
+      if (checker.getFailures() > 0) {
+        ++failed;
+        std::printf("[ FALLA] %s/%s: %zu fallas (%.0f ms)\n", checkCase.suite.c_str(),
+                    checkCase.name.c_str(), checker.getFailures(), ms);
+      }
+      else {
+        std::printf("[  OK  ] %s/%s (%.0f ms)\n", checkCase.suite.c_str(), checkCase.name.c_str(), ms);
+      }
+      std::fflush(stdout);
+    }
+    if (!options.list) {
+      std::printf("%zu verificaciones, %zu con fallas\n", run, failed);
+    }
+    return failed > 0 ? 1 : 0;
+  }
+
+  bool
+  parseOptions(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; ++i) {
+      const std::string option = argv[i];
+      const bool hasValue = i + 1 < argc;
+      if (option == "--list") {
+        options.list = true;
+      }
+      else if (option == "--check") {
+        options.check = true;
+      }
+      else if (option == "--counters") {
+        options.counters = true;
+      }
+      else if (option == "--filter" && hasValue) {
+        options.filter = argv[++i];
+      }
+      else if (option == "--label" && hasValue) {
+        options.label = argv[++i];
+      }
+      else if (option == "--json" && hasValue) {
+        options.jsonPath = argv[++i];
+      }
+      else if (option == "--compare" && hasValue) {
+        options.comparePath = argv[++i];
+      }
+      else if (option == "--min-time" && hasValue) {
+        options.minTimeMs = std::max(std::strtod(argv[++i], nullptr), 1.0);
+      }
+      else if (option == "--repetitions" && hasValue) {
+        options.repetitions = std::max<size_t>(std::strtoul(argv[++i], nullptr, 10), 1);
+      }
+      else {
+        std::fprintf(stderr, "Opción desconocida: %s\n", option.c_str());
+        return false;
+      }
+    }
+    return true;
+  }
+}
+
+int main(int argc, char* argv[]) {
+  Options options;
+  if (!parseOptions(argc, argv, options)) {
+    return 2;
+  }
+  if (options.check) {
+    return runChecks(options);
+  }
+
+  std::vector<Bench::Case> cases;
+  for (const Bench::Case& benchmarkCase : Bench::Registry::getInstance().getCases()) {
+    if (matchesFilter(benchmarkCase.suite, benchmarkCase.name, options)) {
+      cases.push_back(benchmarkCase);
+    }
+  }
+  if (options.list) {
+    for (const Bench::Case& benchmarkCase : cases) {
+      std::printf("%s/%s\n", benchmarkCase.suite.c_str(), benchmarkCase.name.c_str());
+    }
+    return 0;
+  }
+
+  Bench::PerfCounters perfCounters;
+  const bool counters = options.counters && perfCounters.isAvailable();
+  if (options.counters && !counters) {
+    std::fprintf(stderr, "perf_event_open no está disponible; se mide sin contadores.\n");
+  }
+  const std::map<std::string, double> baseline =
+    options.comparePath.empty() ? std::map<std::string, double>() : readJson(options.comparePath);
+
+  std::printf("%-40s %12s %14s %14s", "caso", "ns/op", "ops/s", "elementos/s");
+  if (counters) {
+    std::printf(" %10s %8s %10s %10s", "ciclos/op", "IPC", "fallos br", "fallos $");
+  }
+  if (!baseline.empty()) {
+    std::printf(" %10s", "vs base");
+  }
+  std::printf("\n");
+
+  std::vector<Bench::Result> results;
+  for (const Bench::Case& benchmarkCase : cases) {
+    const Bench::Result result = measure(benchmarkCase, options, counters ? &perfCounters : nullptr);
+    std::printf("%-40s %12.3f %14.4g %14.4g", result.name.c_str(), result.nsPerOp,
+                result.opsPerSecond, result.itemsPerSecond);
+    if (counters && result.counters.valid) {
+      std::printf(" %10.2f %8.2f %10.4f %10.4f", result.counters.cycles,
+                  result.counters.cycles > 0.0 ? result.counters.instructions / result.counters.cycles : 0.0,
+                  result.counters.branchMisses, result.counters.cacheMisses);
+    }
+    const auto previous = baseline.find(result.name);
+    if (previous != baseline.end() && previous->second > 0.0) {
+      std::printf(" %9.3fx", result.nsPerOp / previous->second);
+    }
+    std::printf("\n");
+    std::fflush(stdout);
+    results.push_back(result);
+  }
+
+  if (!options.jsonPath.empty() && !writeJson(options.jsonPath, options, counters, results)) {
+    std::fprintf(stderr, "No se pudo escribir %s\n", options.jsonPath.c_str());
+    return 1;
+  }
+  return 0;
+}
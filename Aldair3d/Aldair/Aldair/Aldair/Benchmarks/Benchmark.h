@@ -0,0 +1,243 @@
+#pragma once
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * @brief Microbenchmarks del motor (objetivo Aldair3dBench, independiente de la ventana).
+ * Cada caso es una función que repite state.getIterations() veces la operación medida;
+ * el ejecutor calibra las iteraciones hasta llenar el tiempo mínimo, repite la medición
+ * y reporta la mediana en ns por operación y operaciones por segundo. En Linux puede
+ * leer contadores de hardware con perf_event_open. Los resultados se pueden escribir
+ * en JSON y comparar contra un archivo de otra compilación.
+ *
+ * Los casos se registran solos con ALDAIR_BENCHMARK, así que cada archivo de casos
+ * que se enlaza agrega su suite.
+ *
+ * Con --check el ejecutable corre en cambio las verificaciones (ALDAIR_CHECK): precisión,
+ * pruebas aleatorias y equivalencia entre rutas escalares y SIMD. Termina con código 1 si
+ * alguna falla, así que se puede usar en integración continua.
+ */
+namespace Bench {
+  // Estado de un caso durante una medición.
+  class
+  State {
+  public:
+    explicit State(size_t iterations) : m_iterations(iterations) {}
+
+    // Veces que el caso debe repetir la operación medida.
+    size_t
+    getIterations() const { return m_iterations; }
+
+    /**
+     * @brief Elementos que procesa cada iteración, para reportar elementos por segundo.
+     * Por defecto 1: el caso procesa un elemento por iteración.
+     */
+    void
+    setItemsPerIteration(size_t items) { m_itemsPerIteration = items; }
+
+    size_t
+    getItemsPerIteration() const { return m_itemsPerIteration; }
+
+  private:
+    size_t m_iterations;
+    size_t m_itemsPerIteration = 1;
+  };
+
+  using Function = void (*)(State&);
+
+  /**
+   * @brief Acumula las fallas de una verificación.
+   * expect registra una falla si la condición es false; expectAtMost además reporta el
+   * valor medido, para que el registro de la ejecución muestre el margen de cada contrato.
+   */
+  class
+  Checker {
+  public:
+    // Registra una falla con un mensaje en formato de printf si condition es false.
+    bool
+    expect(bool condition, const char* format, ...);
+
+    // Reporta value y registra una falla si es mayor que bound (o NaN).
+    bool
+    expectAtMost(const char* what, double value, double bound);
+
+    // Mensaje informativo.
+    void
+    note(const char* format, ...);
+
+    size_t
+    getFailures() const { return m_failures; }
+
+  private:
+    void
+    print(const char* prefix, const char* format, va_list arguments);
+
+    size_t m_failures = 0;
+    size_t m_printed = 0; // Fallas impresas; después de kMaxPrinted solo se cuentan.
+  };
+
+  using CheckFunction = void (*)(Checker&);
+
+  // Caso registrado: suite/nombre y la función que lo ejecuta.
+  struct
+  Case {
+    std::string suite;
+    std::string name;
+    Function function = nullptr;
+  };
+
+  // Contadores de hardware por operación (valid = false si no se pudieron leer).
+  struct
+  Counters {
+    bool valid = false;
+    double cycles = 0.0;
+    double instructions = 0.0;
+    double branchMisses = 0.0;
+    double cacheMisses = 0.0;
+  };
+
+  // Verificación registrada.
+  struct
+  CheckCase {
+    std::string suite;
+    std::string name;
+    CheckFunction function = nullptr;
+  };
+
+  // Resultado de un caso.
+  struct
+  Result {
+    std::string name;         // "suite/nombre".
+    size_t iterations = 0;    // Iteraciones de cada repetición.
+    size_t repetitions = 0;   // Repeticiones medidas.
+    double nsPerOp = 0.0;     // Mediana de las repeticiones.
+    double minNsPerOp = 0.0;  // Repetición más rápida.
+    double opsPerSecond = 0.0;
+    double itemsPerSecond = 0.0;
+    Counters counters;        // De la repetición mediana.
+  };
+
+  /**
+   * @brief Registro de todos los casos del ejecutable.
+   */
+  class
+  Registry {
+  private:
+    Registry() = default;
+
+    Registry(const Registry&) = delete;
+    Registry& operator=(const Registry&) = delete;
+
+  public:
+    static Registry&
+    getInstance() {
+      static Registry instance;
+      return instance;
+    }
+
+    void
+    add(const Case& benchmarkCase) { m_cases.push_back(benchmarkCase); }
+
+    const std::vector<Case>&
+    getCases() const { return m_cases; }
+
+    void
+    add(const CheckCase& checkCase) { m_checks.push_back(checkCase); }
+
+    const std::vector<CheckCase>&
+    getChecks() const { return m_checks; }
+
+  private:
+    std::vector<Case> m_cases;
+    std::vector<CheckCase> m_checks;
+  };
+
+  // Registra un caso al construirse; lo usan ALDAIR_BENCHMARK y ALDAIR_CHECK.
+  struct
+  Registrar {
+    Registrar(const char* suite, const char* name, Function function) {
+      Registry::getInstance().add(Case{ suite, name, function });
+    }
+
+    Registrar(const char* suite, const char* name, CheckFunction function) {
+      Registry::getInstance().add(CheckCase{ suite, name, function });
+    }
+  };
+
+  /**
+   * @brief Impide que el compilador elimine el cálculo de value.
+   * Con GCC y Clang el valor debe existir en memoria antes de la barrera; con MSVC se
+   * lee un byte en una variable volátil.
+   */
+  template<typename T>
+  inline void
+  doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r"(&value) : "memory");
+#else
+    static volatile char sink;
+    sink = *reinterpret_cast<const volatile char*>(&value);
+    _ReadWriteBarrier();
+#endif
+  }
+
+  /**
+   * @brief Contadores de hardware con perf_event_open (solo Linux).
+   * Abre ciclos, instrucciones, fallos de predicción y fallos de caché como un grupo
+   * del proceso actual. Si el sistema no lo permite (perf_event_paranoid, máquinas
+   * virtuales, otros sistemas) isAvailable() es false y las mediciones siguen sin ellos.
+   */
+  class
+  PerfCounters {
+  public:
+    PerfCounters();
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    bool
+    isAvailable() const { return m_leader >= 0; }
+
+    void
+    start();
+
+    // Detiene el grupo y devuelve los totales divididos entre operations.
+    Counters
+    stop(size_t operations);
+
+  private:
+    int m_leader = -1;
+    std::vector<int> m_descriptors;
+  };
+}
+
+#define ALDAIR_BENCHMARK_CONCAT_(a, b) a##b
+#define ALDAIR_BENCHMARK_CONCAT(a, b) ALDAIR_BENCHMARK_CONCAT_(a, b)
+
+/**
+ * @brief Define y registra un caso: ALDAIR_BENCHMARK(Suite, Nombre) { for (...) {...} }.
+ * El cuerpo recibe Bench::State& state.
+ */
+#define ALDAIR_BENCHMARK(suite, name)                                                       \
+  static void ALDAIR_BENCHMARK_CONCAT(bench_##suite##_##name, __LINE__)(Bench::State&);      \
+  static const Bench::Registrar ALDAIR_BENCHMARK_CONCAT(registrar_##suite##_##name, __LINE__)( \
+    #suite, #name, &ALDAIR_BENCHMARK_CONCAT(bench_##suite##_##name, __LINE__));              \
+  static void ALDAIR_BENCHMARK_CONCAT(bench_##suite##_##name, __LINE__)(Bench::State& state)
+
+/**
+ * @brief Define y registra una verificación: ALDAIR_CHECK(Suite, Nombre) { check.expect(...); }.
+ * El cuerpo recibe Bench::Checker& check.
+ */
+#define ALDAIR_CHECK(suite, name)                                                           \
+  static void ALDAIR_BENCHMARK_CONCAT(check_##suite##_##name, __LINE__)(Bench::Checker&);    \
+  static const Bench::Registrar ALDAIR_BENCHMARK_CONCAT(checkRegistrar_##suite##_##name, __LINE__)( \
+    #suite, #name, &ALDAIR_BENCHMARK_CONCAT(check_##suite##_##name, __LINE__));              \
+  static void ALDAIR_BENCHMARK_CONCAT(check_##suite##_##name, __LINE__)(Bench::Checker& check)
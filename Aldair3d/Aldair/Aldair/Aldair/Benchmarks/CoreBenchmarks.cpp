@@ -0,0 +1,156 @@
+// Casos del núcleo: TSharedPointer frente a std::shared_ptr y Entity::getComponent.
+#include "Benchmark.h"
+#include "Entity.h"
+#include "Window.h"
+#include "Memory/TSharedPointer.h"
+#include <memory>
+
+namespace {
+  // Objeto del tamaño de un componente pequeño.
+  struct
+  Payload {
+    float values[8] = {};
+  };
+
+  // Componente de prueba; cada Index es un tipo distinto para getComponent.
+  template<int Index>
+  class
+  BenchComponent : public Component {
+  public:
+    BenchComponent() : Component(ComponentType::NONE) {}
+
+    void
+    update(float deltaTime) override { m_value += deltaTime; }
+
+    void
+    render(Window /*window*/) override {}
+
+  private:
+    float m_value = 0.0f;
+  };
+
+  // Entidad sin comportamiento con ocho componentes de tipos distintos, en orden 0..7.
+  class
+  BenchEntity : public Entity {
+  public:
+    BenchEntity() {
+      addComponent(EngineUtilities::MakeShared<BenchComponent<0>>());
+      addComponent(EngineUtilities::MakeShared<BenchComponent<1>>());
+      addComponent(EngineUtilities::MakeShared<BenchComponent<2>>());
+      addComponent(EngineUtilities::MakeShared<BenchComponent<3>>());
+      addComponent(EngineUtilities::MakeShared<BenchComponent<4>>());
+      addComponent(EngineUtilities::MakeShared<BenchComponent<5>>());
+      addComponent(EngineUtilities::MakeShared<BenchComponent<6>>());
+      addComponent(EngineUtilities::MakeShared<BenchComponent<7>>());
+    }
+
+    void
+    update(float /*deltaTime*/) override {}
+
+    void
+    render(Window& /*window*/) override {}
+  };
+
+  BenchEntity&
+  getEntity() {
+    static BenchEntity entity;
+    return entity;
+  }
+
+  // Busca T en la entidad de prueba una vez por iteración.
+  template<typename T>
+  void
+  lookup(Bench::State& state) {
+    BenchEntity& entity = getEntity();
+    for (size_t i = 0; i < state.getIterations(); ++i) {
+      EngineUtilities::TSharedPointer<T> component = entity.getComponent<T>();
+      Bench::doNotOptimize(component.get());
+    }
+  }
+}
+
+// ---------------------------------------------------------------------------
+// TSharedPointer frente a std::shared_ptr.
+// ---------------------------------------------------------------------------
+
+ALDAIR_BENCHMARK(SharedPointer, makeShared) {
+  for (size_t i = 0; i < state.getIterations(); ++i) {
+    EngineUtilities::TSharedPointer<Payload> pointer = EngineUtilities::MakeShared<Payload>();
+    Bench::doNotOptimize(pointer.get());
+  }
+}
+
+ALDAIR_BENCHMARK(SharedPointer, stdMakeShared) {
+  for (size_t i = 0; i < state.getIterations(); ++i) {
+    std::shared_ptr<Payload> pointer = std::make_shared<Payload>();
+    Bench::doNotOptimize(pointer.get());
+  }
+}
+
+// Copia y destrucción: un incremento y un decremento del contador.
+ALDAIR_BENCHMARK(SharedPointer, copy) {
+  const EngineUtilities::TSharedPointer<Payload> source = EngineUtilities::MakeShared<Payload>();
+  for (size_t i = 0; i < state.getIterations(); ++i) {
+    EngineUtilities::TSharedPointer<Payload> copy = source;
+    Bench::doNotOptimize(copy.get());
+  }
+}
+
+// std::shared_ptr usa contadores atómicos, TSharedPointer no.
+ALDAIR_BENCHMARK(SharedPointer, stdCopy) {
+  const std::shared_ptr<Payload> source = std::make_shared<Payload>();
+  for (size_t i = 0; i < state.getIterations(); ++i) {
+    std::shared_ptr<Payload> copy = source;
+    Bench::doNotOptimize(copy.get());
+  }
+}
+
+ALDAIR_BENCHMARK(SharedPointer, dereference) {
+  const EngineUtilities::TSharedPointer<Payload> pointer = EngineUtilities::MakeShared<Payload>();
+  for (size_t i = 0; i < state.getIterations(); ++i) {
+    pointer->values[i & 7] += 1.0f;
+    Bench::doNotOptimize(pointer->values[0]);
+  }
+}
+
+ALDAIR_BENCHMARK(SharedPointer, stdDereference) {
+  const std::shared_ptr<Payload> pointer = std::make_shared<Payload>();
+  for (size_t i = 0; i < state.getIterations(); ++i) {
+    pointer->values[i & 7] += 1.0f;
+    Bench::doNotOptimize(pointer->values[0]);
+  }
+}
+
+ALDAIR_BENCHMARK(SharedPointer, dynamicCast) {
+  const EngineUtilities::TSharedPointer<Component> pointer =
+    EngineUtilities::MakeShared<BenchComponent<0>>().dynamic_pointer_cast<Component>();
+  for (size_t i = 0; i < state.getIterations(); ++i) {
+    EngineUtilities::TSharedPointer<BenchComponent<0>> cast = pointer.dynamic_pointer_cast<BenchComponent<0>>();
+    Bench::doNotOptimize(cast.get());
+  }
+}
+
+ALDAIR_BENCHMARK(SharedPointer, stdDynamicCast) {
+  const std::shared_ptr<Component> pointer = std::make_shared<BenchComponent<0>>();
+  for (size_t i = 0; i < state.getIterations(); ++i) {
+    std::shared_ptr<BenchComponent<0>> cast = std::dynamic_pointer_cast<BenchComponent<0>>(pointer);
+    Bench::doNotOptimize(cast.get());
+  }
+}
+
+// ---------------------------------------------------------------------------
+// getComponent: recorre los componentes con dynamic_pointer_cast hasta encontrar T.
+// ---------------------------------------------------------------------------
+
+ALDAIR_BENCHMARK(Entity, getComponentFirst) {
+  lookup<BenchComponent<0>>(state);
+}
+
+ALDAIR_BENCHMARK(Entity, getComponentLast) {
+  lookup<BenchComponent<7>>(state);
+}
+
+// Tipo que la entidad no tiene: recorre los ocho componentes.
+ALDAIR_BENCHMARK(Entity, getComponentMissing) {
+  lookup<BenchComponent<8>>(state);
+}
@@ -0,0 +1,242 @@
+// Casos de MathEngine, Vector2/3/4 y Quaternion. Cada iteración usa una entrada
+// distinta de una tabla fija, así que se mide el rendimiento (no la latencia) de cada
+// operación con entradas que no se pueden precalcular.
+#include "Benchmark.h"
+#include "MathEngine.h"
+#include "Vector2.h"
+#include "Vector3.h"
+#include "Vector4.h"
+#include "Quaternion.h"
+#include <cmath>
+#include <random>
+
+namespace {
+  // Entradas por tabla; potencia de 2 para recorrerlas con una máscara.
+  constexpr size_t kInputs = 1024;
+  constexpr size_t kMask = kInputs - 1;
+
+  // Tabla de kInputs floats uniformes en [low, high], igual en cada ejecución.
+  std::vector<float>
+  makeInputs(float low, float high, unsigned int seed) {
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float> random(low, high);
+    std::vector<float> values(kInputs);
+    for (float& value : values) {
+      value = random(generator);
+    }
+    return values;
+  }
+
+  const std::vector<float>&
+  getPositive() {
+    static const std::vector<float> values = makeInputs(1.0e-3f, 1.0e4f, 1);
+    return values;
+  }
+
+  const std::vector<float>&
+  getAngles() {
+    static const std::vector<float> values = makeInputs(-MathEngine::PI, MathEngine::PI, 2);
+    return values;
+  }
+
+  const std::vector<float>&
+  getSigned() {
+    static const std::vector<float> values = makeInputs(-100.0f, 100.0f, 3);
+    return values;
+  }
+
+  const std::vector<Vector4>&
+  getVectors() {
+    static const std::vector<Vector4> vectors = [] {
+      const std::vector<float> a = makeInputs(-100.0f, 100.0f, 4);
+      const std::vector<float> b = makeInputs(-100.0f, 100.0f, 5);
+      const std::vector<float> c = makeInputs(-100.0f, 100.0f, 6);
+      std::vector<Vector4> result(kInputs);
+      for (size_t i = 0; i < kInputs; ++i) {
+        result[i] = Vector4(a[i], b[i], c[i], 1.0f);
+      }
+      return result;
+    }();
+    return vectors;
+  }
+
+  // Cuaterniones unitarios aleatorios.
+  const std::vector<Quaternion>&
+  getRotations() {
+    static const std::vector<Quaternion> rotations = [] {
+      std::mt19937 generator(7);
+      std::normal_distribution<float> gaussian(0.0f, 1.0f);
+      std::vector<Quaternion> result(kInputs);
+      for (Quaternion& q : result) {
+        q = Quaternion(gaussian(generator), gaussian(generator), gaussian(generator), gaussian(generator)).normalize();
+      }
+      return result;
+    }();
+    return rotations;
+  }
+
+  // Repite function(i) state.getIterations() veces sin dejar que se elimine el resultado.
+  template<typename Function>
+  void
+  repeat(Bench::State& state, Function function) {
+    for (size_t i = 0; i < state.getIterations(); ++i) {
+      Bench::doNotOptimize(function(i & kMask));
+    }
+  }
+}
+
+// ---------------------------------------------------------------------------
+// MathEngine frente a la biblioteca estándar.
+// ---------------------------------------------------------------------------
+
+ALDAIR_BENCHMARK(MathEngine, sqrt) {
+  const std::vector<float>& x = getPositive();
+  repeat(state, [&](size_t i) { return MathEngine::sqrt(x[i]); });
+}
+
+ALDAIR_BENCHMARK(MathEngine, stdSqrt) {
+  const std::vector<float>& x = getPositive();
+  repeat(state, [&](size_t i) { return std::sqrt(x[i]); });
+}
+
+ALDAIR_BENCHMARK(MathEngine, rsqrt) {
+  const std::vector<float>& x = getPositive();
+  repeat(state, [&](size_t i) { return MathEngine::rsqrt(x[i]); });
+}
+
+ALDAIR_BENCHMARK(MathEngine, stdRsqrt) {
+  const std::vector<float>& x = getPositive();
+  repeat(state, [&](size_t i) { return 1.0f / std::sqrt(x[i]); });
+}
+
+ALDAIR_BENCHMARK(MathEngine, sin) {
+  const std::vector<float>& x = getAngles();
+  repeat(state, [&](size_t i) { return MathEngine::sin(x[i]); });
+}
+
+ALDAIR_BENCHMARK(MathEngine, stdSin) {
+  const std::vector<float>& x = getAngles();
+  repeat(state, [&](size_t i) { return std::sin(x[i]); });
+}
+
+ALDAIR_BENCHMARK(MathEngine, cos) {
+  const std::vector<float>& x = getAngles();
+  repeat(state, [&](size_t i) { return MathEngine::cos(x[i]); });
+}
+
+ALDAIR_BENCHMARK(MathEngine, stdCos) {
+  const std::vector<float>& x = getAngles();
+  repeat(state, [&](size_t i) { return std::cos(x[i]); });
+}
+
+ALDAIR_BENCHMARK(MathEngine, sincos) {
+  const std::vector<float>& x = getAngles();
+  repeat(state, [&](size_t i) {
+    float sine = 0.0f, cosine = 0.0f;
+    MathEngine::sincos(x[i], sine, cosine);
+    return sine + cosine;
+  });
+}
+
+ALDAIR_BENCHMARK(MathEngine, atan2) {
+  const std::vector<float>& x = getSigned();
+  const std::vector<float>& y = getAngles();
+  repeat(state, [&](size_t i) { return MathEngine::atan2(y[i], x[i]); });
+}
+
+ALDAIR_BENCHMARK(MathEngine, stdAtan2) {
+  const std::vector<float>& x = getSigned();
+  const std::vector<float>& y = getAngles();
+  repeat(state, [&](size_t i) { return std::atan2(y[i], x[i]); });
+}
+
+// ---------------------------------------------------------------------------
+// Vectores.
+// ---------------------------------------------------------------------------
+
+ALDAIR_BENCHMARK(Vector, vector2Add) {
+  const std::vector<Vector4>& v = getVectors();
+  repeat(state, [&](size_t i) {
+    return Vector2(v[i].x, v[i].y) + Vector2(v[(i + 1) & kMask].x, v[(i + 1) & kMask].y);
+  });
+}
+
+ALDAIR_BENCHMARK(Vector, vector2Magnitude) {
+  const std::vector<Vector4>& v = getVectors();
+  repeat(state, [&](size_t i) { return Vector2(v[i].x, v[i].y).magnitude(); });
+}
+
+ALDAIR_BENCHMARK(Vector, vector2Normalize) {
+  const std::vector<Vector4>& v = getVectors();
+  repeat(state, [&](size_t i) { return Vector2(v[i].x, v[i].y).normalize(); });
+}
+
+ALDAIR_BENCHMARK(Vector, vector3Magnitude) {
+  const std::vector<Vector4>& v = getVectors();
+  repeat(state, [&](size_t i) { return Vector3(v[i].x, v[i].y, v[i].z).magnitude(); });
+}
+
+ALDAIR_BENCHMARK(Vector, vector3Normalize) {
+  const std::vector<Vector4>& v = getVectors();
+  repeat(state, [&](size_t i) { return Vector3(v[i].x, v[i].y, v[i].z).normalize(); });
+}
+
+ALDAIR_BENCHMARK(Vector, vector4Dot) {
+  const std::vector<Vector4>& v = getVectors();
+  repeat(state, [&](size_t i) { return v[i].dot(v[(i + 1) & kMask]); });
+}
+
+ALDAIR_BENCHMARK(Vector, vector4Normalize) {
+  const std::vector<Vector4>& v = getVectors();
+  repeat(state, [&](size_t i) { return v[i].normalize(); });
+}
+
+// ---------------------------------------------------------------------------
+// Cuaterniones.
+// ---------------------------------------------------------------------------
+
+ALDAIR_BENCHMARK(Quaternion, multiply) {
+  const std::vector<Quaternion>& q = getRotations();
+  repeat(state, [&](size_t i) { return q[i] * q[(i + 1) & kMask]; });
+}
+
+ALDAIR_BENCHMARK(Quaternion, normalize) {
+  const std::vector<Quaternion>& q = getRotations();
+  repeat(state, [&](size_t i) { return (q[i] * 3.0f).normalize(); });
+}
+
+ALDAIR_BENCHMARK(Quaternion, rotate) {
+  const std::vector<Quaternion>& q = getRotations();
+  const std::vector<Vector4>& v = getVectors();
+  repeat(state, [&](size_t i) { return q[i].rotate(Vector3(v[i].x, v[i].y, v[i].z)); });
+}
+
+ALDAIR_BENCHMARK(Quaternion, rotateUnit) {
+  const std::vector<Quaternion>& q = getRotations();
+  const std::vector<Vector4>& v = getVectors();
+  repeat(state, [&](size_t i) { return q[i].rotateUnit(Vector3(v[i].x, v[i].y, v[i].z)); });
+}
+
+// Rotación en bloque de toda la tabla con un cuaternión; cada iteración rota kInputs vectores.
+ALDAIR_BENCHMARK(Quaternion, rotateUnitBatch) {
+  const Quaternion rotation = getRotations()[0];
+  const std::vector<Vector4>& v = getVectors();
+  std::vector<Vector4> out(kInputs);
+  state.setItemsPerIteration(kInputs);
+  for (size_t i = 0; i < state.getIterations(); ++i) {
+    rotation.rotateUnit(v.data(), out.data(), kInputs);
+    Bench::doNotOptimize(out[i & kMask]);
+  }
+}
+
+ALDAIR_BENCHMARK(Quaternion, slerp) {
+  const std::vector<Quaternion>& q = getRotations();
+  const std::vector<float>& t = getAngles();
+  repeat(state, [&](size_t i) { return Quaternion::slerp(q[i], q[(i + 1) & kMask], std::fabs(t[i]) / MathEngine::PI); });
+}
+
+ALDAIR_BENCHMARK(Quaternion, nlerp) {
+  const std::vector<Quaternion>& q = getRotations();
+  const std::vector<float>& t = getAngles();
+  repeat(state, [&](size_t i) { return Quaternion::nlerp(q[i], q[(i + 1) & kMask], std::fabs(t[i]) / MathEngine::PI); });
+}
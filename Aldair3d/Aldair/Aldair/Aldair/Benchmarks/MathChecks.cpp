@@ -0,0 +1,426 @@
+// Verificaciones de MathEngine y Quaternion: contratos de precisión frente a las
+// funciones de std en double y rutas en bloque frente a las escalares.
+#include "Benchmark.h"
+#include "MathEngine.h"
+#include "MathBatch.h"
+#include "Quaternion.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+  // Puntos de cada barrido uniforme.
+  constexpr int kSweepPoints = 1 << 21;
+
+  // Distancia en ULP entre un resultado float y la referencia en double.
+  double
+  ulpError(float value, double reference) {
+    const float rounded = static_cast<float>(reference);
+    if (rounded == 0.0f) {
+      return std::fabs(value - reference) / std::ldexp(1.0, -149);
+    }
+    int exponent = 0;
+    std::frexp(rounded, &exponent);
+    return std::fabs(static_cast<double>(value) - reference) / std::ldexp(1.0, exponent - 24);
+  }
+
+  // Error máximo de function frente a reference en count + 1 puntos de [low, high].
+  template<typename Function, typename Reference>
+  double
+  sweepUlp(Function function, Reference reference, float low, float high, int count) {
+    double maxError = 0.0;
+    for (int i = 0; i <= count; ++i) {
+      const float x = low + (high - low) * static_cast<float>(i) / static_cast<float>(count);
+      maxError = std::max(maxError, ulpError(function(x), reference(static_cast<double>(x))));
+    }
+    return maxError;
+  }
+
+  // Cuaternión (w, x, y, z) sin SIMD para la referencia escalar.
+  struct
+  ScalarQuaternion {
+    float w, x, y, z;
+  };
+
+  ScalarQuaternion
+  multiplyScalar(const ScalarQuaternion& a, const ScalarQuaternion& b) {
+    return { a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z,
+             a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+             a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+             a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w };
+  }
+
+  // Cuaternión (w, x, y, z) en double para las referencias de precisión.
+  struct
+  DoubleQuaternion {
+    double w, x, y, z;
+  };
+
+  DoubleQuaternion
+  normalizeDouble(const Quaternion& q) {
+    const double w = q.w, x = q.x, y = q.y, z = q.z;
+    const double inv = 1.0 / std::sqrt(w * w + x * x + y * y + z * z);
+    return { w * inv, x * inv, y * inv, z * inv };
+  }
+
+  // Rota v con el cuaternión normalizado q: v' = q * v * q^-1.
+  void
+  rotateDouble(const DoubleQuaternion& q, const Vector4& v, double out[3]) {
+    const double tx = 2.0 * (q.y * v.z - q.z * v.y);
+    const double ty = 2.0 * (q.z * v.x - q.x * v.z);
+    const double tz = 2.0 * (q.x * v.y - q.y * v.x);
+    out[0] = v.x + q.w * tx + (q.y * tz - q.z * ty);
+    out[1] = v.y + q.w * ty + (q.z * tx - q.x * tz);
+    out[2] = v.z + q.w * tz + (q.x * ty - q.y * tx);
+  }
+
+  // slerp en double por el camino más corto; con ángulos casi nulos interpola linealmente.
+  DoubleQuaternion
+  slerpDouble(const Quaternion& from, const Quaternion& to, double t) {
+    const DoubleQuaternion a = normalizeDouble(from);
+    DoubleQuaternion b = normalizeDouble(to);
+    double cosine = a.w * b.w + a.x * b.x + a.y * b.y + a.z * b.z;
+    if (cosine < 0.0) {
+      b = { -b.w, -b.x, -b.y, -b.z };
+      cosine = -cosine;
+    }
+    const double theta = std::acos(std::min(cosine, 1.0));
+    double wa = 1.0 - t, wb = t;
+    if (theta > 1.0e-9) {
+      wa = std::sin((1.0 - t) * theta) / std::sin(theta);
+      wb = std::sin(t * theta) / std::sin(theta);
+    }
+    const double w = wa * a.w + wb * b.w, x = wa * a.x + wb * b.x;
+    const double y = wa * a.y + wb * b.y, z = wa * a.z + wb * b.z;
+    const double inv = 1.0 / std::sqrt(w * w + x * x + y * y + z * z);
+    return { w * inv, x * inv, y * inv, z * inv };
+  }
+
+  std::vector<Vector4>
+  makeVectors(size_t count, unsigned int seed) {
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float> random(-100.0f, 100.0f);
+    std::vector<Vector4> vectors(count);
+    for (Vector4& v : vectors) {
+      v = Vector4(random(generator), random(generator), random(generator), 1.0f);
+    }
+    return vectors;
+  }
+
+  // Funciones de MathEngine comparadas entre la evaluación constante y la de ejecución.
+  constexpr size_t kConstantFunctions = 7;
+  constexpr size_t kConstantInputs = 512;
+  constexpr const char* kConstantNames[kConstantFunctions] = { "sqrt", "rsqrt", "sin", "cos", "tan", "atan", "atan2" };
+
+  // Entradas en [-100, 100] de un generador congruencial y los resultados de cada función.
+  struct
+  ConstantTable {
+    float inputs[kConstantInputs];
+    float results[kConstantFunctions][kConstantInputs];
+  };
+
+  constexpr float
+  evaluate(size_t function, float x) {
+    const float magnitude = x < 0.0f ? -x : x;
+    switch (function) {
+    case 0: return MathEngine::sqrt(magnitude);
+    case 1: return MathEngine::rsqrt(magnitude);
+    case 2: return MathEngine::sin(x);
+    case 3: return MathEngine::cos(x);
+    case 4: return MathEngine::tan(x);
+    case 5: return MathEngine::atan(x);
+    default: return MathEngine::atan2(x, 1.0f - x);
+    }
+  }
+
+  constexpr ConstantTable
+  makeConstantTable() {
+    ConstantTable table{};
+    uint32_t state = 12345u;
+    for (size_t i = 0; i < kConstantInputs; ++i) {
+      state = state * 1664525u + 1013904223u;
+      table.inputs[i] = static_cast<float>(state >> 8) * (200.0f / 16777216.0f) - 100.0f;
+      for (size_t function = 0; function < kConstantFunctions; ++function) {
+        table.results[function][i] = evaluate(function, table.inputs[i]);
+      }
+    }
+    return table;
+  }
+}
+
+// ---------------------------------------------------------------------------
+// Contratos de precisión de MathEngine.
+// ---------------------------------------------------------------------------
+
+ALDAIR_CHECK(MathEngine, sqrt) {
+  check.expectAtMost("sqrt [1e-30, 1e30] ulp",
+                     sweepUlp([](float x) { return MathEngine::sqrt(x); },
+                              [](double x) { return std::sqrt(x); }, 1.0e-30f, 1.0e30f, kSweepPoints),
+                     MathEngine::SQRT_MAX_ULP);
+}
+
+ALDAIR_CHECK(MathEngine, rsqrt) {
+  check.expectAtMost("rsqrt [1e-3, 1e3] ulp",
+                     sweepUlp([](float x) { return MathEngine::rsqrt(x); },
+                              [](double x) { return 1.0 / std::sqrt(x); }, 1.0e-3f, 1.0e3f, kSweepPoints),
+                     MathEngine::RSQRT_MAX_ULP);
+}
+
+ALDAIR_CHECK(MathEngine, sin) {
+  auto function = [](float x) { return MathEngine::sin(x); };
+  auto reference = [](double x) { return std::sin(x); };
+  check.expectAtMost("sin [-32, 32] ulp", sweepUlp(function, reference, -32.0f, 32.0f, kSweepPoints),
+                     MathEngine::SIN_MAX_ULP);
+  check.expectAtMost("sin [-1e6, 1e6] ulp",
+                     sweepUlp(function, reference, -MathEngine::TRIG_ACCURATE_RANGE,
+                              MathEngine::TRIG_ACCURATE_RANGE, kSweepPoints),
+                     MathEngine::SIN_MAX_ULP);
+}
+
+ALDAIR_CHECK(MathEngine, cos) {
+  auto function = [](float x) { return MathEngine::cos(x); };
+  auto reference = [](double x) { return std::cos(x); };
+  check.expectAtMost("cos [-32, 32] ulp", sweepUlp(function, reference, -32.0f, 32.0f, kSweepPoints),
+                     MathEngine::COS_MAX_ULP);
+  check.expectAtMost("cos [-1e6, 1e6] ulp",
+                     sweepUlp(function, reference, -MathEngine::TRIG_ACCURATE_RANGE,
+                              MathEngine::TRIG_ACCURATE_RANGE, kSweepPoints),
+                     MathEngine::COS_MAX_ULP);
+}
+
+// sincos: el error es el mayor entre el seno y el coseno.
+ALDAIR_CHECK(MathEngine, sincos) {
+  double maxError = 0.0;
+  for (int i = 0; i <= kSweepPoints; ++i) {
+    const float x = -32.0f + 64.0f * static_cast<float>(i) / static_cast<float>(kSweepPoints);
+    float s = 0.0f, c = 0.0f;
+    MathEngine::sincos(x, s, c);
+    maxError = std::max({ maxError, ulpError(s, std::sin(static_cast<double>(x))),
+                          ulpError(c, std::cos(static_cast<double>(x))) });
+  }
+  check.expectAtMost("sincos [-32, 32] ulp", maxError, std::max(MathEngine::SIN_MAX_ULP, MathEngine::COS_MAX_ULP));
+}
+
+ALDAIR_CHECK(MathEngine, tan) {
+  check.expectAtMost("tan [-1.5, 1.5] ulp",
+                     sweepUlp([](float x) { return MathEngine::tan(x); },
+                              [](double x) { return std::tan(x); }, -1.5f, 1.5f, kSweepPoints),
+                     MathEngine::TAN_MAX_ULP);
+}
+
+ALDAIR_CHECK(MathEngine, atan) {
+  check.expectAtMost("atan [-100, 100] ulp",
+                     sweepUlp([](float x) { return MathEngine::atan(x); },
+                              [](double x) { return std::atan(x); }, -100.0f, 100.0f, kSweepPoints),
+                     MathEngine::ATAN_MAX_ULP);
+}
+
+// atan2: puntos aleatorios en los cuatro cuadrantes.
+ALDAIR_CHECK(MathEngine, atan2) {
+  std::mt19937 generator(11);
+  std::uniform_real_distribution<float> coordinate(-100.0f, 100.0f);
+  double maxError = 0.0;
+  for (int i = 0; i < kSweepPoints; ++i) {
+    const float y = coordinate(generator);
+    const float x = coordinate(generator);
+    maxError = std::max(maxError, ulpError(MathEngine::atan2(y, x),
+                                           std::atan2(static_cast<double>(y), static_cast<double>(x))));
+  }
+  check.expectAtMost("atan2 [-100, 100]^2 ulp", maxError, MathEngine::ATAN2_MAX_ULP);
+}
+
+/**
+ * @brief Barrido denso cerca de k * pi/2, donde la reducción pierde más bits: los
+ * kDenseNeighbors floats a cada lado de k * pi/2 para |k * pi/2| <= 128 y los
+ * kFarNeighbors floats a cada lado para todos los múltiplos hasta TRIG_ACCURATE_RANGE.
+ */
+ALDAIR_CHECK(MathEngine, nearHalfPiMultiples) {
+  constexpr int kDenseNeighbors = 4096;
+  constexpr int kFarNeighbors = 8;
+  constexpr double kHalfPi = 1.5707963267948966;
+  const int denseMultiples = static_cast<int>(128.0 / kHalfPi);
+  const int farMultiples = static_cast<int>(MathEngine::TRIG_ACCURATE_RANGE / kHalfPi);
+
+  double sinError = 0.0, cosError = 0.0, tanError = 0.0;
+  float worstSin = 0.0f, worstCos = 0.0f, worstTan = 0.0f;
+  auto scan = [&](float x) {
+    const double reference = x;
+    const double errors[3] = { ulpError(MathEngine::sin(x), std::sin(reference)),
+                               ulpError(MathEngine::cos(x), std::cos(reference)),
+                               ulpError(MathEngine::tan(x), std::tan(reference)) };
+    if (errors[0] > sinError) { sinError = errors[0]; worstSin = x; }
+    if (errors[1] > cosError) { cosError = errors[1]; worstCos = x; }
+    if (errors[2] > tanError) { tanError = errors[2]; worstTan = x; }
+  };
+  for (int k = -farMultiples; k <= farMultiples; ++k) {
+    const int neighbors = (k >= -denseMultiples && k <= denseMultiples) ? kDenseNeighbors : kFarNeighbors;
+    float x = static_cast<float>(k * kHalfPi);
+    for (int i = 0; i < neighbors; ++i) {
+      x = std::nextafter(x, -std::numeric_limits<float>::infinity());
+    }
+    for (int i = 0; i < 2 * neighbors + 1; ++i) {
+      scan(x);
+      x = std::nextafter(x, std::numeric_limits<float>::infinity());
+    }
+  }
+  check.expectAtMost("sin cerca de k * pi/2 ulp", sinError, MathEngine::SIN_MAX_ULP);
+  check.expectAtMost("cos cerca de k * pi/2 ulp", cosError, MathEngine::COS_MAX_ULP);
+  check.expectAtMost("tan cerca de k * pi/2 ulp", tanError, MathEngine::TAN_MAX_ULP);
+  check.note("peores casos: sin(%.9g), cos(%.9g), tan(%.9g)", worstSin, worstCos, worstTan);
+}
+
+// Barrido denso alrededor de los puntos de corte de la reducción de atan, con ambos signos.
+ALDAIR_CHECK(MathEngine, atanBreakpoints) {
+  constexpr int kNeighbors = 1 << 16;
+  const float breakpoints[] = { 2.44140625e-4f, 0.4375f, 0.6875f, 1.1875f, 2.4375f,
+                                0.41421356f, 1.0f, 1.556f, 2.41421356f };
+  double maxError = 0.0;
+  for (float breakpoint : breakpoints) {
+    for (float sign : { 1.0f, -1.0f }) {
+      float x = sign * breakpoint;
+      for (int i = 0; i < kNeighbors; ++i) {
+        x = std::nextafter(x, -std::numeric_limits<float>::infinity());
+      }
+      for (int i = 0; i < 2 * kNeighbors + 1; ++i) {
+        maxError = std::max(maxError, ulpError(MathEngine::atan(x), std::atan(static_cast<double>(x))));
+        x = std::nextafter(x, std::numeric_limits<float>::infinity());
+      }
+    }
+  }
+  check.expectAtMost("atan en los puntos de corte ulp", maxError, MathEngine::ATAN_MAX_ULP);
+}
+
+// Valores especiales: infinitos, ceros con signo y subnormales.
+ALDAIR_CHECK(MathEngine, specialValues) {
+  const float infinity = std::numeric_limits<float>::infinity();
+  check.expect(MathEngine::rsqrt(infinity) == 0.0f, "rsqrt(inf) = %g", MathEngine::rsqrt(infinity));
+  check.expect(MathEngine::rsqrt(0.0f) == 0.0f && MathEngine::rsqrt(-1.0f) == 0.0f, "rsqrt(x <= 0) no es 0");
+  check.expect(MathEngine::rsqrt(std::numeric_limits<float>::quiet_NaN()) == 0.0f, "rsqrt(NaN) no es 0");
+
+  // Uno de cada 7 floats desde el menor subnormal hasta pasar el umbral de escalado (2^-102).
+  double subnormalError = 0.0;
+  for (uint32_t bits = 1; bits < 0x0d800000u; bits += 7) {
+    const float x = MathEngine::detail::fromBits(bits);
+    subnormalError = std::max(subnormalError, ulpError(MathEngine::rsqrt(x), 1.0 / std::sqrt(static_cast<double>(x))));
+  }
+  check.expectAtMost("rsqrt [2^-149, 1e-30] ulp", subnormalError, MathEngine::RSQRT_MAX_ULP);
+
+  check.expect(MathEngine::atan2(-0.0f, -1.0f) == -MathEngine::PI, "atan2(-0, -1) = %.9g", MathEngine::atan2(-0.0f, -1.0f));
+  check.expect(MathEngine::atan2(0.0f, -1.0f) == MathEngine::PI, "atan2(0, -1) = %.9g", MathEngine::atan2(0.0f, -1.0f));
+  check.expect(std::signbit(MathEngine::atan(-0.0f)), "atan(-0) pierde el signo");
+  check.expect(MathEngine::atan(infinity) == MathEngine::HALF_PI && MathEngine::atan(-infinity) == -MathEngine::HALF_PI,
+               "atan(+-inf) = %.9g", MathEngine::atan(infinity));
+  check.expect(std::isnan(MathEngine::sin(infinity)) && std::isnan(MathEngine::cos(-infinity)), "sin(inf) no es NaN");
+}
+
+/**
+ * @brief Las funciones evaluadas en tiempo de compilación dan los mismos bits que en
+ * tiempo de ejecución. Falla si el compilador contrae a FMA (falta -ffp-contract=off o
+ * hay /fp:contract); las entradas pasan por un volatile para que no se plieguen.
+ */
+ALDAIR_CHECK(MathEngine, constexprMatchesRuntime) {
+  static constexpr ConstantTable kTable = makeConstantTable();
+  for (size_t function = 0; function < kConstantFunctions; ++function) {
+    size_t differences = 0;
+    for (size_t i = 0; i < kConstantInputs; ++i) {
+      volatile float input = kTable.inputs[i];
+      const float runtime = evaluate(function, input);
+      if (MathEngine::detail::toBits(runtime) != MathEngine::detail::toBits(kTable.results[function][i])) {
+        ++differences;
+      }
+    }
+    check.expect(differences == 0, "%s: %zu de %zu resultados distintos en tiempo de ejecución",
+                 kConstantNames[function], differences, kConstantInputs);
+  }
+}
+
+// ---------------------------------------------------------------------------
+// Cuaterniones: rotación en bloque y con cuaterniones unitarios, slerp y nlerp.
+// ---------------------------------------------------------------------------
+
+// La rotación en bloque coincide con los productos de Hamilton hechos componente por componente.
+ALDAIR_CHECK(Quaternion, rotateBatch) {
+  constexpr size_t kCount = 1000000;
+  const std::vector<Vector4> input = makeVectors(kCount, 5);
+  std::vector<Vector4> simd(kCount);
+  const Quaternion rotation(1.1f, Vector3(0.48f, 0.6f, 0.64f));
+  rotation.rotate(input.data(), simd.data(), kCount);
+
+  const ScalarQuaternion q = { rotation.w, rotation.x, rotation.y, rotation.z };
+  const float magSquared = q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z;
+  const ScalarQuaternion inverse = { q.w / magSquared, -q.x / magSquared, -q.y / magSquared, -q.z / magSquared };
+  float maxError = 0.0f;
+  for (size_t i = 0; i < kCount; ++i) {
+    const ScalarQuaternion r = multiplyScalar(multiplyScalar(q, { 0.0f, input[i].x, input[i].y, input[i].z }), inverse);
+    maxError = std::max({ maxError, std::fabs(simd[i].x - r.x), std::fabs(simd[i].y - r.y),
+                          std::fabs(simd[i].z - r.z), std::fabs(simd[i].w - input[i].w) });
+  }
+  // 4 ULP de 174: con FMA (AVX2) el bloque redondea distinto que los productos escalares.
+  check.expectAtMost("rotate en bloque - escalar (|v| <= 174)", maxError, 6.0e-5);
+}
+
+// rotate y rotateUnit frente a la misma rotación en double.
+ALDAIR_CHECK(Quaternion, rotateUnit) {
+  constexpr size_t kCount = 1000000;
+  const std::vector<Vector4> input = makeVectors(kCount, 11);
+  std::vector<Vector4> rotated(kCount), rotatedUnit(kCount);
+  const Quaternion rotation(1.1f, Vector3(0.48f, 0.6f, 0.64f));
+  rotation.rotate(input.data(), rotated.data(), kCount);
+  rotation.rotateUnit(input.data(), rotatedUnit.data(), kCount);
+
+  const DoubleQuaternion unitRotation = normalizeDouble(rotation);
+  double rotateError = 0.0, rotateUnitError = 0.0;
+  for (size_t i = 0; i < kCount; ++i) {
+    double reference[3];
+    rotateDouble(unitRotation, input[i], reference);
+    rotateError = std::max({ rotateError, std::fabs(rotated[i].x - reference[0]),
+                             std::fabs(rotated[i].y - reference[1]), std::fabs(rotated[i].z - reference[2]) });
+    rotateUnitError = std::max({ rotateUnitError, std::fabs(rotatedUnit[i].x - reference[0]),
+                                 std::fabs(rotatedUnit[i].y - reference[1]),
+                                 std::fabs(rotatedUnit[i].z - reference[2]) });
+  }
+  check.expectAtMost("rotate - double (|v| <= 174)", rotateError, 6.0e-5);
+  check.expectAtMost("rotateUnit - double (|v| <= 174)", rotateUnitError, 6.0e-5);
+}
+
+// slerpBatch frente a slerp en double; la mitad de los pares casi coinciden.
+ALDAIR_CHECK(Quaternion, slerpBatch) {
+  constexpr size_t kCount = 1000000;
+  std::mt19937 generator(11);
+  std::normal_distribution<float> gaussian(0.0f, 1.0f);
+  std::uniform_real_distribution<float> randomT(0.0f, 1.0f);
+  auto randomQuaternion = [&]() {
+    return Quaternion(gaussian(generator), gaussian(generator), gaussian(generator), gaussian(generator));
+  };
+
+  std::vector<Quaternion> from(kCount), to(kCount), slerped(kCount), nlerped(kCount);
+  std::vector<float> t(kCount);
+  for (size_t i = 0; i < kCount; ++i) {
+    from[i] = randomQuaternion().normalize();
+    to[i] = i % 2 == 0 ? (from[i] + randomQuaternion() * 1.0e-3f).normalize() : randomQuaternion().normalize();
+    t[i] = randomT(generator);
+  }
+  const MathBatch::ConstQuaternionSpan fromSpan(from.data(), kCount);
+  const MathBatch::ConstQuaternionSpan toSpan(to.data(), kCount);
+  MathBatch::slerpBatch(fromSpan, toSpan, t.data(), { slerped.data(), kCount });
+  MathBatch::nlerpBatch(fromSpan, toSpan, t.data(), { nlerped.data(), kCount });
+
+  double slerpError = 0.0, normError = 0.0, nlerpDeviation = 0.0;
+  for (size_t i = 0; i < kCount; ++i) {
+    const DoubleQuaternion exact = slerpDouble(from[i], to[i], t[i]);
+    const Quaternion& q = slerped[i];
+    slerpError = std::max({ slerpError, std::fabs(q.w - exact.w), std::fabs(q.x - exact.x),
+                            std::fabs(q.y - exact.y), std::fabs(q.z - exact.z) });
+    normError = std::max(normError, static_cast<double>(std::fabs(1.0f - q.magnitude())));
+    const Quaternion difference = nlerped[i] - q;
+    nlerpDeviation = std::max({ nlerpDeviation, static_cast<double>(std::fabs(difference.w)),
+                                static_cast<double>(std::fabs(difference.x)),
+                                static_cast<double>(std::fabs(difference.y)),
+                                static_cast<double>(std::fabs(difference.z)) });
+  }
+  check.expectAtMost("slerpBatch - double", slerpError, 2.0e-6);
+  check.expectAtMost("|1 - |slerpBatch||", normError, 2.0e-6);
+  check.note("nlerpBatch - slerpBatch: %.3g (informativo)", nlerpDeviation);
+}
@@ -0,0 +1,77 @@
+// Casos de ResourceManager: búsquedas de texturas y regiones del atlas por nombre.
+// Necesita enlazar SFML (Texture guarda un sf::Texture), así que en Linux se compila
+// aparte del resto de suites; ver Benchmark.cpp.
+#include "Benchmark.h"
+#include "Window.h"
+#include "Services/ResourceManager.h"
+#include <iostream>
+
+namespace {
+  // Texturas registradas; potencia de 2 para recorrerlas con una máscara.
+  constexpr size_t kTextures = 64;
+  constexpr size_t kMask = kTextures - 1;
+
+  /**
+   * @brief Nombres con la forma de las rutas que usa BaseApp ("Carpeta/Archivo").
+   * La primera vez registra cada nombre en el ResourceManager y en el atlas. Los archivos
+   * no existen, así que se silencian los avisos de carga: solo se miden las búsquedas.
+   */
+  const std::vector<std::string>&
+  getNames() {
+    static const std::vector<std::string> names = [] {
+      std::vector<std::string> result;
+      std::streambuf* coutBuffer = std::cout.rdbuf(nullptr);
+      std::streambuf* errBuffer = sf::err().rdbuf(nullptr);
+
+      ResourceManager& resources = ResourceManager::getInstance();
+      sf::Image image;
+      image.create(16, 16, sf::Color::White);
+      for (size_t i = 0; i < kTextures; ++i) {
+        result.push_back("Benchmarks/Sprites/Texture_" + std::to_string(i));
+        resources.loadTexture(result.back(), "png");
+        resources.getAtlas().insert(result.back(), image);
+      }
+
+      sf::err().rdbuf(errBuffer);
+      std::cout.rdbuf(coutBuffer);
+      return result;
+    }();
+    return names;
+  }
+}
+
+ALDAIR_BENCHMARK(Resources, getTexture) {
+  const std::vector<std::string>& names = getNames();
+  ResourceManager& resources = ResourceManager::getInstance();
+  for (size_t i = 0; i < state.getIterations(); ++i) {
+    EngineUtilities::TSharedPointer<Texture> texture = resources.getTexture(names[i & kMask]);
+    Bench::doNotOptimize(texture.get());
+  }
+}
+
+ALDAIR_BENCHMARK(Resources, atlasContains) {
+  const std::vector<std::string>& names = getNames();
+  TextureAtlas& atlas = ResourceManager::getInstance().getAtlas();
+  for (size_t i = 0; i < state.getIterations(); ++i) {
+    Bench::doNotOptimize(atlas.contains(names[i & kMask]));
+  }
+}
+
+ALDAIR_BENCHMARK(Resources, atlasRegion) {
+  const std::vector<std::string>& names = getNames();
+  TextureAtlas& atlas = ResourceManager::getInstance().getAtlas();
+  for (size_t i = 0; i < state.getIterations(); ++i) {
+    AtlasRegion region = atlas.getRegion(names[i & kMask]);
+    Bench::doNotOptimize(region);
+  }
+}
+
+// Nombre que no está en el atlas: hash y cubeta vacía, sin comparar cadenas.
+ALDAIR_BENCHMARK(Resources, atlasContainsMissing) {
+  getNames();
+  const std::string missing = "Benchmarks/Sprites/Missing";
+  TextureAtlas& atlas = ResourceManager::getInstance().getAtlas();
+  for (size_t i = 0; i < state.getIterations(); ++i) {
+    Bench::doNotOptimize(atlas.contains(missing));
+  }
+}
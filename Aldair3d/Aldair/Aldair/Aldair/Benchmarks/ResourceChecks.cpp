@@ -0,0 +1,93 @@
+// Verificaciones de TextureAtlas: las regiones siguen siendo válidas después de
+// eliminar texturas y desfragmentar. Necesita enlazar SFML, igual que
+// ResourceBenchmarks.cpp; ver Benchmark.cpp.
+#include "Benchmark.h"
+#include "TextureAtlas.h"
+
+namespace {
+  constexpr unsigned int kPageSize = 64;
+  constexpr unsigned int kPadding = 1;
+  constexpr int kTextures = 40;
+
+  // Color único de la textura index para reconocer sus píxeles en la página.
+  sf::Color
+  getColor(int index) {
+    return sf::Color(static_cast<sf::Uint8>(10 + index * 6), static_cast<sf::Uint8>(250 - index * 6), 128);
+  }
+
+  std::string
+  getName(int index) {
+    return "Checks/Atlas_" + std::to_string(index);
+  }
+}
+
+/**
+ * @brief Llena varias páginas pequeñas, elimina la mitad de las texturas y desfragmenta.
+ * Cada región viva debe quedar dentro de su página, sin solaparse con otra y con los
+ * píxeles de su imagen; ninguna página puede quedar vacía.
+ */
+ALDAIR_CHECK(TextureAtlas, defragmentKeepsRegions) {
+  TextureAtlas atlas(kPageSize, kPadding);
+  for (int i = 0; i < kTextures; ++i) {
+    sf::Image image;
+    image.create(8 + (i * 7) % 13, 6 + (i * 5) % 11, getColor(i));
+    check.expect(atlas.insert(getName(i), image), "no cupo %s", getName(i).c_str());
+  }
+  const size_t pagesBefore = atlas.getPageCount();
+  check.note("%zu texturas en %zu páginas de %u px", atlas.getEntryCount(), pagesBefore, kPageSize);
+
+  for (int i = 0; i < kTextures; i += 2) {
+    atlas.remove(getName(i));
+  }
+  check.expect(atlas.getFragmentation() > 0.0f, "eliminar no dejó espacio desperdiciado");
+
+  const unsigned int versionBefore = atlas.getVersion();
+  check.expect(atlas.defragment(), "defragment falló");
+  check.expect(atlas.getVersion() != versionBefore, "defragment no cambió la versión");
+  check.expect(atlas.getFragmentation() < 1.0e-6f, "fragmentación %.3f tras desfragmentar", atlas.getFragmentation());
+  check.expect(atlas.getPageCount() <= pagesBefore, "%zu páginas tras desfragmentar (antes %zu)",
+               atlas.getPageCount(), pagesBefore);
+  check.expect(!atlas.defragmentIfNeeded(), "defragmentIfNeeded sin espacio desperdiciado");
+
+  std::vector<sf::Image> pages;
+  for (size_t page = 0; page < atlas.getPageCount(); ++page) {
+    pages.push_back(atlas.getPageTexture(static_cast<int>(page))->copyToImage());
+  }
+  std::vector<bool> usedPages(atlas.getPageCount(), false);
+  std::vector<AtlasRegion> regions;
+  for (int i = 0; i < kTextures; ++i) {
+    const AtlasRegion region = atlas.getRegion(getName(i));
+    if (i % 2 == 0) {
+      check.expect(!region.isValid() && !atlas.contains(getName(i)), "%s sigue en el atlas", getName(i).c_str());
+      continue;
+    }
+    if (!check.expect(region.isValid() && region.page < static_cast<int>(atlas.getPageCount()),
+                      "%s: página %d inválida", getName(i).c_str(), region.page)) {
+      continue;
+    }
+    const sf::IntRect& rect = region.rect;
+    if (!check.expect(rect.left >= 0 && rect.top >= 0 && rect.left + rect.width <= static_cast<int>(kPageSize) &&
+                      rect.top + rect.height <= static_cast<int>(kPageSize),
+                      "%s: rectángulo fuera de la página", getName(i).c_str())) {
+      continue;
+    }
+    usedPages[region.page] = true;
+    for (const AtlasRegion& other : regions) {
+      check.expect(other.page != region.page || !other.rect.intersects(rect), "%s se solapa con otra región",
+                   getName(i).c_str());
+    }
+    regions.push_back(region);
+
+    // Los píxeles copiados a la página nueva son los de la imagen original.
+    size_t wrongPixels = 0;
+    for (int y = rect.top; y < rect.top + rect.height; ++y) {
+      for (int x = rect.left; x < rect.left + rect.width; ++x) {
+        wrongPixels += pages[region.page].getPixel(x, y) != getColor(i) ? 1 : 0;
+      }
+    }
+    check.expect(wrongPixels == 0, "%s: %zu píxeles distintos tras desfragmentar", getName(i).c_str(), wrongPixels);
+  }
+  for (size_t page = 0; page < usedPages.size(); ++page) {
+    check.expect(usedPages[page], "la página %zu quedó vacía", page);
+  }
+}
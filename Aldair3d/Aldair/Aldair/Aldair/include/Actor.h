@@ -3,6 +3,8 @@
 #include "Entity.h"
 #include "ShapeFactory.h"
 #include "Transform.h"
+#include "ParticleEmitter.h"
+#include "Tilemap.h"
 
 class
 Actor : Entity {
@@ -16,6 +18,9 @@ Actor(std::string actorName);
   virtual
   ~Actor() = default;
 
+  // Permite agregar componentes opcionales (por ejemplo un ParticleEmitter).
+  using Entity::addComponent;
+
   /*
   * @brief Actualiza al actor.
   * @param deltaTime El tiempo transcurrrido desde la ultima actualizacion.
@@ -42,6 +47,52 @@ Actor(std::string actorName);
   void
   setName(const std::string& newName);
 
+ /**
+  * @brief Marca al actor como estático (inmóvil).
+  * La geometría de los actores estáticos se hornea en buffers de GPU y no se
+  * sincroniza con su Transform cada frame.
+  */
+  void
+  setStatic(bool isStatic);
+
+  // Indica si el actor es estático.
+  bool
+  isStatic() const { return m_isStatic; }
+
+  // Indica que un actor estático cambió y su geometría debe volver a hornearse.
+  void
+  markDirty() { m_staticDirty = true; }
+
+ /**
+  * @brief Consume el aviso de cambio de la geometría estática.
+  * @return `true` si la geometría horneada del actor quedó desactualizada.
+  */
+  bool
+  consumeStaticChange();
+
+  // Establece la capa del actor (las capas bajas se dibujan primero).
+  void
+  setLayer(uint8_t layer);
+
+  // Obtiene la capa del actor.
+  uint8_t
+  getLayer() const { return m_layer; }
+
+  // Establece el orden de dibujo dentro de la capa (los valores bajos se dibujan primero).
+  void
+  setZOrder(int16_t zOrder);
+
+  // Obtiene el orden de dibujo dentro de la capa.
+  int16_t
+  getZOrder() const { return m_zOrder; }
+
+ /**
+  * @brief Indica si el actor cambió algo visible desde el último frame y limpia el aviso.
+  * Considera la capa, el orden de dibujo y los cambios de su forma.
+  */
+  bool
+  consumeRenderChange();
+
  /**
   * @brief Obtiene un componente espec�fico del actor.
   * @tparam T Tipo del componente que se va a obtener.
@@ -53,6 +104,11 @@ Actor(std::string actorName);
 
 private:
   std::string m_name = "Actor";
+  bool m_isStatic = false; // El actor no se mueve y su geometría se hornea.
+  bool m_staticDirty = false; // La geometría horneada debe reconstruirse.
+  uint8_t m_layer = 0; // Capa de render del actor.
+  int16_t m_zOrder = 0; // Orden de dibujo dentro de la capa.
+  bool m_orderChanged = false; // La capa o el orden cambiaron desde el último frame.
 };
 
 /*
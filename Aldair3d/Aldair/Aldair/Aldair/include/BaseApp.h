@@ -4,6 +4,17 @@
 #include "ShapeFactory.h"
 #include "Actor.h"
 #include "GUI.h"
+#include "StaticBatch.h"
+#include "SpatialGrid.h"
+#include "RenderQueue.h"
+#include "RenderBatcher.h"
+#include "BenchmarkScene.h"
+#include "DynamicResolution.h"
+#include "SceneSnapshot.h"
+#include "SimulationThread.h"
+#include "TripleBuffer.h"
+#include "FrameCapture.h"
+#include <mutex>
 #include "Services/NotificationSystem.h"
 #include "Services/ResourceManager.h"
 
@@ -17,6 +28,17 @@ public:
   int
   run();
 
+  /**
+   * @brief Configura una ejecucion sin interfaz para pruebas de regresion visual.
+   * La ventana se oculta, se usa el modo juego con resolucion completa y la simulacion
+   * avanza en el hilo principal con un paso fijo, de modo que dos ejecuciones producen
+   * los mismos frames. Se graban frames frames y la aplicacion termina.
+   * @param settings Configuracion de la grabacion.
+   * @param frames Frames a grabar.
+   */
+  void
+  setHeadless(const CaptureSettings& settings, unsigned int frames);
+
   // Funcion de inicializacion.
   bool
   initialize();
@@ -29,6 +51,10 @@ public:
   void
   render();
 
+  // Dibuja los mapas, el pase estatico y la instantanea en el destino activo.
+  void
+  renderScene(const SceneSnapshot& snapshot);
+
   // Libera los recursos utilizados por la aplicacin.
   void
   cleanup();
@@ -42,10 +68,59 @@ public:
   updateMovement(float deltaTime, EngineUtilities::TSharedPointer<Actor> circle);
 
 private:
+  // Pasos de simulacion por segundo del hilo de simulacion.
+  static constexpr float kSimulationRate = 120.0f;
+
+  // Paso fijo de la simulacion en modo sin interfaz.
+  static constexpr float kHeadlessStep = 1.0f / 60.0f;
+
+  // Inicia o detiene la grabacion de frames con la configuracion actual.
+  void
+  toggleCapture();
+
+  // Inicia o detiene el hilo de simulacion.
+  void
+  setThreadedSimulation(bool threaded);
+
+  // Paso del hilo de simulacion: toma el mundo, simula y publica.
+  void
+  simulationStep(float deltaTime);
+
+  // Avanza actores, movimiento, particulas e indice espacial (con el mundo tomado).
+  void
+  simulate(float deltaTime);
+
+  // Publica la instantanea de render de lo visible (con el mundo tomado).
+  void
+  publishSnapshot();
+
+  // Toma el mundo desde el hilo principal y suma la espera al frame.
+  std::unique_lock<std::mutex>
+  lockWorld();
+
+  // Inicializa los actores principales de la escena.
+  bool
+  initializeActors(ResourceManager& resourceManager, NotificationService& notifier);
+
+  // Configura un actor con forma, escala y textura.
+  bool
+  initializeActor(const std::string& name, ShapeType shapeType,
+                  const Vector2& scale, const std::string& textureId,
+                  ResourceManager& resourceManager,
+                  NotificationService& notifier,
+                  bool isStatic = false);
+
+  // Crea un actor con un mapa de tiles; devuelve false si el archivo no existe.
+  bool
+  initializeTilemap(const std::string& name, const std::string& mapFile,
+                    const std::string& tilesetId, unsigned int tilePixels,
+                    ResourceManager& resourceManager,
+                    NotificationService& notifier);
+
   sf::Clock clock;
   sf::Time deltaTime;
 
-  Window* m_window; // Puntero a la ventana donde se dibujan los elementos
+  Window* m_window = nullptr; // Puntero a la ventana donde se dibujan los elementos
   EngineUtilities::TSharedPointer<Actor> Triangle;
   EngineUtilities::TSharedPointer<Actor> Circle;
   EngineUtilities::TSharedPointer<Actor> Track;
@@ -53,8 +128,13 @@ private:
   // Lista de actores en la escena
   std::vector< EngineUtilities::TSharedPointer<Actor>> m_actors;
 
-  //Array para la actividad de los puntos
-  Vector2 points[9];
+  // Puntos de recorrido del actor "Player", guardados en el ejecutable.
+  static constexpr Vector2 kWaypoints[] = {
+    Vector2(720.0f, 350.0f), Vector2(720.0f, 260.0f), Vector2(125.0f, 50.0f),
+    Vector2(70.0f, 120.0f), Vector2(70.0f, 450.0f), Vector2(400.0f, 350.0f),
+    Vector2(550.0f, 500.0f), Vector2(650.0f, 550.0f), Vector2(720.0f, 450.0f)
+  };
+  static constexpr int kWaypointCount = static_cast<int>(sizeof(kWaypoints) / sizeof(kWaypoints[0]));
   int m_currentPoint = 0;
   int m_currentActor = 0;
 
@@ -64,4 +144,70 @@ private:
 
   // Interfaz grafica de usuario
   GUI m_GUI;
+
+  // Geometria horneada de los actores estaticos
+  StaticBatch m_staticBatch;
+
+  // Indice espacial de los AABB de los actores (el id es su indice en m_actors)
+  SpatialGrid m_spatialGrid;
+
+  // Actores visibles en el ultimo paso, resultado de consultar el indice (simulacion)
+  std::vector<uint32_t> m_visibleActors;
+
+  // Cola de comandos ordenada por llave y batcher que fusiona los comandos
+  RenderQueue m_renderQueue;
+  RenderBatcher m_batcher;
+
+  // Actores con un Tilemap; se dibujan como fondo antes que los demas actores
+  std::vector<EngineUtilities::TSharedPointer<Actor>> m_tilemapActors;
+
+  // Actores con un ParticleEmitter; BaseApp los simula y los dibuja aparte
+  std::vector<EngineUtilities::TSharedPointer<Actor>> m_emitterActors;
+
+  // Escena de prueba de rendimiento del render
+  BenchmarkScene m_benchmark;
+
+  // Tiempo de frame de cada modo y modo con el que se dibujo el ultimo frame
+  FrameTimes m_frameTimes;
+  bool m_renderedGameMode = false;
+
+  // Escala de resolucion de la escena segun el tiempo de frame
+  DynamicResolution m_resolution;
+
+  // La escena cambio desde el ultimo frame dibujado en la RenderTexture
+  bool m_sceneDirty = true;
+
+  // Escala con la que se eligieron los niveles de detalle de las formas estaticas
+  float m_lodPixelsPerUnit = 0.0f;
+
+  // Simulacion desacoplada. Los actores, el indice espacial y la escena de prueba
+  // pertenecen al "mundo": solo se tocan con m_worldMutex tomado. El render solo lee
+  // la instantanea del triple buffer.
+  SimulationThread m_simulation;
+  std::mutex m_worldMutex;
+  TripleBuffer<SceneSnapshot> m_snapshots;
+  SimulationStats m_simulationStats;
+  float m_frameWaitMs = 0.0f; // Espera por el mundo acumulada en el frame actual
+
+  // Vista y escala que el hilo principal envia a la simulacion (m_viewMutex)
+  std::mutex m_viewMutex;
+  sf::FloatRect m_simulationView;
+  float m_simulationPixelsPerUnit = 1.0f;
+
+  // Estado propio de la simulacion
+  size_t m_lastActorCount = 0;
+  uint64_t m_sceneVersion = 0;
+  uint64_t m_simulationSteps = 0;
+  float m_simulationWaitMs = 0.0f;
+  std::atomic<bool> m_staticChanged{ false }; // Un actor estatico cambio; hornear de nuevo
+
+  // Ultima instantanea dibujada
+  uint64_t m_renderedSceneVersion = 0;
+  uint64_t m_renderedStep = 0;
+
+  // Grabacion de frames y ejecucion sin interfaz
+  FrameCapture m_capture;
+  bool m_headless = false;
+  unsigned int m_headlessFrames = 0;
+  unsigned int m_renderedFrames = 0;
 };
\ No newline at end of file
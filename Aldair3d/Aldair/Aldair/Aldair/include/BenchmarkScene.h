@@ -0,0 +1,337 @@
+#pragma once
+#include "Prerequisites.h"
+#include "Actor.h"
+#include "RenderQueue.h"
+#include "RenderBatcher.h"
+
+/**
+ * @brief Escena de prueba de rendimiento del render.
+ * Genera muchas formas pequeñas que rebotan dentro de un área y mide cómo escala
+ * la fase paralela de construcción de vértices con el número de hilos.
+ */
+class
+BenchmarkScene {
+public:
+  // Muestra de la medición de escalamiento.
+  struct
+  ScalingSample {
+    size_t threads = 1;  // Hilos usados en la fase build.
+    float buildMs = 0.0f; // Tiempo promedio de la fase build.
+  };
+
+  // Medición del mapa de tiles con un nivel de zoom.
+  struct
+  TilemapSample {
+    float zoom = 1.0f;         // Tamaño de la vista respecto a la ventana.
+    size_t visibleChunks = 0;  // Chunks que pasaron el culling.
+    size_t vertices = 0;       // Vértices de los chunks visibles.
+    float buildMs = 0.0f;      // Primera preparación (construye los chunks).
+    float cullMs = 0.0f;       // Preparación sin cambios (solo culling).
+  };
+
+  // Resultado de la prueba del mapa de tiles.
+  struct
+  TilemapResults {
+    unsigned int size = 0;       // Lado del mapa en tiles.
+    size_t chunks = 0;           // Chunks del mapa.
+    float fillMs = 0.0f;         // Llenado de todos los tiles.
+    float editMs = 0.0f;         // Preparación después de editar tiles visibles.
+    size_t editedChunks = 0;     // Chunks reconstruidos por la edición.
+    std::vector<TilemapSample> samples;
+  };
+
+  // Medición del nivel de detalle de los círculos con un nivel de zoom.
+  struct
+  LevelOfDetailSample {
+    float zoom = 1.0f;          // Píxeles por unidad de mundo.
+    size_t vertices = 0;        // Vértices con nivel de detalle.
+    size_t fixedVertices = 0;   // Vértices con 30 lados fijos, como sf::CircleShape.
+    size_t switches = 0;        // Formas que cambiaron de nivel al llegar a este zoom.
+    size_t jitterSwitches = 0;  // Cambios al oscilar el zoom ±5% alrededor de este valor.
+    float selectMs = 0.0f;      // Elección del nivel de todas las formas.
+    float buildMs = 0.0f;       // Generación de vértices de todas las formas.
+  };
+
+  // Resultado de la prueba del nivel de detalle.
+  struct
+  LevelOfDetailResults {
+    size_t shapes = 0;
+    std::vector<LevelOfDetailSample> samples;
+  };
+
+  // Resultado de la prueba de partículas sin render.
+  struct
+  ParticleResults {
+    size_t particles = 0;    // Partículas vivas simuladas.
+    size_t threads = 1;      // Hilos usados en la versión paralela.
+    float scalarMs = 0.0f;   // Kernel escalar, un núcleo.
+    float simdMs = 0.0f;     // Kernel SIMD, un núcleo.
+    float parallelMs = 0.0f; // Kernel SIMD repartido con parallelFor.
+  };
+
+  // Velocidad de una función de MathEngine.
+  struct
+  MathSample {
+    const char* name = "";  // Función medida.
+    const char* domain = ""; // Intervalo de las entradas.
+    float engineNs = 0.0f;   // Tiempo por llamada de MathEngine.
+    float stdNs = 0.0f;      // Tiempo por llamada de la función de std.
+  };
+
+  // Resultado de la rotación en bloque con un cuaternión.
+  struct
+  RotationResults {
+    size_t vectors = 0;           // Vectores rotados.
+    const char* instructionSet = ""; // Ruta SIMD con la que se compiló.
+    float scalarMs = 0.0f;        // Producto de Hamilton componente por componente.
+    float simdMs = 0.0f;          // Quaternion::rotate en bloque.
+  };
+
+  // Resultado de la prueba de rotación e interpolación de cuaterniones unitarios.
+  struct
+  QuaternionResults {
+    size_t vectors = 0;            // Vectores rotados y pares interpolados.
+    float rotateMs = 0.0f;         // Quaternion::rotate en bloque (calcula el inverso).
+    float rotateUnitMs = 0.0f;     // Quaternion::rotateUnit en bloque.
+    float stdSlerpMs = 0.0f;       // slerp con std::acos y std::sin, elemento por elemento.
+    float slerpBatchMs = 0.0f;     // MathBatch::slerpBatch.
+    float nlerpBatchMs = 0.0f;     // MathBatch::nlerpBatch.
+  };
+
+  // Velocidad de un generador de números aleatorios.
+  struct
+  RandomSample {
+    const char* name = "";
+    float ms = 0.0f;           // Tiempo total.
+    float numbersPerNs = 0.0f; // Números (o vectores) generados por nanosegundo.
+  };
+
+  // Resultado de la prueba de números aleatorios.
+  struct
+  RandomResults {
+    size_t numbers = 0;              // Números generados por cada generador.
+    const char* instructionSet = ""; // Ruta SIMD de los llenados en bloque.
+    std::vector<RandomSample> samples;
+  };
+
+  // Tiempo de un kernel de MathBatch con cada conjunto de instrucciones.
+  struct
+  BatchSample {
+    const char* name = "";
+    float scalarMs = 0.0f;
+    float sse2Ms = 0.0f;
+    float avx2Ms = 0.0f; // 0 si el procesador no soporta AVX2.
+  };
+
+  // Resultado de la prueba de MathBatch.
+  struct
+  BatchResults {
+    size_t agents = 0;                // Elementos de cada arreglo.
+    const char* supported = "";       // Mejor conjunto de instrucciones del procesador.
+    float transformSeekMs = 0.0f;     // Transform::Seek llamado una vez por agente.
+    std::vector<BatchSample> samples;
+  };
+
+  // Tiempo de una prueba geométrica en bloque con cada conjunto de instrucciones.
+  struct
+  GeometrySample {
+    const char* name = "";
+    float scalarMs = 0.0f;
+    float sse2Ms = 0.0f;
+    float avx2Ms = 0.0f; // 0 si el procesador no soporta AVX2.
+  };
+
+  // Resultado de la prueba de las primitivas geométricas.
+  struct
+  GeometryResults {
+    size_t elements = 0;        // Elementos por ronda y conjunto de instrucciones.
+    size_t rounds = 0;          // Rondas con datos aleatorios distintos.
+    const char* supported = ""; // Mejor conjunto de instrucciones del procesador.
+    std::vector<GeometrySample> samples;
+  };
+
+  BenchmarkScene() = default;
+  ~BenchmarkScene() = default;
+
+ /**
+  * @brief Agrega formas en movimiento a la escena.
+  * @param actors Lista de actores de la escena.
+  * @param count Número de formas a generar.
+  * @param area Área dentro de la cual se mueven las formas.
+  */
+  void
+  spawn(std::vector<EngineUtilities::TSharedPointer<Actor>>& actors,
+        size_t count,
+        const sf::FloatRect& area);
+
+  // Mueve las formas de la escena de prueba rebotando en los bordes del área.
+  void
+  update(float deltaTime);
+
+ /**
+  * @brief Mide la fase build con 1..N hilos.
+  * Repite la construcción de los lotes varias veces por cada número de hilos y
+  * guarda el promedio. Al terminar restaura el número de hilos original.
+  */
+  void
+  measureScaling(RenderBatcher& batcher,
+                 const RenderQueue& queue,
+                 const std::vector<RenderProxy>& items);
+
+  /**
+   * @brief Simula count partículas sin dibujarlas y mide cada kernel.
+   * Mide el kernel escalar y el SIMD en un núcleo y el SIMD en todos los hilos.
+   */
+  void
+  measureParticles(size_t count);
+
+  /**
+   * @brief Mide un mapa de tiles de size x size con varios niveles de zoom.
+   * Mide el llenado, la construcción y el culling de los chunks visibles y la
+   * reconstrucción después de editar tiles dentro de la vista.
+   * @param view Vista de referencia (zoom 1).
+   */
+  void
+  measureTilemap(unsigned int size, const sf::FloatRect& view);
+
+  /**
+   * @brief Mide el nivel de detalle de count círculos con varios niveles de zoom.
+   * Los círculos tienen escalas aleatorias; por cada zoom mide la elección de nivel,
+   * los vértices generados frente a 30 lados fijos y los cambios de nivel cuando el
+   * zoom oscila un poco, que la histéresis debe mantener cerca de cero.
+   */
+  void
+  measureLevelOfDetail(size_t count);
+
+  /**
+   * @brief Microbenchmark de MathEngine contra std.
+   * Mide el tiempo por llamada de ambas versiones sobre las mismas entradas. Los
+   * contratos de precisión los verifica Aldair3dBench --check.
+   */
+  void
+  measureMath();
+
+  /**
+   * @brief Rota count vectores con un cuaternión y mide la versión escalar y la SIMD.
+   * La versión escalar hace los mismos productos de Hamilton una componente a la vez,
+   * como lo hacía Quaternion antes de tener rutas SIMD.
+   */
+  void
+  measureRotation(size_t count);
+
+  /**
+   * @brief Rota e interpola count cuaterniones unitarios y mide el tiempo.
+   * Compara rotate contra rotateUnit y slerpBatch/nlerpBatch contra un slerp con las
+   * funciones de std.
+   */
+  void
+  measureQuaternion(size_t count);
+
+  /**
+   * @brief Mide el rendimiento de Random contra rand() y std::mt19937.
+   * Genera count floats uniformes con cada generador y con los llenados en bloque de
+   * Random (uniformes, en un intervalo y vectores unitarios) y reporta números por
+   * nanosegundo.
+   */
+  void
+  measureRandom(size_t count);
+
+  /**
+   * @brief Mide los kernels de MathBatch con count agentes.
+   * Compara Transform::Seek agente por agente contra seekBatch y mide cada kernel con
+   * los kernels escalares, SSE2 y AVX2. Al terminar restaura el conjunto detectado.
+   */
+  void
+  measureBatch(size_t count);
+
+  /**
+   * @brief Mide las pruebas geométricas en bloque de MathBatch.
+   * En cada ronda genera count cajas, círculos y puntos y un polígono cóncavo nuevos y
+   * mide overlapAABBBatch, raycastCirclesBatch y pointsInPolygonBatch con los kernels
+   * escalares, SSE2 y AVX2. La comparación con Geometry.h la hace Aldair3dBench --check.
+   */
+  void
+  measureGeometry(size_t count);
+
+  // Resultados de la última prueba de MathBatch.
+  const BatchResults&
+  getBatchResults() const { return m_batchResults; }
+
+  // Resultados de la última prueba geométrica.
+  const GeometryResults&
+  getGeometryResults() const { return m_geometryResults; }
+
+  // Resultados de la última prueba de números aleatorios.
+  const RandomResults&
+  getRandomResults() const { return m_randomResults; }
+
+  // Resultados de la última prueba de cuaterniones unitarios.
+  const QuaternionResults&
+  getQuaternionResults() const { return m_quaternionResults; }
+
+  // Resultados de la última prueba de rotación.
+  const RotationResults&
+  getRotationResults() const { return m_rotationResults; }
+
+  // Resultados de la última prueba de MathEngine.
+  const std::vector<MathSample>&
+  getMathResults() const { return m_mathResults; }
+
+  // Resultados de la última prueba del nivel de detalle.
+  const LevelOfDetailResults&
+  getLevelOfDetailResults() const { return m_lodResults; }
+
+  // Resultados de la última prueba del mapa de tiles.
+  const TilemapResults&
+  getTilemapResults() const { return m_tilemapResults; }
+
+  // Resultados de la última prueba de partículas.
+  const ParticleResults&
+  getParticleResults() const { return m_particleResults; }
+
+  // Número de formas generadas por la escena de prueba.
+  size_t
+  getShapeCount() const { return m_transforms.size(); }
+
+  // Tiempo del último spawn, en milisegundos.
+  float
+  getSpawnMs() const { return m_spawnMs; }
+
+  // Formas creadas en el último spawn.
+  size_t
+  getSpawnCount() const { return m_spawnCount; }
+
+  // Resultados de la última medición de escalamiento.
+  const std::vector<ScalingSample>&
+  getScalingResults() const { return m_scalingResults; }
+
+  // Solicitudes hechas desde la interfaz; BaseApp las atiende en el siguiente frame.
+  bool spawnRequested = false;
+  bool scalingRequested = false;
+  bool particlesRequested = false;
+  bool tilemapRequested = false;
+  bool lodRequested = false;
+  bool mathRequested = false;
+  bool rotationRequested = false;
+  bool batchRequested = false;
+  bool quaternionRequested = false;
+  bool randomRequested = false;
+  bool geometryRequested = false;
+
+private:
+  sf::FloatRect m_area;
+  std::vector<Transform*> m_transforms; // Los actores de la escena mantienen vivos los componentes.
+  std::vector<Vector2> m_velocities;
+  std::vector<ScalingSample> m_scalingResults;
+  ParticleResults m_particleResults;
+  TilemapResults m_tilemapResults;
+  LevelOfDetailResults m_lodResults;
+  std::vector<MathSample> m_mathResults;
+  RotationResults m_rotationResults;
+  BatchResults m_batchResults;
+  QuaternionResults m_quaternionResults;
+  RandomResults m_randomResults;
+  GeometryResults m_geometryResults;
+  float m_spawnMs = 0.0f;
+  size_t m_spawnCount = 0;
+};
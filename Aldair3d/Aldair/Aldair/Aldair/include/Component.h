@@ -11,7 +11,9 @@ ComponentType {
 	PHYSICS = 4,
 	AUDIOSOURCE = 5,
 	SHAPE = 6,
-	TEXTURE = 7
+	TEXTURE = 7,
+	PARTICLES = 8,
+	TILEMAP = 9
 };
 
 /**
@@ -0,0 +1,99 @@
+#pragma once
+#include "Prerequisites.h"
+
+/**
+ * @brief Controlador de resolución dinámica.
+ * Ajusta la escala con la que se dibuja la escena según el tiempo de frame medido.
+ * Si el promedio supera el objetivo durante varios frames seguidos la escala baja un
+ * paso; si queda claramente por debajo durante más tiempo, sube un paso. La banda
+ * muerta entre ambos umbrales y la diferencia en la cantidad de frames requeridos
+ * evitan que la escala oscile.
+ */
+class
+DynamicResolution {
+public:
+  /**
+   * @brief Constructor del controlador.
+   * @param targetMs Tiempo de frame objetivo en milisegundos.
+   * @param minScale Escala mínima permitida.
+   * @param maxScale Escala máxima permitida.
+   */
+  DynamicResolution(float targetMs = 16.67f, float minScale = 0.5f, float maxScale = 1.0f);
+
+  ~DynamicResolution() = default;
+
+  /**
+   * @brief Registra el tiempo de un frame y ajusta la escala si corresponde.
+   * @param frameMs Tiempo del último frame en milisegundos.
+   * @return `true` si la escala cambió.
+   */
+  bool
+  update(float frameMs);
+
+  // Escala actual de la resolución de la escena.
+  float
+  getScale() const { return m_scale; }
+
+  // Establece el tiempo de frame objetivo en milisegundos.
+  void
+  setTargetMs(float targetMs) { m_targetMs = targetMs; }
+
+  // Obtiene el tiempo de frame objetivo en milisegundos.
+  float
+  getTargetMs() const { return m_targetMs; }
+
+  // Establece los límites de la escala y recorta la escala actual a ellos.
+  void
+  setScaleRange(float minScale, float maxScale);
+
+  float
+  getMinScale() const { return m_minScale; }
+
+  float
+  getMaxScale() const { return m_maxScale; }
+
+  // Activa o desactiva el ajuste; desactivado la escala vuelve al máximo.
+  void
+  setEnabled(bool enabled);
+
+  bool
+  isEnabled() const { return m_enabled; }
+
+  // Promedio móvil del tiempo de frame.
+  float
+  getAverageMs() const { return m_averageMs; }
+
+  // Historial circular de tiempos de frame, listo para ImGui::PlotLines.
+  const float*
+  getHistory() const { return m_history.data(); }
+
+  size_t
+  getHistorySize() const { return m_history.size(); }
+
+  // Índice del valor más antiguo del historial.
+  size_t
+  getHistoryOffset() const { return m_historyOffset; }
+
+private:
+  // Cambia la escala un paso y reinicia los contadores.
+  bool
+  applyScale(float scale);
+
+  static constexpr float kScaleStep = 0.05f;      // Incremento de escala por ajuste.
+  static constexpr float kOverBudget = 1.05f;     // Fracción del objetivo que baja la escala.
+  static constexpr float kUnderBudget = 0.80f;    // Fracción del objetivo que sube la escala.
+  static constexpr int kFramesToDecrease = 10;    // Frames seguidos sobre el objetivo.
+  static constexpr int kFramesToIncrease = 60;    // Frames seguidos bajo el objetivo.
+
+  float m_targetMs;
+  float m_minScale;
+  float m_maxScale;
+  float m_scale;
+  float m_averageMs = 0.0f;
+  int m_overBudgetFrames = 0;
+  int m_underBudgetFrames = 0;
+  bool m_enabled = true;
+
+  std::array<float, 120> m_history{};
+  size_t m_historyOffset = 0;
+};
@@ -0,0 +1,261 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * @brief Escalar de punto fijo Q16.16 para la simulación determinista (lockstep).
+ * Guarda el valor en un entero de 32 bits con 16 bits de fracción: resolución 1/65536
+ * e intervalo [-32768, 32768). Todas las operaciones son aritmética entera, así que dan
+ * los mismos bits con cualquier compilador, bandera de optimización o procesador, cosa
+ * que float no garantiza. La suma y la resta dan la vuelta al desbordarse; la
+ * multiplicación usa 64 bits intermedios y redondea al más cercano, y la división trunca
+ * hacia cero (dividir entre 0 devuelve 0, como Vector2).
+ */
+class Fixed32 {
+public:
+
+    // Bits de la parte fraccionaria.
+    static constexpr int kFractionBits = 16;
+
+    // Valor crudo de 1.0.
+    static constexpr int32_t kOneRaw = 1 << kFractionBits;
+
+    // Valor crudo: value * 65536.
+    int32_t raw;
+
+    /**
+     * @brief Constructor por defecto.
+     * Inicializa el valor en 0.
+    */
+    constexpr Fixed32() : raw(0) {}
+
+    // Construye desde el valor crudo Q16.16.
+    static constexpr Fixed32 fromRaw(int32_t raw) {
+        Fixed32 result;
+        result.raw = raw;
+        return result;
+    }
+
+    // Construye desde un entero; fuera de [-32768, 32767] da la vuelta.
+    static constexpr Fixed32 fromInt(int value) {
+        return fromRaw(static_cast<int32_t>(static_cast<uint32_t>(value) << kFractionBits));
+    }
+
+    // numerator / denominator redondeado al más cercano, sin pasar por float.
+    static constexpr Fixed32 fromRatio(int64_t numerator, int64_t denominator) {
+        if (denominator == 0) {
+            return Fixed32();
+        }
+        const int64_t scaled = numerator * kOneRaw;
+        const int64_t half = (denominator > 0 ? denominator : -denominator) / 2;
+        return fromRaw(static_cast<int32_t>(((scaled < 0) == (denominator < 0) ? scaled + half : scaled - half) / denominator));
+    }
+
+    /**
+     * @brief Convierte desde float redondeando al más cercano.
+     * Es determinista solo si value lo es: sirve para constantes y datos cargados, no
+     * para resultados de cálculos en float.
+    */
+    static constexpr Fixed32 fromFloat(float value) {
+        const float scaled = value * static_cast<float>(kOneRaw);
+        return fromRaw(static_cast<int32_t>(scaled >= 0.0f ? scaled + 0.5f : scaled - 0.5f));
+    }
+
+    // Convierte a float (para el render y la interfaz).
+    constexpr float toFloat() const {
+        return static_cast<float>(raw) * (1.0f / static_cast<float>(kOneRaw));
+    }
+
+    // Parte entera redondeada hacia abajo.
+    constexpr int toInt() const {
+        return raw >> kFractionBits;
+    }
+
+    // Sobrecarga del operador para la suma de 2 escalares.
+    constexpr Fixed32 operator+(Fixed32 other) const {
+        return fromRaw(static_cast<int32_t>(static_cast<uint32_t>(raw) + static_cast<uint32_t>(other.raw)));
+    }
+
+    // Sobrecarga del operador para la resta de 2 escalares.
+    constexpr Fixed32 operator-(Fixed32 other) const {
+        return fromRaw(static_cast<int32_t>(static_cast<uint32_t>(raw) - static_cast<uint32_t>(other.raw)));
+    }
+
+    // Sobrecarga del operador de negación.
+    constexpr Fixed32 operator-() const {
+        return fromRaw(static_cast<int32_t>(0u - static_cast<uint32_t>(raw)));
+    }
+
+    // Producto con 64 bits intermedios, redondeado al más cercano.
+    constexpr Fixed32 operator*(Fixed32 other) const {
+        const int64_t product = static_cast<int64_t>(raw) * other.raw;
+        return fromRaw(static_cast<int32_t>((product + (int64_t(1) << (kFractionBits - 1))) >> kFractionBits));
+    }
+
+    // Cociente con 64 bits intermedios, truncado hacia cero; entre 0 devuelve 0.
+    constexpr Fixed32 operator/(Fixed32 other) const {
+        if (other.raw == 0) {
+            return Fixed32();
+        }
+        return fromRaw(static_cast<int32_t>(static_cast<int64_t>(raw) * kOneRaw / other.raw));
+    }
+
+    constexpr Fixed32& operator+=(Fixed32 other) {
+        return *this = *this + other;
+    }
+
+    constexpr Fixed32& operator-=(Fixed32 other) {
+        return *this = *this - other;
+    }
+
+    constexpr Fixed32& operator*=(Fixed32 other) {
+        return *this = *this * other;
+    }
+
+    constexpr Fixed32& operator/=(Fixed32 other) {
+        return *this = *this / other;
+    }
+
+    constexpr bool operator==(Fixed32 other) const { return raw == other.raw; }
+    constexpr bool operator!=(Fixed32 other) const { return raw != other.raw; }
+    constexpr bool operator<(Fixed32 other) const { return raw < other.raw; }
+    constexpr bool operator<=(Fixed32 other) const { return raw <= other.raw; }
+    constexpr bool operator>(Fixed32 other) const { return raw > other.raw; }
+    constexpr bool operator>=(Fixed32 other) const { return raw >= other.raw; }
+};
+
+/**
+ * @brief Raíz cuadrada y trigonometría deterministas para Fixed32.
+ * sqrt es exacta (raíz entera redondeada al más cercano). sin y cos interpolan una
+ * tabla de un cuarto de onda de 256 segmentos que se genera en tiempo de compilación
+ * con aritmética entera, así que tampoco depende del float del compilador. El error de
+ * sin y cos es de unas 2 unidades de 1/65536.
+ */
+namespace FixedMath {
+    constexpr Fixed32 PI = Fixed32::fromRaw(205887);
+    constexpr Fixed32 HALF_PI = Fixed32::fromRaw(102944);
+    constexpr Fixed32 TWO_PI = Fixed32::fromRaw(411775);
+
+    namespace detail {
+        // Raíz cuadrada entera de value, redondeada al más cercano (bit por bit).
+        constexpr uint64_t isqrt(uint64_t value) {
+            uint64_t remainder = value;
+            uint64_t root = 0;
+            uint64_t bit = uint64_t(1) << 62;
+            while (bit > value) {
+                bit >>= 2;
+            }
+            while (bit != 0) {
+                if (remainder >= root + bit) {
+                    remainder -= root + bit;
+                    root = (root >> 1) + bit;
+                }
+                else {
+                    root >>= 1;
+                }
+                bit >>= 2;
+            }
+            // value - root^2 > root equivale a value > (root + 1/2)^2.
+            return remainder > root ? root + 1 : root;
+        }
+
+        // Segmentos de la tabla por cuarto de vuelta (2^kSineTableBits).
+        constexpr int kSineTableBits = 8;
+        constexpr int kSineTableSize = 1 << kSineTableBits;
+
+        // Constantes en Q2.30 para generar la tabla.
+        constexpr int64_t kQ30One = int64_t(1) << 30;
+        constexpr int64_t kPiQ30 = 3373259426;
+
+        // Vueltas por radián en Q32: 2^32 / (2 pi).
+        constexpr int64_t kTurnsPerRadianQ32 = 683565276;
+
+        // Bits de la fase (fracción de vuelta) con la que se indexa la tabla.
+        constexpr int kPhaseBits = 48;
+        constexpr uint64_t kPhaseMask = (uint64_t(1) << kPhaseBits) - 1;
+        constexpr uint64_t kQuarterTurn = uint64_t(1) << (kPhaseBits - 2);
+
+        // sin(x) en Q2.30 para x en [0, pi/2] con la serie de Taylor hasta x^17.
+        constexpr int64_t sinQ30(int64_t x) {
+            const int64_t x2 = x * x / kQ30One;
+            int64_t term = x;
+            int64_t sum = x;
+            for (int k = 1; k <= 8; ++k) {
+                term = -(term * x2 / kQ30One) / ((2 * k) * (2 * k + 1));
+                sum += term;
+            }
+            return sum;
+        }
+
+        struct SineTable {
+            int32_t values[kSineTableSize + 1];
+        };
+
+        // sin(i * pi / (2 * kSineTableSize)) en Q16.16 para i en [0, kSineTableSize].
+        constexpr SineTable makeSineTable() {
+            SineTable table{};
+            for (int i = 0; i <= kSineTableSize; ++i) {
+                const int64_t x = i * kPiQ30 / (2 * kSineTableSize);
+                table.values[i] = static_cast<int32_t>((sinQ30(x) + (int64_t(1) << 13)) >> 14);
+            }
+            return table;
+        }
+
+        inline constexpr SineTable kSineTable = makeSineTable();
+
+        // Convierte un ángulo en radianes a fase: fracción de vuelta en kPhaseBits bits.
+        constexpr uint64_t toPhase(Fixed32 angle) {
+            return static_cast<uint64_t>(static_cast<int64_t>(angle.raw) * kTurnsPerRadianQ32) & kPhaseMask;
+        }
+
+        // Seno de una fase, interpolando linealmente el cuarto de onda.
+        constexpr Fixed32 sinPhase(uint64_t phase) {
+            const int quarter = static_cast<int>(phase >> (kPhaseBits - 2)) & 3;
+            // Posición dentro del cuarto: kSineTableBits de índice y 16 de peso.
+            constexpr int kPositionShift = kPhaseBits - 2 - kSineTableBits - 16;
+            constexpr int64_t kQuarterPositions = int64_t(1) << (kSineTableBits + 16);
+            int64_t position = static_cast<int64_t>(phase >> kPositionShift) & (kQuarterPositions - 1);
+            if (quarter & 1) {
+                position = kQuarterPositions - position;
+            }
+            const int index = static_cast<int>(position >> 16);
+            int32_t value = kSineTable.values[kSineTableSize];
+            if (index < kSineTableSize) {
+                const int64_t weight = position & 0xFFFF;
+                const int64_t low = kSineTable.values[index];
+                const int64_t high = kSineTable.values[index + 1];
+                value = static_cast<int32_t>(low + (((high - low) * weight + 0x8000) >> 16));
+            }
+            return Fixed32::fromRaw(quarter >= 2 ? -value : value);
+        }
+    }
+
+    // Raíz cuadrada redondeada al más cercano; 0 si x <= 0.
+    constexpr Fixed32 sqrt(Fixed32 x) {
+        if (x.raw <= 0) {
+            return Fixed32();
+        }
+        return Fixed32::fromRaw(static_cast<int32_t>(detail::isqrt(static_cast<uint64_t>(x.raw) << Fixed32::kFractionBits)));
+    }
+
+    // Seno de un ángulo en radianes.
+    constexpr Fixed32 sin(Fixed32 angle) {
+        return detail::sinPhase(detail::toPhase(angle));
+    }
+
+    // Coseno de un ángulo en radianes: seno adelantado un cuarto de vuelta.
+    constexpr Fixed32 cos(Fixed32 angle) {
+        return detail::sinPhase((detail::toPhase(angle) + detail::kQuarterTurn) & detail::kPhaseMask);
+    }
+
+    // Seno y coseno con una sola conversión a fase.
+    constexpr void sincos(Fixed32 angle, Fixed32& sine, Fixed32& cosine) {
+        const uint64_t phase = detail::toPhase(angle);
+        sine = detail::sinPhase(phase);
+        cosine = detail::sinPhase((phase + detail::kQuarterTurn) & detail::kPhaseMask);
+    }
+
+    // Valor absoluto.
+    constexpr Fixed32 abs(Fixed32 x) {
+        return x.raw < 0 ? -x : x;
+    }
+}
@@ -0,0 +1,99 @@
+#pragma once
+#include "Fixed32.h"
+#include "Vector2.h"
+
+/**
+ * @brief Vector 2D de punto fijo Q16.16, la variante determinista de Vector2.
+ * Tiene la misma interfaz que Vector2 para que el código de juego escrito como plantilla
+ * sobre el escalar (ver ScalarTraits.h) compile con cualquiera de los dos.
+ */
+class FixedVector2 {
+public:
+
+    // Valores de las coordenadas x y y
+    Fixed32 x;
+    Fixed32 y;
+
+    /**
+     * @brief Constructor por defecto
+     * Inicializa las coordenadas en 0.
+    */
+    constexpr FixedVector2() : x(), y() {}
+
+    /**
+     * @brief Constructor parametrizado.
+     * Inicializa las coordenadas con los valores dados.
+    */
+    constexpr FixedVector2(Fixed32 xVal, Fixed32 yVal) : x(xVal), y(yVal) {}
+
+    // Convierte desde Vector2; determinista solo si el Vector2 lo es (ver Fixed32::fromFloat).
+    static constexpr FixedVector2 fromVector2(const Vector2& v) {
+        return FixedVector2(Fixed32::fromFloat(v.x), Fixed32::fromFloat(v.y));
+    }
+
+    // Convierte a Vector2 para el render y la interfaz.
+    constexpr Vector2 toVector2() const {
+        return Vector2(x.toFloat(), y.toFloat());
+    }
+
+    // Sobrecarga del operador para la suma de 2 vectores.
+    constexpr FixedVector2 operator+(const FixedVector2& other) const {
+        return FixedVector2(x + other.x, y + other.y);
+    }
+
+    // Sobrecarga del operador +=
+    constexpr FixedVector2& operator+=(const FixedVector2& other) {
+        x += other.x;
+        y += other.y;
+        return *this;
+    }
+
+    // Sobrecarga del operador para la resta de 2 vectores.
+    constexpr FixedVector2 operator-(const FixedVector2& other) const {
+        return FixedVector2(x - other.x, y - other.y);
+    }
+
+    // Sobrecarga del operador para multiplicar por un escalar.
+    constexpr FixedVector2 operator*(Fixed32 scalar) const {
+        return FixedVector2(x * scalar, y * scalar);
+    }
+
+    // Sobrecarga del operador /; entre 0 devuelve (0, 0) como Vector2.
+    constexpr FixedVector2 operator/(Fixed32 scalar) const {
+        return FixedVector2(x / scalar, y / scalar);
+    }
+
+    // Sobrecarga del operador /=
+    constexpr FixedVector2& operator/=(Fixed32 scalar) {
+        x /= scalar;
+        y /= scalar;
+        return *this;
+    }
+
+    constexpr bool operator==(const FixedVector2& other) const {
+        return x == other.x && y == other.y;
+    }
+
+    constexpr bool operator!=(const FixedVector2& other) const {
+        return !(*this == other);
+    }
+
+    /**
+     * @brief Calcula la magnitud del vector.
+     * Suma los cuadrados en 64 bits, así que no se desborda aunque x * x no quepa en
+     * Fixed32; solo el resultado debe caber (magnitud menor que 32768).
+    */
+    constexpr Fixed32 magnitude() const {
+        const uint64_t squared = static_cast<uint64_t>(static_cast<int64_t>(x.raw) * x.raw) +
+                                 static_cast<uint64_t>(static_cast<int64_t>(y.raw) * y.raw);
+        return Fixed32::fromRaw(static_cast<int32_t>(FixedMath::detail::isqrt(squared)));
+    }
+
+    /**
+     * @brief Método para normalizar el vector.
+     * Si el vector tiene magnitud 0, devuelve (0, 0).
+    */
+    constexpr FixedVector2 normalize() const {
+        return *this / magnitude();
+    }
+};
@@ -0,0 +1,151 @@
+#pragma once
+#include "Prerequisites.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+// Qué hacer cuando la cola de codificación está llena.
+enum class
+CaptureOverflow {
+  DropFrames,   // Descarta el frame y sigue; el número del archivo deja un hueco.
+  Backpressure  // El hilo principal espera a que haya espacio; no se pierde ningún frame.
+};
+
+/**
+ * @brief Configuración de una grabación.
+ */
+struct
+CaptureSettings {
+  std::string directory = "Captures"; // Carpeta de salida (se crea si no existe).
+  std::string prefix = "frame";       // Prefijo de los archivos: prefix_000000.png.
+  size_t encoderThreads = 2;          // Hilos que codifican y escriben PNG.
+  size_t queueCapacity = 8;           // Frames leídos esperando a codificarse.
+  size_t readbackDelay = 2;           // Frames entre la copia en GPU y su lectura.
+  CaptureOverflow overflow = CaptureOverflow::DropFrames;
+};
+
+/**
+ * @brief Estadísticas de la grabación actual.
+ */
+struct
+CaptureStats {
+  uint64_t captured = 0;      // Frames copiados en la GPU.
+  uint64_t written = 0;       // Archivos escritos.
+  uint64_t dropped = 0;       // Frames descartados por cola llena.
+  uint64_t failed = 0;        // Archivos que no se pudieron escribir.
+  size_t queued = 0;          // Frames esperando a codificarse.
+  float readbackMs = 0.0f;    // Promedio de la lectura a memoria en el hilo principal.
+  float encodeMs = 0.0f;      // Promedio de la codificación y escritura de un PNG.
+  float backpressureMs = 0.0f; // Tiempo total que el hilo principal esperó por espacio.
+};
+
+/**
+ * @brief Grabación asíncrona de frames a una secuencia de imágenes PNG.
+ * Cada frame se copia primero a una textura de un anillo con una copia entre texturas
+ * en la GPU, que no espera a que el frame termine. La textura se lee a memoria
+ * readbackDelay frames después, cuando la GPU ya la completó, y la imagen pasa a una
+ * cola acotada que vacían hilos de codificación. El hilo principal solo paga la
+ * lectura de una imagen ya lista; la codificación PNG y la escritura a disco nunca
+ * ocurren en él.
+ *
+ * Todas las funciones salvo getStats deben llamarse desde el hilo dueño del contexto
+ * de OpenGL.
+ */
+class
+FrameCapture {
+public:
+  FrameCapture() = default;
+
+  ~FrameCapture() { stop(); }
+
+  // Deshabilitar copia y asignación
+  FrameCapture(const FrameCapture&) = delete;
+  FrameCapture& operator=(const FrameCapture&) = delete;
+
+  // Cambia la configuración; se aplica en el siguiente start().
+  void
+  setSettings(const CaptureSettings& settings) { m_settings = settings; }
+
+  const CaptureSettings&
+  getSettings() const { return m_settings; }
+
+  /**
+   * @brief Crea la carpeta de salida e inicia los hilos de codificación.
+   * @return `false` si la carpeta no se pudo crear.
+   */
+  bool
+  start();
+
+  /**
+   * @brief Termina la grabación.
+   * Lee los frames que siguen en el anillo, espera a que la cola se vacíe y detiene
+   * los hilos de codificación.
+   */
+  void
+  stop();
+
+  bool
+  isRecording() const { return m_recording; }
+
+  /**
+   * @brief Captura un área de una textura (por ejemplo la de la RenderTexture de la escena).
+   * @param source Textura con el frame terminado.
+   * @param area Región de la textura que se guarda.
+   */
+  void
+  captureTexture(const sf::Texture& source, const sf::IntRect& area);
+
+  // Captura el contenido actual de la ventana; debe llamarse antes de display().
+  void
+  captureWindow(const sf::RenderWindow& window);
+
+  // Copia de las estadísticas; se puede llamar desde cualquier hilo.
+  CaptureStats
+  getStats() const;
+
+private:
+  // Textura del anillo con un frame copiado en la GPU que aún no se lee.
+  struct
+  Readback {
+    sf::Texture texture;
+    sf::IntRect area;
+    uint64_t frame = 0;
+    bool pending = false;
+  };
+
+  // Frame leído a memoria esperando a codificarse.
+  struct
+  EncodeJob {
+    sf::Image image;
+    sf::IntRect area;
+    uint64_t frame = 0;
+  };
+
+  // Toma la siguiente textura del anillo, leyendo antes el frame que tenía.
+  Readback&
+  nextReadback(const sf::Vector2u& size);
+
+  // Lee un frame del anillo y lo manda a la cola según la política de desbordamiento.
+  void
+  readOut(Readback& readback);
+
+  void
+  workerLoop();
+
+  CaptureSettings m_settings;
+  bool m_recording = false;
+  std::string m_directory; // Carpeta de la grabación en curso.
+  std::string m_prefix;
+
+  std::vector<Readback> m_readbacks;
+  size_t m_nextReadback = 0;
+  uint64_t m_nextFrame = 0;
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_hasWork;
+  std::condition_variable m_hasRoom;
+  std::deque<EncodeJob> m_queue;
+  std::vector<std::thread> m_workers;
+  bool m_stopping = false;
+  CaptureStats m_stats; // Protegido por m_mutex.
+};
@@ -2,9 +2,26 @@
 #include "Prerequisites.h"
 #include "Actor.h"
 #include "Services/NotificationSystem.h"
+#include "RenderBatcher.h"
+#include "BenchmarkScene.h"
+#include "DynamicResolution.h"
+#include "SimulationThread.h"
+#include "FrameCapture.h"
 
 class Window;
 
+/**
+ * @brief Tiempo de frame promedio de cada modo de la ventana.
+ * Permite comparar el editor (RenderTexture + ImGui) contra el modo juego.
+ */
+struct
+FrameTimes {
+  float editorMs = 0.0f;  // Promedio movil en modo editor.
+  float gameMs = 0.0f;    // Promedio movil en modo juego.
+  bool gameMode = false;  // Modo activo en el frame actual.
+  bool sceneReused = false; // El frame reutilizo la escena ya dibujada en la RenderTexture.
+};
+
 class
 GUI {
 public:
@@ -54,13 +71,59 @@ public:
   void
   inspector();
 
-  // Permite manipular dos valores flotantes en la interfaz grafica.
+ /**
+  * @brief Muestra las estadisticas de render del frame.
+  * En modo juego se dibuja como overlay sin decoraciones en la esquina de la ventana.
+  * @param stats Estadisticas del batcher.
+  * @param visibleActors Actores que pasaron el culling contra la vista.
+  * @param totalActors Actores en la escena.
+  * @param frameTimes Tiempo de frame de cada modo.
+  * @param resolution Controlador de resolucion dinamica (escala, historial y limites).
+  * @param simulation Metricas de la simulacion; `threaded` se puede cambiar desde el panel.
+  */
+  void
+  stats(const RenderStats& stats, size_t visibleActors, size_t totalActors,
+        const FrameTimes& frameTimes, DynamicResolution& resolution,
+        SimulationStats& simulation);
+
+ /**
+  * @brief Muestra el panel de la escena de prueba de rendimiento.
+  * Permite generar las formas de prueba y medir el escalamiento con los nucleos.
+  */
   void
+  benchmark(BenchmarkScene& scene);
+
+ /**
+  * @brief Muestra el panel de grabacion de frames.
+  * La configuracion solo se edita sin grabar; el boton de iniciar/detener se atiende
+  * en el siguiente frame con consumeCaptureToggle, igual que F2.
+  */
+  void
+  capture(FrameCapture& capture);
+
+  // Indica si se pulso el boton de grabar/detener y limpia el aviso.
+  bool
+  consumeCaptureToggle();
+
+  /**
+   * @brief Permite manipular dos valores flotantes en la interfaz grafica.
+   * @return `true` si alguno de los valores cambio en este frame.
+   */
+  bool
   vec2Control(const std::string& label,
       float* values,
       float resetValues = 0.0f,
       float columnWidth = 100.0f);
 
 private:
+  // Crea un actor con la forma indicada y lo agrega a la lista de actores.
+  void
+  createActor(std::vector<EngineUtilities::TSharedPointer<Actor>>& actors,
+              ShapeType shapeType,
+              const std::string& name,
+              float x,
+              float y);
+
   EngineUtilities::TSharedPointer<Actor> selectedActor;
+  bool m_captureToggle = false;
 };
\ No newline at end of file
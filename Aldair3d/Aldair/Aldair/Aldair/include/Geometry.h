@@ -0,0 +1,353 @@
+#pragma once
+#include "MathEngine.h"
+#include "Vector2.h"
+#include "Matrix3x3.h"
+#include <cstddef>
+#include <limits>
+
+/**
+ * @brief Primitivas geométricas 2D: AABB, círculo, OBB, segmento y rayo.
+ * Son las versiones escalares de referencia; las pruebas contra muchos elementos a la
+ * vez están en MathBatch (overlapAABBBatch, raycastCirclesBatch y
+ * pointsInPolygonBatch). Los bordes cuentan como dentro en todas las pruebas.
+ */
+namespace Geometry {
+    // Producto punto de 2 vectores.
+    constexpr float dot(const Vector2& a, const Vector2& b) {
+        return a.x * b.x + a.y * b.y;
+    }
+
+    // Componente z del producto cruz (positivo si b está en sentido antihorario de a).
+    constexpr float cross(const Vector2& a, const Vector2& b) {
+        return a.x * b.y - a.y * b.x;
+    }
+
+    // Vector perpendicular, girado 90 grados en sentido antihorario.
+    constexpr Vector2 perpendicular(const Vector2& v) {
+        return Vector2(-v.y, v.x);
+    }
+
+    constexpr float abs(float value) {
+        return value < 0.0f ? -value : value;
+    }
+
+    /**
+     * @brief Prueba de punto en polígono por número de cruces (regla par-impar).
+     * El polígono puede ser cóncavo; sus vértices van en orden, sin repetir el primero.
+     * Los puntos exactamente sobre un borde pueden quedar de cualquier lado.
+    */
+    constexpr bool containsPoint(const Vector2* polygon, size_t count, const Vector2& point) {
+        bool inside = false;
+        for (size_t i = 0, j = count - 1; i < count; j = i++) {
+            const Vector2& a = polygon[j];
+            const Vector2& b = polygon[i];
+            if ((a.y > point.y) != (b.y > point.y)) {
+                const float x = (point.y - a.y) * ((b.x - a.x) / (b.y - a.y)) + a.x;
+                if (x > point.x) {
+                    inside = !inside;
+                }
+            }
+        }
+        return inside;
+    }
+}
+
+// Caja alineada a los ejes.
+class AABB {
+public:
+
+    // Esquinas mínima y máxima.
+    Vector2 min;
+    Vector2 max;
+
+    /**
+     * @brief Constructor por defecto.
+     * Caja vacía en el origen.
+    */
+    constexpr AABB() : min(), max() {}
+
+    /**
+     * @brief Constructor parametrizado.
+     * Recibe las esquinas mínima y máxima.
+    */
+    constexpr AABB(const Vector2& minimum, const Vector2& maximum) : min(minimum), max(maximum) {}
+
+    // Caja con centro y medias extensiones dadas.
+    static constexpr AABB fromCenter(const Vector2& center, const Vector2& halfExtents) {
+        return AABB(center - halfExtents, center + halfExtents);
+    }
+
+    // Caja mínima que contiene count puntos (count > 0).
+    static constexpr AABB fromPoints(const Vector2* points, size_t count) {
+        AABB box(points[0], points[0]);
+        for (size_t i = 1; i < count; ++i) {
+            box = box.merge(points[i]);
+        }
+        return box;
+    }
+
+    constexpr Vector2 center() const {
+        return (min + max) * 0.5f;
+    }
+
+    constexpr Vector2 halfExtents() const {
+        return (max - min) * 0.5f;
+    }
+
+    constexpr bool contains(const Vector2& point) const {
+        return point.x >= min.x && point.x <= max.x && point.y >= min.y && point.y <= max.y;
+    }
+
+    constexpr bool overlaps(const AABB& other) const {
+        return min.x <= other.max.x && other.min.x <= max.x && min.y <= other.max.y && other.min.y <= max.y;
+    }
+
+    // Caja que contiene a esta y a point.
+    constexpr AABB merge(const Vector2& point) const {
+        return AABB(Vector2(point.x < min.x ? point.x : min.x, point.y < min.y ? point.y : min.y),
+                    Vector2(point.x > max.x ? point.x : max.x, point.y > max.y ? point.y : max.y));
+    }
+
+    // Caja que contiene a esta y a other.
+    constexpr AABB merge(const AABB& other) const {
+        return merge(other.min).merge(other.max);
+    }
+
+    /**
+     * @brief Caja alineada que contiene a esta después de transformarla.
+     * Transforma el centro y proyecta las extensiones con los valores absolutos de la
+     * matriz (método de Arvo); es exacta para rotaciones y escalas.
+    */
+    constexpr AABB transform(const Matrix3x3& matrix) const {
+        const Vector2 extents = halfExtents();
+        const Vector2 worldExtents(Geometry::abs(matrix.m[0][0]) * extents.x + Geometry::abs(matrix.m[0][1]) * extents.y,
+                                   Geometry::abs(matrix.m[1][0]) * extents.x + Geometry::abs(matrix.m[1][1]) * extents.y);
+        return fromCenter(matrix.transformPoint(center()), worldExtents);
+    }
+};
+
+// Círculo con centro y radio.
+class Circle {
+public:
+
+    Vector2 center;
+    float radius;
+
+    constexpr Circle() : center(), radius(0) {}
+
+    constexpr Circle(const Vector2& centerVal, float radiusVal) : center(centerVal), radius(radiusVal) {}
+
+    constexpr bool contains(const Vector2& point) const {
+        const Vector2 d = point - center;
+        return Geometry::dot(d, d) <= radius * radius;
+    }
+
+    constexpr bool overlaps(const Circle& other) const {
+        const Vector2 d = other.center - center;
+        const float sum = radius + other.radius;
+        return Geometry::dot(d, d) <= sum * sum;
+    }
+
+    // Compara la distancia del centro al punto más cercano de la caja.
+    constexpr bool overlaps(const AABB& box) const {
+        const float x = center.x < box.min.x ? box.min.x : (center.x > box.max.x ? box.max.x : center.x);
+        const float y = center.y < box.min.y ? box.min.y : (center.y > box.max.y ? box.max.y : center.y);
+        return contains(Vector2(x, y));
+    }
+
+    constexpr AABB getAABB() const {
+        return AABB::fromCenter(center, Vector2(radius, radius));
+    }
+};
+
+/**
+ * @brief Caja orientada: centro, medias extensiones y eje x local (unitario).
+ * El eje y local es la perpendicular antihoraria del eje x.
+ */
+class OBB {
+public:
+
+    Vector2 center;
+    Vector2 halfExtents;
+    Vector2 axis;
+
+    constexpr OBB() : center(), halfExtents(), axis(1, 0) {}
+
+    constexpr OBB(const Vector2& centerVal, const Vector2& halfExtentsVal, const Vector2& axisVal)
+        : center(centerVal), halfExtents(halfExtentsVal), axis(axisVal) {}
+
+    /**
+     * @brief Caja local transformada por una matriz de traslación, rotación y escala.
+     * Supone que la matriz no tiene sesgo, como las de Matrix3x3::fromTRS.
+    */
+    static constexpr OBB fromMatrix(const Matrix3x3& matrix, const AABB& local) {
+        const Vector2 columnX(matrix.m[0][0], matrix.m[1][0]);
+        const Vector2 columnY(matrix.m[0][1], matrix.m[1][1]);
+        const float lengthX = columnX.magnitude();
+        const float lengthY = columnY.magnitude();
+        const Vector2 extents = local.halfExtents();
+        return OBB(matrix.transformPoint(local.center()),
+                   Vector2(extents.x * lengthX, extents.y * lengthY),
+                   lengthX > 0.0f ? columnX / lengthX : Vector2(1, 0));
+    }
+
+    constexpr Vector2 axisY() const {
+        return Geometry::perpendicular(axis);
+    }
+
+    constexpr bool contains(const Vector2& point) const {
+        const Vector2 d = point - center;
+        return Geometry::abs(Geometry::dot(d, axis)) <= halfExtents.x &&
+               Geometry::abs(Geometry::dot(d, axisY())) <= halfExtents.y;
+    }
+
+    // Radio de la proyección de la caja sobre direction (unitario).
+    constexpr float projectedRadius(const Vector2& direction) const {
+        return halfExtents.x * Geometry::abs(Geometry::dot(axis, direction)) +
+               halfExtents.y * Geometry::abs(Geometry::dot(axisY(), direction));
+    }
+
+    // Teorema del eje separador con los 4 ejes de ambas cajas.
+    constexpr bool overlaps(const OBB& other) const {
+        const Vector2 d = other.center - center;
+        const Vector2 axes[4] = { axis, axisY(), other.axis, other.axisY() };
+        for (const Vector2& direction : axes) {
+            if (Geometry::abs(Geometry::dot(d, direction)) > projectedRadius(direction) + other.projectedRadius(direction)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    constexpr AABB getAABB() const {
+        return AABB::fromCenter(center, Vector2(projectedRadius(Vector2(1, 0)), projectedRadius(Vector2(0, 1))));
+    }
+};
+
+// Segmento entre start y end.
+class Segment {
+public:
+
+    Vector2 start;
+    Vector2 end;
+
+    constexpr Segment() : start(), end() {}
+
+    constexpr Segment(const Vector2& startVal, const Vector2& endVal) : start(startVal), end(endVal) {}
+
+    // Punto del segmento más cercano a point.
+    constexpr Vector2 closestPoint(const Vector2& point) const {
+        const Vector2 direction = end - start;
+        const float lengthSquared = Geometry::dot(direction, direction);
+        if (lengthSquared == 0.0f) {
+            return start;
+        }
+        float t = Geometry::dot(point - start, direction) / lengthSquared;
+        t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+        return start + direction * t;
+    }
+
+    constexpr float distanceSquared(const Vector2& point) const {
+        const Vector2 d = point - closestPoint(point);
+        return Geometry::dot(d, d);
+    }
+
+    // Los segmentos se cruzan o se tocan (incluye segmentos colineales que se traslapan).
+    constexpr bool intersects(const Segment& other) const {
+        const Vector2 r = end - start;
+        const Vector2 s = other.end - other.start;
+        const Vector2 offset = other.start - start;
+        const float denominator = Geometry::cross(r, s);
+        const float crossR = Geometry::cross(offset, r);
+        if (denominator == 0.0f) {
+            if (crossR != 0.0f) {
+                return false; // Paralelos.
+            }
+            // Colineales: se traslapan si las proyecciones sobre r se traslapan.
+            const float rr = Geometry::dot(r, r);
+            if (rr == 0.0f) {
+                return other.distanceSquared(start) == 0.0f;
+            }
+            const float t0 = Geometry::dot(offset, r) / rr;
+            const float t1 = t0 + Geometry::dot(s, r) / rr;
+            return (t0 < t1 ? t0 : t1) <= 1.0f && (t0 < t1 ? t1 : t0) >= 0.0f;
+        }
+        const float t = Geometry::cross(offset, s) / denominator;
+        const float u = crossR / denominator;
+        return t >= 0.0f && t <= 1.0f && u >= 0.0f && u <= 1.0f;
+    }
+};
+
+/**
+ * @brief Rayo con origen y dirección unitaria.
+ * Las intersecciones devuelven la distancia t del origen al primer punto de contacto
+ * (0 si el origen ya está dentro).
+ */
+class Ray {
+public:
+
+    Vector2 origin;
+    Vector2 direction;
+
+    constexpr Ray() : origin(), direction(1, 0) {}
+
+    // Normaliza la dirección.
+    constexpr Ray(const Vector2& originVal, const Vector2& directionVal)
+        : origin(originVal), direction(directionVal.normalize()) {}
+
+    constexpr Vector2 at(float t) const {
+        return origin + direction * t;
+    }
+
+    constexpr bool intersect(const Circle& circle, float& t) const {
+        const Vector2 m = circle.center - origin;
+        const float b = Geometry::dot(m, direction);
+        const float c = Geometry::dot(m, m) - circle.radius * circle.radius;
+        if (c > 0.0f && b < 0.0f) {
+            return false; // Afuera y apuntando en sentido contrario.
+        }
+        const float discriminant = b * b - c;
+        if (discriminant < 0.0f) {
+            return false;
+        }
+        const float hit = b - MathEngine::sqrt(discriminant);
+        t = hit > 0.0f ? hit : 0.0f;
+        return true;
+    }
+
+    // Método de las placas; una componente 0 de la dirección da divisiones infinitas.
+    bool intersect(const AABB& box, float& t) const {
+        const float inverseX = 1.0f / direction.x;
+        const float inverseY = 1.0f / direction.y;
+        float tx0 = (box.min.x - origin.x) * inverseX;
+        float tx1 = (box.max.x - origin.x) * inverseX;
+        float ty0 = (box.min.y - origin.y) * inverseY;
+        float ty1 = (box.max.y - origin.y) * inverseY;
+        if (tx0 > tx1) { const float swap = tx0; tx0 = tx1; tx1 = swap; }
+        if (ty0 > ty1) { const float swap = ty0; ty0 = ty1; ty1 = swap; }
+        // Con el origen sobre una placa y dirección paralela, 0 * inf da NaN: se ignora ese eje.
+        const float enter = tx0 > ty0 || ty0 != ty0 ? tx0 : ty0;
+        const float exit = tx1 < ty1 || ty1 != ty1 ? tx1 : ty1;
+        if (enter > exit || exit < 0.0f) {
+            return false;
+        }
+        t = enter > 0.0f ? enter : 0.0f;
+        return true;
+    }
+
+    constexpr bool intersect(const Segment& segment, float& t) const {
+        const Vector2 s = segment.end - segment.start;
+        const Vector2 offset = segment.start - origin;
+        const float denominator = Geometry::cross(direction, s);
+        if (denominator == 0.0f) {
+            return false; // Paralelos; el caso colineal no se reporta.
+        }
+        const float hit = Geometry::cross(offset, s) / denominator;
+        const float u = Geometry::cross(offset, direction) / denominator;
+        if (hit < 0.0f || u < 0.0f || u > 1.0f) {
+            return false;
+        }
+        t = hit;
+        return true;
+    }
+};
@@ -0,0 +1,143 @@
+#pragma once
+#include "ScalarTraits.h"
+#include "Random.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Repetición sin render para probar el determinismo de la simulación.
+ * Avanza agentes que recorren puntos de ruta con Steering::seek y oscilan de lado con
+ * sin y cos, a paso fijo y con entradas aleatorias de un flujo dado, y calcula
+ * un hash del estado en cada frame. Con Scalar = Fixed32 dos compilaciones distintas
+ * (otro compilador, otras banderas) deben producir exactamente los mismos hashes; con
+ * float sirve para ver en qué frame divergen.
+ */
+template<typename Scalar>
+class
+LockstepReplay {
+public:
+  using Traits = ScalarTraits<Scalar>;
+  using Vector = typename Traits::Vector;
+
+  // Estado de un agente.
+  struct
+  Agent {
+    Vector position;
+    Scalar speed;
+    Scalar phase;        // Ángulo de la oscilación lateral, en radianes.
+    Scalar angularSpeed; // Radianes por segundo de la oscilación.
+    int waypoint = 0;    // Punto de ruta al que se dirige.
+  };
+
+  // Frames por segundo del paso fijo.
+  static constexpr int kFramesPerSecond = 60;
+
+  // Puntos de ruta de la repetición.
+  static constexpr int kWaypointCount = 8;
+
+  /**
+   * @brief Genera el estado inicial.
+   * Todo se construye desde enteros de random, sin pasar por float; con el flujo de
+   * RandomService::createStream, la semilla del servicio reproduce la repetición.
+   */
+  LockstepReplay(size_t agentCount, const Random& random)
+    : m_random(random) {
+    m_deltaTime = Traits::fromRatio(1, kFramesPerSecond);
+    m_range = Traits::fromInt(10);
+    m_wobble = Traits::fromInt(40);
+    for (Vector& waypoint : m_waypoints) {
+      waypoint = Vector(Traits::fromInt(nextRandom(800)), Traits::fromInt(nextRandom(600)));
+    }
+    m_agents.resize(agentCount);
+    for (Agent& agent : m_agents) {
+      agent.position = Vector(Traits::fromInt(nextRandom(800)), Traits::fromInt(nextRandom(600)));
+      agent.speed = Traits::fromInt(80 + nextRandom(160));
+      agent.phase = Traits::fromRatio(nextRandom(628), 100);
+      agent.angularSpeed = Traits::fromRatio(nextRandom(800) - 400, 100);
+      agent.waypoint = nextRandom(kWaypointCount);
+    }
+  }
+
+  // Avanza un frame de la simulación.
+  void
+  step() {
+    const Scalar twoPi = Traits::pi() + Traits::pi();
+    for (Agent& agent : m_agents) {
+      const Vector& target = m_waypoints[agent.waypoint];
+      Steering::seek<Scalar>(agent.position, target, agent.speed, m_deltaTime, m_range);
+
+      // Oscilación lateral; la fase se mantiene en [-2 pi, 2 pi].
+      agent.phase += agent.angularSpeed * m_deltaTime;
+      if (agent.phase > twoPi) {
+        agent.phase -= twoPi;
+      }
+      else if (agent.phase < -twoPi) {
+        agent.phase += twoPi;
+      }
+      agent.position += Vector(Traits::cos(agent.phase), Traits::sin(agent.phase)) * (m_wobble * m_deltaTime);
+
+      if ((target - agent.position).magnitude() < m_range + m_range) {
+        agent.waypoint = (agent.waypoint + 1) % kWaypointCount;
+      }
+    }
+  }
+
+  // Hash FNV-1a de 64 bits de los bits del estado de todos los agentes.
+  uint64_t
+  hashState() const {
+    uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](uint32_t value) {
+      for (int i = 0; i < 4; ++i) {
+        hash ^= (value >> (8 * i)) & 0xFF;
+        hash *= 1099511628211ull;
+      }
+    };
+    for (const Agent& agent : m_agents) {
+      mix(Traits::toBits(agent.position.x));
+      mix(Traits::toBits(agent.position.y));
+      mix(Traits::toBits(agent.phase));
+      mix(static_cast<uint32_t>(agent.waypoint));
+    }
+    return hash;
+  }
+
+  // Ejecuta frames pasos y devuelve el hash del estado después de cada uno.
+  std::vector<uint64_t>
+  run(unsigned int frames) {
+    std::vector<uint64_t> hashes;
+    hashes.reserve(frames);
+    for (unsigned int frame = 0; frame < frames; ++frame) {
+      step();
+      hashes.push_back(hashState());
+    }
+    return hashes;
+  }
+
+  const std::vector<Agent>&
+  getAgents() const { return m_agents; }
+
+private:
+  // Entero en [0, bound).
+  int
+  nextRandom(int bound) { return static_cast<int>(m_random.nextInt(static_cast<uint32_t>(bound))); }
+
+  std::vector<Agent> m_agents;
+  Vector m_waypoints[kWaypointCount];
+  Scalar m_deltaTime;
+  Scalar m_range;
+  Scalar m_wobble;
+  Random m_random;
+};
+
+/**
+ * @brief Prueba de determinismo entre compilaciones.
+ * Ejecuta la repetición de frames frames y compara los hashes con los guardados en
+ * path. Si el archivo no existe lo crea con los hashes de esta compilación; así, la
+ * primera compilación graba la referencia y la segunda la compara frame por frame.
+ * @param fixedPoint Usa Fixed32 (true) o float (false) como escalar.
+ * @return 0 si los hashes coinciden o se grabó la referencia; 1 si hay divergencia o
+ * no se pudo leer o escribir el archivo.
+ */
+int
+runReplayCheck(const std::string& path, unsigned int frames, bool fixedPoint);
@@ -0,0 +1,228 @@
+#pragma once
+#include "Vector2.h"
+#include "Quaternion.h"
+#include "Geometry.h"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Operaciones de Vector2 en bloque sobre arreglos separados de x y y (SoA).
+ * Cada función procesa count elementos con el mejor conjunto de instrucciones que
+ * soporte el procesador (AVX2 con FMA, SSE2 o escalar), elegido una sola vez al
+ * primer uso con CPUID; el ejecutable no necesita compilarse con /arch:AVX2. Los
+ * arreglos no tienen que estar alineados y count no tiene que ser múltiplo del ancho
+ * SIMD: los elementos que sobran se procesan con la versión escalar.
+ *
+ * Los parámetros que pueden variar por elemento se pasan como BatchScalars: un
+ * arreglo de count valores o un valor uniforme para todos.
+ *
+ * Las interpolaciones de cuaterniones trabajan sobre arreglos de Quaternion (AoS): cada
+ * cuaternión ya ocupa un registro SSE completo.
+ *
+ * Las pruebas geométricas comparan una primitiva de Geometry.h contra muchas en SoA y
+ * dan el mismo resultado que las versiones escalares de Geometry.h, salvo por redondeo
+ * en los casos tangentes o sobre un borde.
+ */
+namespace MathBatch {
+  // Conjunto de instrucciones de los kernels.
+  enum class
+  InstructionSet {
+    Scalar,
+    SSE2,
+    AVX2
+  };
+
+  // Arreglos x[] y y[] de count vectores que la operación modifica.
+  struct
+  Vector2Span {
+    float* x = nullptr;
+    float* y = nullptr;
+    size_t count = 0;
+  };
+
+  // Arreglos x[] y y[] de count vectores de solo lectura.
+  struct
+  ConstVector2Span {
+    const float* x = nullptr;
+    const float* y = nullptr;
+    size_t count = 0;
+
+    ConstVector2Span() = default;
+    ConstVector2Span(const float* x, const float* y, size_t count) : x(x), y(y), count(count) {}
+    ConstVector2Span(const Vector2Span& span) : x(span.x), y(span.y), count(span.count) {}
+  };
+
+  // Arreglo de count cuaterniones que la operación escribe.
+  struct
+  QuaternionSpan {
+    Quaternion* data = nullptr;
+    size_t count = 0;
+  };
+
+  // Arreglo de count cuaterniones de solo lectura.
+  struct
+  ConstQuaternionSpan {
+    const Quaternion* data = nullptr;
+    size_t count = 0;
+
+    ConstQuaternionSpan() = default;
+    ConstQuaternionSpan(const Quaternion* data, size_t count) : data(data), count(count) {}
+    ConstQuaternionSpan(const QuaternionSpan& span) : data(span.data), count(span.count) {}
+  };
+
+  // Cajas alineadas de solo lectura: esquinas mínima y máxima de count cajas.
+  struct
+  ConstAABBSpan {
+    const float* minX = nullptr;
+    const float* minY = nullptr;
+    const float* maxX = nullptr;
+    const float* maxY = nullptr;
+    size_t count = 0;
+  };
+
+  // Círculos de solo lectura: centros y radios de count círculos.
+  struct
+  ConstCircleSpan {
+    const float* x = nullptr;
+    const float* y = nullptr;
+    const float* radius = nullptr;
+    size_t count = 0;
+  };
+
+  // Parámetro por elemento (values != nullptr) o uniforme (value).
+  struct
+  BatchScalars {
+    const float* values = nullptr;
+    float value = 0.0f;
+
+    BatchScalars(float uniform) : value(uniform) {}
+    BatchScalars(const float* perElement) : values(perElement) {}
+  };
+
+  /**
+   * @brief Versión en bloque de Transform::Seek.
+   * Cada posición avanza speed * deltaTime hacia su objetivo si está a más de range.
+   * @param targets Un objetivo por elemento.
+   */
+  void
+  seekBatch(Vector2Span positions, ConstVector2Span targets,
+            BatchScalars speeds, float deltaTime, float range);
+
+  // seekBatch con el mismo objetivo para todos los elementos.
+  void
+  seekBatch(Vector2Span positions, const Vector2& target,
+            BatchScalars speeds, float deltaTime, float range);
+
+  // Suma un desplazamiento por elemento: p[i] += offsets[i] * factor.
+  void
+  translateBatch(Vector2Span positions, ConstVector2Span offsets, float factor = 1.0f);
+
+  // Suma el mismo desplazamiento a todos los elementos.
+  void
+  translateBatch(Vector2Span positions, const Vector2& offset);
+
+  /**
+   * @brief Un paso de Euler semiimplícito con aceleración uniforme:
+   * v[i] += acceleration * deltaTime, luego p[i] += v[i] * deltaTime.
+   * El resultado es el mismo con cualquier conjunto de instrucciones.
+   * @param timers Opcional (mismo tamaño que positions); a cada uno se le resta deltaTime.
+   */
+  void
+  integrateBatch(Vector2Span positions, Vector2Span velocities, const Vector2& acceleration,
+                 float deltaTime, float* timers = nullptr);
+
+  /**
+   * @brief Escala y luego rota cada punto alrededor del origen: p = R(angle) * (S * p).
+   * Con un ángulo uniforme el seno y el coseno se calculan una vez con MathEngine. Con
+   * ángulos por elemento se evalúan en float en los registros SIMD; el error absoluto
+   * de seno y coseno es menor que kBatchSinCosError para |angle| <= kBatchAngleRange.
+   * @param angles Ángulos en radianes.
+   * @param scaleX Escala en x antes de rotar.
+   * @param scaleY Escala en y antes de rotar.
+   */
+  void
+  rotateScaleBatch(Vector2Span points, BatchScalars angles,
+                   BatchScalars scaleX, BatchScalars scaleY);
+
+  // Magnitud de cada vector: lengths[i] = |v[i]|.
+  void
+  lengthBatch(ConstVector2Span vectors, float* lengths);
+
+  /**
+   * @brief Normaliza cada vector con rsqrt y un paso de Newton-Raphson.
+   * Los vectores de magnitud 0 quedan en (0, 0), como Vector2::normalize.
+   */
+  void
+  normalizeBatch(Vector2Span vectors);
+
+  /**
+   * @brief Versión en bloque de Quaternion::nlerp: out[i] = nlerp(from[i], to[i], t[i]).
+   * Procesa el mínimo de los tres tamaños; out puede ser from o to.
+   */
+  void
+  nlerpBatch(ConstQuaternionSpan from, ConstQuaternionSpan to, BatchScalars t, QuaternionSpan out);
+
+  /**
+   * @brief Versión en bloque de Quaternion::slerp: out[i] = slerp(from[i], to[i], t[i]).
+   * Con un t uniforme y los mismos extremos para todos, conviene llamar a slerp una vez.
+   * Procesa el mínimo de los tres tamaños; out puede ser from o to.
+   */
+  void
+  slerpBatch(ConstQuaternionSpan from, ConstQuaternionSpan to, BatchScalars t, QuaternionSpan out);
+
+  /**
+   * @brief Prueba una caja contra muchas: hits[i] = box.overlaps(boxes[i]).
+   * @param hits Arreglo de boxes.count valores 0 o 1.
+   * @return Número de cajas que se traslapan con box.
+   */
+  size_t
+  overlapAABBBatch(const AABB& box, ConstAABBSpan boxes, uint8_t* hits);
+
+  // Índice que devuelve raycastCirclesBatch cuando el rayo no toca ningún círculo.
+  constexpr size_t kNoHit = static_cast<size_t>(-1);
+
+  /**
+   * @brief Lanza un rayo contra muchos círculos, como Ray::intersect(Circle).
+   * distances[i] es la distancia al primer contacto con el círculo i (0 si el origen
+   * está dentro) o infinito si no lo toca.
+   * @return Índice del círculo más cercano o kNoHit.
+   */
+  size_t
+  raycastCirclesBatch(const Ray& ray, ConstCircleSpan circles, float* distances);
+
+  /**
+   * @brief Prueba muchos puntos contra un polígono: inside[i] = containsPoint(polygon, p[i]).
+   * Usa la regla par-impar de Geometry::containsPoint; las pendientes de las aristas se
+   * calculan una vez y cada grupo de puntos recorre todas las aristas en registros.
+   * @param polygon vertexCount vértices (al menos 3) en orden, sin repetir el primero.
+   * @return Número de puntos dentro del polígono.
+   */
+  size_t
+  pointsInPolygonBatch(const Vector2* polygon, size_t vertexCount,
+                       ConstVector2Span points, uint8_t* inside);
+
+  // Ángulo máximo con el contrato de precisión en rotateScaleBatch por elemento.
+  constexpr float kBatchAngleRange = 32.0f;
+
+  // Error absoluto máximo del seno y el coseno por elemento en rotateScaleBatch.
+  constexpr float kBatchSinCosError = 2.0e-7f;
+
+  // Mejor conjunto de instrucciones que soporta el procesador.
+  InstructionSet
+  getSupportedInstructionSet();
+
+  // Conjunto de instrucciones activo.
+  InstructionSet
+  getInstructionSet();
+
+  /**
+   * @brief Fuerza los kernels de un conjunto de instrucciones (para medirlos).
+   * Si el procesador no lo soporta se usa el mejor disponible.
+   * No debe llamarse mientras otro hilo usa MathBatch.
+   */
+  void
+  setInstructionSet(InstructionSet instructionSet);
+
+  const char*
+  getInstructionSetName(InstructionSet instructionSet);
+}
@@ -0,0 +1,543 @@
+#pragma once
+#include "MathBatch.h"
+#include "MathEngine.h"
+#include <limits>
+
+/**
+ * @brief Kernels de MathBatch (uso interno).
+ * Los kernels SIMD son plantillas sobre un tipo de carriles (SSE2 o AVX2) que provee
+ * las operaciones básicas; el mismo código se instancia en MathBatch.cpp para SSE2 y
+ * en MathBatchAVX2.cpp para AVX2. Antes de incluir este archivo cada unidad define
+ * MATHBATCH_TARGET con el atributo de destino de sus funciones: vacío para SSE2 y,
+ * con GCC o Clang, target("avx2,fma") para AVX2. Todo lo que está en el espacio de
+ * nombres anónimo queda privado a cada unidad, así que el código AVX2 nunca se mezcla
+ * con el que corre en procesadores sin AVX2.
+ */
+#ifndef MATHBATCH_TARGET
+#define MATHBATCH_TARGET
+#endif
+
+namespace MathBatch {
+  namespace detail {
+    struct
+    SeekParams {
+      float* x;
+      float* y;
+      const float* targetX;   // nullptr: objetivo uniforme.
+      const float* targetY;
+      float uniformTargetX;
+      float uniformTargetY;
+      BatchScalars speeds;
+      float deltaTime;
+      float range;
+      size_t count;
+    };
+
+    struct
+    TranslateParams {
+      float* x;
+      float* y;
+      const float* offsetX;   // nullptr: desplazamiento uniforme.
+      const float* offsetY;
+      float uniformOffsetX;
+      float uniformOffsetY;
+      float factor;
+      size_t count;
+    };
+
+    struct
+    IntegrateParams {
+      float* x;
+      float* y;
+      float* velocityX;
+      float* velocityY;
+      float* timers;          // nullptr: sin temporizadores.
+      float velocityStepX;    // Aceleración por deltaTime.
+      float velocityStepY;
+      float deltaTime;
+      size_t count;
+    };
+
+    struct
+    RotateScaleParams {
+      float* x;
+      float* y;
+      BatchScalars angles;
+      BatchScalars scaleX;
+      BatchScalars scaleY;
+      size_t count;
+    };
+
+    struct
+    LengthParams {
+      const float* x;
+      const float* y;
+      float* lengths;
+      size_t count;
+    };
+
+    struct
+    NormalizeParams {
+      float* x;
+      float* y;
+      size_t count;
+    };
+
+    struct
+    OverlapAABBParams {
+      AABB box;
+      ConstAABBSpan boxes;
+      uint8_t* hits;
+    };
+
+    struct
+    RaycastCirclesParams {
+      Ray ray;
+      ConstCircleSpan circles;
+      float* distances;
+    };
+
+    // Aristas del polígono (a, b) precalculadas: a.x, a.y, b.y y (b.x - a.x) / (b.y - a.y).
+    struct
+    PolygonParams {
+      const float* edgeX;
+      const float* edgeY0;
+      const float* edgeY1;
+      const float* slope;
+      size_t edgeCount;
+      ConstVector2Span points;
+      uint8_t* inside;
+    };
+
+    // Kernels de un conjunto de instrucciones.
+    struct
+    KernelTable {
+      void (*seek)(const SeekParams&);
+      void (*translate)(const TranslateParams&);
+      void (*integrate)(const IntegrateParams&);
+      void (*rotateScale)(const RotateScaleParams&);
+      void (*length)(const LengthParams&);
+      void (*normalize)(const NormalizeParams&);
+      size_t (*overlapAABB)(const OverlapAABBParams&);
+      size_t (*raycastCircles)(const RaycastCirclesParams&);
+      size_t (*pointsInPolygon)(const PolygonParams&);
+    };
+
+    // Kernels AVX2, definidos en MathBatchAVX2.cpp; nullptr fuera de x86.
+    const KernelTable*
+    getAvx2Kernels();
+  }
+}
+
+namespace {
+  using namespace MathBatch;
+  using namespace MathBatch::detail;
+
+  inline float
+  scalarAt(const BatchScalars& scalars, size_t i) {
+    return scalars.values ? scalars.values[i] : scalars.value;
+  }
+
+  // ---------------------------------------------------------------------------
+  // Versiones escalares. También procesan los elementos que sobran de los kernels SIMD.
+  // ---------------------------------------------------------------------------
+
+  MATHBATCH_TARGET inline void
+  seekScalar(const SeekParams& p, size_t begin) {
+    for (size_t i = begin; i < p.count; ++i) {
+      const float dx = (p.targetX ? p.targetX[i] : p.uniformTargetX) - p.x[i];
+      const float dy = (p.targetY ? p.targetY[i] : p.uniformTargetY) - p.y[i];
+      const float length = MathEngine::sqrt(dx * dx + dy * dy);
+      if (length > p.range && length > 0.0f) {
+        const float step = scalarAt(p.speeds, i) * p.deltaTime / length;
+        p.x[i] += dx * step;
+        p.y[i] += dy * step;
+      }
+    }
+  }
+
+  MATHBATCH_TARGET inline void
+  translateScalar(const TranslateParams& p, size_t begin) {
+    for (size_t i = begin; i < p.count; ++i) {
+      p.x[i] += (p.offsetX ? p.offsetX[i] * p.factor : p.uniformOffsetX);
+      p.y[i] += (p.offsetY ? p.offsetY[i] * p.factor : p.uniformOffsetY);
+    }
+  }
+
+  MATHBATCH_TARGET inline void
+  integrateScalar(const IntegrateParams& p, size_t begin) {
+    for (size_t i = begin; i < p.count; ++i) {
+      p.velocityX[i] += p.velocityStepX;
+      p.velocityY[i] += p.velocityStepY;
+      p.x[i] += p.velocityX[i] * p.deltaTime;
+      p.y[i] += p.velocityY[i] * p.deltaTime;
+      if (p.timers) {
+        p.timers[i] -= p.deltaTime;
+      }
+    }
+  }
+
+  MATHBATCH_TARGET inline void
+  rotateScaleScalar(const RotateScaleParams& p, size_t begin) {
+    float sine = 0.0f;
+    float cosine = 1.0f;
+    if (!p.angles.values) {
+      MathEngine::sincos(p.angles.value, sine, cosine);
+    }
+    for (size_t i = begin; i < p.count; ++i) {
+      if (p.angles.values) {
+        MathEngine::sincos(p.angles.values[i], sine, cosine);
+      }
+      const float sx = p.x[i] * scalarAt(p.scaleX, i);
+      const float sy = p.y[i] * scalarAt(p.scaleY, i);
+      p.x[i] = cosine * sx - sine * sy;
+      p.y[i] = sine * sx + cosine * sy;
+    }
+  }
+
+  MATHBATCH_TARGET inline void
+  lengthScalar(const LengthParams& p, size_t begin) {
+    for (size_t i = begin; i < p.count; ++i) {
+      p.lengths[i] = MathEngine::sqrt(p.x[i] * p.x[i] + p.y[i] * p.y[i]);
+    }
+  }
+
+  MATHBATCH_TARGET inline void
+  normalizeScalar(const NormalizeParams& p, size_t begin) {
+    for (size_t i = begin; i < p.count; ++i) {
+      const float inverse = MathEngine::rsqrt(p.x[i] * p.x[i] + p.y[i] * p.y[i]); // 0 si la magnitud es 0.
+      p.x[i] *= inverse;
+      p.y[i] *= inverse;
+    }
+  }
+
+  // Las pruebas geométricas devuelven el número de aciertos (o el índice más cercano)
+  // a partir de begin.
+  MATHBATCH_TARGET inline size_t
+  overlapAABBScalar(const OverlapAABBParams& p, size_t begin) {
+    size_t hitCount = 0;
+    for (size_t i = begin; i < p.boxes.count; ++i) {
+      const AABB other(Vector2(p.boxes.minX[i], p.boxes.minY[i]), Vector2(p.boxes.maxX[i], p.boxes.maxY[i]));
+      p.hits[i] = p.box.overlaps(other) ? 1 : 0;
+      hitCount += p.hits[i];
+    }
+    return hitCount;
+  }
+
+  // nearest es el índice más cercano hasta begin (kNoHit si no hay).
+  MATHBATCH_TARGET inline size_t
+  raycastCirclesScalar(const RaycastCirclesParams& p, size_t begin, size_t nearest) {
+    for (size_t i = begin; i < p.circles.count; ++i) {
+      float t = 0.0f;
+      const Circle circle(Vector2(p.circles.x[i], p.circles.y[i]), p.circles.radius[i]);
+      p.distances[i] = p.ray.intersect(circle, t) ? t : std::numeric_limits<float>::infinity();
+      if (p.distances[i] != std::numeric_limits<float>::infinity() &&
+          (nearest == kNoHit || p.distances[i] < p.distances[nearest])) {
+        nearest = i;
+      }
+    }
+    return nearest;
+  }
+
+  MATHBATCH_TARGET inline size_t
+  pointsInPolygonScalar(const PolygonParams& p, size_t begin) {
+    size_t insideCount = 0;
+    for (size_t i = begin; i < p.points.count; ++i) {
+      const float x = p.points.x[i];
+      const float y = p.points.y[i];
+      bool inside = false;
+      for (size_t e = 0; e < p.edgeCount; ++e) {
+        if ((p.edgeY0[e] > y) != (p.edgeY1[e] > y) && (y - p.edgeY0[e]) * p.slope[e] + p.edgeX[e] > x) {
+          inside = !inside;
+        }
+      }
+      p.inside[i] = inside ? 1 : 0;
+      insideCount += p.inside[i];
+    }
+    return insideCount;
+  }
+
+  // ---------------------------------------------------------------------------
+  // Kernels SIMD genéricos sobre un tipo de carriles L.
+  // ---------------------------------------------------------------------------
+
+  // Parámetro por elemento o uniforme ya cargado en un registro.
+  template<typename L>
+  struct
+  LaneScalars {
+    const float* values;
+    typename L::Float uniform;
+
+    MATHBATCH_TARGET explicit LaneScalars(const BatchScalars& scalars)
+      : values(scalars.values), uniform(L::set1(scalars.value)) {}
+
+    MATHBATCH_TARGET typename L::Float
+    at(size_t i) const { return values ? L::load(values + i) : uniform; }
+  };
+
+  template<typename L>
+  MATHBATCH_TARGET void
+  seekSimd(const SeekParams& p) {
+    using F = typename L::Float;
+    const LaneScalars<L> speeds(p.speeds);
+    const F targetX = L::set1(p.uniformTargetX);
+    const F targetY = L::set1(p.uniformTargetY);
+    const F deltaTime = L::set1(p.deltaTime);
+    const F range = L::set1(p.range);
+    const F zero = L::set1(0.0f);
+
+    size_t i = 0;
+    for (; i + L::kWidth <= p.count; i += L::kWidth) {
+      const F x = L::load(p.x + i);
+      const F y = L::load(p.y + i);
+      const F dx = L::sub(p.targetX ? L::load(p.targetX + i) : targetX, x);
+      const F dy = L::sub(p.targetY ? L::load(p.targetY + i) : targetY, y);
+      const F length = L::sqrt(L::fmadd(dx, dx, L::mul(dy, dy)));
+      // Con length = 0 el paso es infinito, pero la máscara lo descarta.
+      const F move = L::bitAnd(L::greater(length, range), L::greater(length, zero));
+      const F step = L::div(L::mul(speeds.at(i), deltaTime), length);
+      L::store(p.x + i, L::add(x, L::bitAnd(move, L::mul(dx, step))));
+      L::store(p.y + i, L::add(y, L::bitAnd(move, L::mul(dy, step))));
+    }
+    seekScalar(p, i);
+  }
+
+  template<typename L>
+  MATHBATCH_TARGET void
+  translateSimd(const TranslateParams& p) {
+    using F = typename L::Float;
+    const F offsetX = L::set1(p.uniformOffsetX);
+    const F offsetY = L::set1(p.uniformOffsetY);
+    const F factor = L::set1(p.factor);
+
+    size_t i = 0;
+    for (; i + L::kWidth <= p.count; i += L::kWidth) {
+      const F x = L::load(p.x + i);
+      const F y = L::load(p.y + i);
+      L::store(p.x + i, p.offsetX ? L::fmadd(L::load(p.offsetX + i), factor, x) : L::add(x, offsetX));
+      L::store(p.y + i, p.offsetY ? L::fmadd(L::load(p.offsetY + i), factor, y) : L::add(y, offsetY));
+    }
+    translateScalar(p, i);
+  }
+
+  // Sin fmadd: el resultado es idéntico bit a bit al de integrateScalar.
+  template<typename L>
+  MATHBATCH_TARGET void
+  integrateSimd(const IntegrateParams& p) {
+    using F = typename L::Float;
+    const F stepX = L::set1(p.velocityStepX);
+    const F stepY = L::set1(p.velocityStepY);
+    const F deltaTime = L::set1(p.deltaTime);
+
+    size_t i = 0;
+    for (; i + L::kWidth <= p.count; i += L::kWidth) {
+      const F vx = L::add(L::load(p.velocityX + i), stepX);
+      const F vy = L::add(L::load(p.velocityY + i), stepY);
+      L::store(p.velocityX + i, vx);
+      L::store(p.velocityY + i, vy);
+      L::store(p.x + i, L::add(L::load(p.x + i), L::mul(vx, deltaTime)));
+      L::store(p.y + i, L::add(L::load(p.y + i), L::mul(vy, deltaTime)));
+      if (p.timers) {
+        L::store(p.timers + i, L::sub(L::load(p.timers + i), deltaTime));
+      }
+    }
+    integrateScalar(p, i);
+  }
+
+  /**
+   * @brief sincos en carriles con reducción de Cody-Waite y polinomios en float; error
+   * absoluto menor que kBatchSinCosError para |angle| <= kBatchAngleRange.
+   */
+  template<typename L>
+  MATHBATCH_TARGET void
+  sincosLanes(typename L::Float angle, typename L::Float& sine, typename L::Float& cosine) {
+    using F = typename L::Float;
+    namespace me = MathEngine::detail;
+    const F magic = L::set1(me::ROUND_MAGIC);
+    const F k = L::sub(L::fmadd(angle, L::set1(me::TWO_OVER_PI), magic), magic);
+    F r = L::sub(angle, L::mul(k, L::set1(me::PIO2_1)));
+    r = L::sub(r, L::mul(k, L::set1(me::PIO2_2)));
+    r = L::sub(r, L::mul(k, L::set1(me::PIO2_3)));
+
+    const F r2 = L::mul(r, r);
+    F sinPoly = L::fmadd(r2, L::set1(-1.9515295891e-4f), L::set1(8.3321608736e-3f));
+    sinPoly = L::fmadd(r2, sinPoly, L::set1(-1.6666654611e-1f));
+    const F s = L::fmadd(L::mul(r, r2), sinPoly, r);
+    F cosPoly = L::fmadd(r2, L::set1(2.443315711809948e-5f), L::set1(-1.388731625493765e-3f));
+    cosPoly = L::fmadd(r2, cosPoly, L::set1(4.166664568298827e-2f));
+    const F c = L::fmadd(L::mul(r2, r2), cosPoly, L::fmadd(L::set1(-0.5f), r2, L::set1(1.0f)));
+
+    F swap, sinSign, cosSign;
+    L::quadrantMasks(k, swap, sinSign, cosSign);
+    sine = L::bitXor(L::select(swap, c, s), sinSign);
+    cosine = L::bitXor(L::select(swap, s, c), cosSign);
+  }
+
+  template<typename L>
+  MATHBATCH_TARGET void
+  rotateScaleSimd(const RotateScaleParams& p) {
+    using F = typename L::Float;
+    const LaneScalars<L> scaleX(p.scaleX);
+    const LaneScalars<L> scaleY(p.scaleY);
+    float uniformSine = 0.0f;
+    float uniformCosine = 1.0f;
+    if (!p.angles.values) {
+      MathEngine::sincos(p.angles.value, uniformSine, uniformCosine);
+    }
+    F sine = L::set1(uniformSine);
+    F cosine = L::set1(uniformCosine);
+
+    size_t i = 0;
+    for (; i + L::kWidth <= p.count; i += L::kWidth) {
+      if (p.angles.values) {
+        sincosLanes<L>(L::load(p.angles.values + i), sine, cosine);
+      }
+      const F sx = L::mul(L::load(p.x + i), scaleX.at(i));
+      const F sy = L::mul(L::load(p.y + i), scaleY.at(i));
+      L::store(p.x + i, L::sub(L::mul(cosine, sx), L::mul(sine, sy)));
+      L::store(p.y + i, L::fmadd(sine, sx, L::mul(cosine, sy)));
+    }
+    rotateScaleScalar(p, i);
+  }
+
+  template<typename L>
+  MATHBATCH_TARGET void
+  lengthSimd(const LengthParams& p) {
+    using F = typename L::Float;
+    size_t i = 0;
+    for (; i + L::kWidth <= p.count; i += L::kWidth) {
+      const F x = L::load(p.x + i);
+      const F y = L::load(p.y + i);
+      L::store(p.lengths + i, L::sqrt(L::fmadd(x, x, L::mul(y, y))));
+    }
+    lengthScalar(p, i);
+  }
+
+  template<typename L>
+  MATHBATCH_TARGET void
+  normalizeSimd(const NormalizeParams& p) {
+    using F = typename L::Float;
+    const F zero = L::set1(0.0f);
+    size_t i = 0;
+    for (; i + L::kWidth <= p.count; i += L::kWidth) {
+      const F x = L::load(p.x + i);
+      const F y = L::load(p.y + i);
+      const F lengthSquared = L::fmadd(x, x, L::mul(y, y));
+      // rsqrt(0) es infinito; la máscara deja esos vectores en 0.
+      const F inverse = L::bitAnd(L::greater(lengthSquared, zero), L::rsqrt(lengthSquared));
+      L::store(p.x + i, L::mul(x, inverse));
+      L::store(p.y + i, L::mul(y, inverse));
+    }
+    normalizeScalar(p, i);
+  }
+
+  // Escribe los bits de una máscara como valores 0 o 1 y devuelve cuántos son 1.
+  template<typename L>
+  MATHBATCH_TARGET size_t
+  storeMask(uint8_t* out, unsigned int bits) {
+    size_t count = 0;
+    for (size_t j = 0; j < L::kWidth; ++j) {
+      out[j] = static_cast<uint8_t>((bits >> j) & 1u);
+      count += out[j];
+    }
+    return count;
+  }
+
+  template<typename L>
+  MATHBATCH_TARGET size_t
+  overlapAABBSimd(const OverlapAABBParams& p) {
+    using F = typename L::Float;
+    const F minX = L::set1(p.box.min.x);
+    const F minY = L::set1(p.box.min.y);
+    const F maxX = L::set1(p.box.max.x);
+    const F maxY = L::set1(p.box.max.y);
+    size_t hitCount = 0;
+    size_t i = 0;
+    for (; i + L::kWidth <= p.boxes.count; i += L::kWidth) {
+      const F overlapX = L::bitAnd(L::lessEqual(minX, L::load(p.boxes.maxX + i)),
+                                   L::lessEqual(L::load(p.boxes.minX + i), maxX));
+      const F overlapY = L::bitAnd(L::lessEqual(minY, L::load(p.boxes.maxY + i)),
+                                   L::lessEqual(L::load(p.boxes.minY + i), maxY));
+      hitCount += storeMask<L>(p.hits + i, L::mask(L::bitAnd(overlapX, overlapY)));
+    }
+    return hitCount + overlapAABBScalar(p, i);
+  }
+
+  template<typename L>
+  MATHBATCH_TARGET size_t
+  raycastCirclesSimd(const RaycastCirclesParams& p) {
+    using F = typename L::Float;
+    const F originX = L::set1(p.ray.origin.x);
+    const F originY = L::set1(p.ray.origin.y);
+    const F directionX = L::set1(p.ray.direction.x);
+    const F directionY = L::set1(p.ray.direction.y);
+    const F zero = L::set1(0.0f);
+    const F infinity = L::set1(std::numeric_limits<float>::infinity());
+    size_t nearest = kNoHit;
+    F nearestDistance = infinity;
+    size_t i = 0;
+    for (; i + L::kWidth <= p.circles.count; i += L::kWidth) {
+      const F mx = L::sub(L::load(p.circles.x + i), originX);
+      const F my = L::sub(L::load(p.circles.y + i), originY);
+      const F radius = L::load(p.circles.radius + i);
+      const F b = L::add(L::mul(mx, directionX), L::mul(my, directionY));
+      const F c = L::sub(L::add(L::mul(mx, mx), L::mul(my, my)), L::mul(radius, radius));
+      const F discriminant = L::sub(L::mul(b, b), c);
+      // Mismas condiciones que Ray::intersect: afuera y alejándose, o sin raíces reales.
+      const F away = L::bitAnd(L::greater(c, zero), L::greater(zero, b));
+      const F miss = L::bitOr(away, L::greater(zero, discriminant));
+      const F t = L::max(L::sub(b, L::sqrt(L::max(discriminant, zero))), zero);
+      const F distance = L::select(miss, infinity, t);
+      L::store(p.distances + i, distance);
+      // Los círculos más cercanos son raros después de los primeros grupos.
+      if (L::mask(L::greater(nearestDistance, distance))) {
+        for (size_t j = i; j < i + L::kWidth; ++j) {
+          if (p.distances[j] != std::numeric_limits<float>::infinity() &&
+              (nearest == kNoHit || p.distances[j] < p.distances[nearest])) {
+            nearest = j;
+          }
+        }
+        nearestDistance = L::set1(p.distances[nearest]);
+      }
+    }
+    return raycastCirclesScalar(p, i, nearest);
+  }
+
+  template<typename L>
+  MATHBATCH_TARGET size_t
+  pointsInPolygonSimd(const PolygonParams& p) {
+    using F = typename L::Float;
+    size_t insideCount = 0;
+    size_t i = 0;
+    for (; i + L::kWidth <= p.points.count; i += L::kWidth) {
+      const F x = L::load(p.points.x + i);
+      const F y = L::load(p.points.y + i);
+      F inside = L::set1(0.0f);
+      for (size_t e = 0; e < p.edgeCount; ++e) {
+        const F y0 = L::set1(p.edgeY0[e]);
+        // Con una arista horizontal la pendiente es infinita, pero la arista no cruza.
+        const F crosses = L::bitXor(L::greater(y0, y), L::greater(L::set1(p.edgeY1[e]), y));
+        const F edgeX = L::add(L::mul(L::sub(y, y0), L::set1(p.slope[e])), L::set1(p.edgeX[e]));
+        inside = L::bitXor(inside, L::bitAnd(crosses, L::greater(edgeX, x)));
+      }
+      insideCount += storeMask<L>(p.inside + i, L::mask(inside));
+    }
+    return insideCount + pointsInPolygonScalar(p, i);
+  }
+
+  template<typename L>
+  KernelTable
+  makeKernelTable() {
+    KernelTable table;
+    table.seek = &seekSimd<L>;
+    table.translate = &translateSimd<L>;
+    table.integrate = &integrateSimd<L>;
+    table.rotateScale = &rotateScaleSimd<L>;
+    table.length = &lengthSimd<L>;
+    table.normalize = &normalizeSimd<L>;
+    table.overlapAABB = &overlapAABBSimd<L>;
+    table.raycastCircles = &raycastCirclesSimd<L>;
+    table.pointsInPolygon = &pointsInPolygonSimd<L>;
+    return table;
+  }
+}
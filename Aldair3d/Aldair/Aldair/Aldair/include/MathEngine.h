@@ -1,51 +1,425 @@
 #pragma once
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define MATHENGINE_HAS_SSE 1
+#endif
+
+/**
+ * @brief Indica si la funcin constexpr se est evaluando en tiempo de compilacin.
+ * Las funciones de la biblioteca matemtica lo usan para tomar la ruta escalar en
+ * expresiones constantes y las rutas SIMD o con memcpy en tiempo de ejecucin.
+ * Requiere C++20 o el builtin de MSVC (VS 2019 16.5+), GCC 9+ o Clang 9+; sin l las
+ * funciones siguen funcionando en tiempo de ejecucin, pero no en expresiones constantes.
+ */
+#if defined(__cpp_lib_is_constant_evaluated)
+#include <type_traits>
+#define MATHENGINE_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#define MATHENGINE_HAS_CONSTEXPR 1
+#elif defined(__GNUC__) || defined(__clang__) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define MATHENGINE_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#define MATHENGINE_HAS_CONSTEXPR 1
+#else
+#define MATHENGINE_IS_CONSTANT_EVALUATED() false
+#define MATHENGINE_HAS_CONSTEXPR 0
+#endif
+
 namespace MathEngine {
 	//Codigo Proporcionado: "Roberto Charreton".
 	// Constantes matemticas
 	constexpr float PI = 3.14159265358979323846f;
 	constexpr float E = 2.71828182845904523536f;
+	constexpr float HALF_PI = 1.57079632679489661923f;
+	constexpr float TWO_PI = 6.28318530717958647692f;
 
 	/**
-	 * @brief Calcula la raz cuadrada mediante el mtodo Newton-Raphson.
-	 * El valor para calcular la raz cuadrada de la raz cuadrada calculada.
-	*/
-	inline float sqrt(float value) {
-		if (value < 0) {
-			return 0;
+	 * @brief Contratos de precisin, en ULP (unidades en la ltima posicin) respecto al
+	 * resultado exacto redondeado a float. Los verifica "Aldair3dBench --check" con
+	 * barridos uniformes y densos cerca de k * pi/2 y de los cortes de atan; un cambio
+	 * en las funciones debe mantenerlos.
+	 * sin, cos, sincos y tan los cumplen para |x| <= TRIG_ACCURATE_RANGE; fuera de ese
+	 * rango el resultado sigue siendo finito y acotado, pero sin contrato.
+	 * Todas las funciones son constexpr y dan el mismo resultado, bit a bit, en tiempo de
+	 * compilacin que en tiempo de ejecucin siempre que el compilador no contraiga
+	 * a * b + c en una FMA: la evaluacin constante redondea cada operacin por separado.
+	 * Los proyectos fijan /fp:precise (sin /fp:contract) y en GCC o Clang hay que compilar
+	 * con -ffp-contract=off; "Aldair3dBench --check" lo verifica.
+	 */
+	constexpr float SQRT_MAX_ULP = 1.0f;
+	constexpr float RSQRT_MAX_ULP = 3.0f;
+	constexpr float SIN_MAX_ULP = 1.0f;
+	constexpr float COS_MAX_ULP = 1.0f;
+	constexpr float TAN_MAX_ULP = 1.0f;
+	constexpr float ATAN_MAX_ULP = 1.0f;
+	constexpr float ATAN2_MAX_ULP = 2.0f;
+	constexpr float TRIG_ACCURATE_RANGE = 1.0e6f;
+
+	namespace detail {
+		/**
+		 * @brief Bits IEEE 754 de value calculados con aritmtica, para expresiones
+		 * constantes (C++17 no tiene std::bit_cast). Escalar por potencias de 2 es exacto.
+		 * El signo de -0 no se distingue y todo NaN se representa como el NaN silencioso.
+		 */
+		constexpr uint32_t toBitsConstant(float value) {
+			if (value != value) {
+				return 0x7fc00000u;
+			}
+			const uint32_t sign = value < 0.0f ? 0x80000000u : 0u;
+			float magnitude = sign ? -value : value;
+			if (magnitude == 0.0f) {
+				return sign;
+			}
+			if (magnitude > std::numeric_limits<float>::max()) {
+				return sign | 0x7f800000u;
+			}
+			int exponent = 0;
+			while (magnitude >= 2.0f) {
+				magnitude *= 0.5f;
+				++exponent;
+			}
+			while (magnitude < 1.0f) {
+				magnitude *= 2.0f;
+				--exponent;
+			}
+			if (exponent < -126) {
+				// Subnormal: la mantisa es value * 2^149.
+				for (int i = 0; i < exponent + 149; ++i) {
+					magnitude *= 2.0f;
+				}
+				return sign | static_cast<uint32_t>(magnitude);
+			}
+			const uint32_t mantissa = static_cast<uint32_t>((magnitude - 1.0f) * 8388608.0f);
+			return sign | (static_cast<uint32_t>(exponent + 127) << 23) | mantissa;
+		}
+
+		// Inverso de toBitsConstant: arma el float a partir de sus bits.
+		constexpr float fromBitsConstant(uint32_t bits) {
+			const bool negative = (bits & 0x80000000u) != 0;
+			const int exponent = static_cast<int>((bits >> 23) & 0xffu);
+			const uint32_t mantissa = bits & 0x7fffffu;
+			float value = 0.0f;
+			if (exponent == 0xff) {
+				value = mantissa ? std::numeric_limits<float>::quiet_NaN()
+				                 : std::numeric_limits<float>::infinity();
+			}
+			else if (exponent == 0) {
+				value = static_cast<float>(mantissa) * std::numeric_limits<float>::denorm_min();
+			}
+			else {
+				value = static_cast<float>(mantissa | 0x800000u);
+				for (int i = exponent - 150; i > 0; --i) {
+					value *= 2.0f;
+				}
+				for (int i = exponent - 150; i < 0; ++i) {
+					value *= 0.5f;
+				}
+			}
+			return negative ? -value : value;
+		}
+
+		constexpr uint32_t toBits(float value) {
+			if (MATHENGINE_IS_CONSTANT_EVALUATED()) {
+				return toBitsConstant(value);
+			}
+			uint32_t bits = 0;
+			std::memcpy(&bits, &value, sizeof(bits));
+			return bits;
 		}
-		float x = value;
-		float y = 1.0f;
-		float epsilon = 0.00001f; // Precisin deseada en el calculo.
-		while (x - y > epsilon) {
-			x = (x + y) / 2.0f;
-			y = value / x;
+
+		constexpr float fromBits(uint32_t bits) {
+			if (MATHENGINE_IS_CONSTANT_EVALUATED()) {
+				return fromBitsConstant(bits);
+			}
+			float value = 0.0f;
+			std::memcpy(&value, &bits, sizeof(value));
+			return value;
+		}
+
+		// Cambia el signo de value si bit (0 o 0x80000000) est encendido.
+		constexpr float flipSign(float value, uint32_t bit) {
+			if (MATHENGINE_IS_CONSTANT_EVALUATED()) {
+				return bit ? -value : value;
+			}
+			return fromBits(toBits(value) ^ bit);
+		}
+
+		// Distancia en ULP entre dos floats finitos (0 si son iguales).
+		constexpr uint32_t ulpDistance(float a, float b) {
+			// Ordena los bits para que sean montonos en toda la recta real.
+			const uint32_t bitsA = toBits(a);
+			const uint32_t bitsB = toBits(b);
+			const uint32_t orderedA = (bitsA & 0x80000000u) ? 0x80000000u - (bitsA & 0x7fffffffu) : 0x80000000u + bitsA;
+			const uint32_t orderedB = (bitsB & 0x80000000u) ? 0x80000000u - (bitsB & 0x7fffffffu) : 0x80000000u + bitsB;
+			return orderedA > orderedB ? orderedA - orderedB : orderedB - orderedA;
+		}
+
+		/**
+		 * @brief fmod(x, y) exacto para y > 0, por divisin larga: cada resta de
+		 * y * 2^k <= |x| < y * 2^(k+1) es exacta (lema de Sterbenz). Da el mismo
+		 * resultado que std::fmod y se puede evaluar en expresiones constantes.
+		 */
+		constexpr double fmodConstant(double x, double y) {
+			double remainder = x < 0.0 ? -x : x;
+			while (remainder >= y) {
+				double divisor = y;
+				while (divisor * 2.0 <= remainder) {
+					divisor *= 2.0;
+				}
+				remainder -= divisor;
+			}
+			return x < 0.0 ? -remainder : remainder;
 		}
-		return x;
+
+		/**
+		 * @brief Raz cuadrada correctamente redondeada para expresiones constantes.
+		 * Escala el valor a [1, 4) por potencias de 4, itera Newton-Raphson en double y
+		 * redondea a float; coincide con sqrtss.
+		 */
+		constexpr float sqrtConstant(float value) {
+			double x = value;
+			double scale = 1.0;
+			while (x >= 4.0) {
+				x *= 0.25;
+				scale *= 2.0;
+			}
+			while (x < 1.0) {
+				x *= 4.0;
+				scale *= 0.5;
+			}
+			double y = 1.5;
+			for (int i = 0; i < 6; ++i) {
+				y = 0.5 * (y + x / y);
+			}
+			return static_cast<float>(y * scale);
+		}
+
+		constexpr float TWO_OVER_PI = 0.63661977236758134308f;
+		// Sumar y restar 1.5 * 2^23 redondea al entero ms cercano sin saltos.
+		constexpr float ROUND_MAGIC = 12582912.0f;
+		/**
+		 * pi/2 partido en tres floats (Cody-Waite): k * PIO2_1 y k * PIO2_2 son exactos.
+		 * Solo lo usa la ruta SIMD de MathBatch; cerca de mltiplos de pi/2 pierde bits
+		 * relativos, por eso las funciones escalares reducen en double.
+		 */
+		constexpr float PIO2_1 = 1.5703125f;
+		constexpr float PIO2_2 = 4.837512969970703125e-4f;
+		constexpr float PIO2_3 = 7.54978995489188216e-8f;
+
+		constexpr double TWO_OVER_PI_D = 0.63661977236758134308;
+		// Igual que ROUND_MAGIC, con 1.5 * 2^52.
+		constexpr double ROUND_MAGIC_D = 6755399441055744.0;
+		// pi/2 en dos doubles: los 33 bits altos (k * PIO2_1D es exacto) y el resto.
+		constexpr double PIO2_1D = 1.5707963267341256;
+		constexpr double PIO2_2D = 6.0771005065061922e-11;
+		constexpr float QUARTER_PI = 0.785398163397448309616f;
+
+		/**
+		 * @brief Reduce un ngulo a r en [-pi/4, pi/4] con angle = r + quadrant * pi/2.
+		 * La reduccin es en double: para todo float |angle| <= TRIG_ACCURATE_RANGE el
+		 * error de r es menor que 2^-60 * |r|, aun en los floats ms cercanos a k * pi/2.
+		 * Los ngulos fuera de TRIG_ACCURATE_RANGE se pliegan antes con fmod; los no
+		 * finitos devuelven NaN.
+		 */
+		constexpr double reduceHalfPi(float angle, int& quadrant) {
+			quadrant = 0;
+			if (angle <= QUARTER_PI && angle >= -QUARTER_PI) {
+				return angle;
+			}
+			double x = angle;
+			if (!(angle <= TRIG_ACCURATE_RANGE && angle >= -TRIG_ACCURATE_RANGE)) {
+				if (!(angle <= std::numeric_limits<float>::max() && angle >= -std::numeric_limits<float>::max())) {
+					return std::numeric_limits<double>::quiet_NaN();
+				}
+				x = MATHENGINE_IS_CONSTANT_EVALUATED()
+					? fmodConstant(x, 6.283185307179586)
+					: std::fmod(x, 6.283185307179586);
+			}
+			const double k = (x * TWO_OVER_PI_D + ROUND_MAGIC_D) - ROUND_MAGIC_D;
+			quadrant = static_cast<int>(k);
+			return (x - k * PIO2_1D) - k * PIO2_2D;
+		}
+
+		// Polinomio minimax de grado 9 para sin en [-pi/4, pi/4], en double (< 2^-37).
+		constexpr double sinKernel(double r) {
+			const double z = r * r;
+			const double w = z * z;
+			const double s = z * r;
+			return (r + s * (-0.166666666416265235595 + z * 0.0083333293858894631756)) +
+				s * w * (-0.000198393348360966317347 + z * 0.0000027183114939898219064);
+		}
+
+		// Polinomio minimax de grado 8 para cos en [-pi/4, pi/4], en double (< 2^-34).
+		constexpr double cosKernel(double r) {
+			const double z = r * r;
+			const double w = z * z;
+			return ((1.0 + z * -0.499999997251031003120) + w * 0.0416666233237390631894) +
+				(w * z) * (-0.00138867637746099294692 + z * 0.0000243904487962774090654);
+		}
+
+		// atan de los puntos de corte 0.5, 1, 1.5 e infinito, en parte alta y baja.
+		constexpr float ATAN_HI[4] = { 4.6364760399e-01f, 7.8539812565e-01f, 9.8279368877e-01f, 1.5707962513e+00f };
+		constexpr float ATAN_LO[4] = { 5.0121582440e-09f, 3.7748947079e-08f, 3.4473217170e-08f, 7.5497894159e-08f };
+		// pi en double; PI (float) difiere de pi en casi media ULP.
+		constexpr double PI_D = 3.14159265358979323846;
 	}
 
-	// Calcula el seno de un ngulo en radianes.
-	inline float sin(float angle) {
-		float result = 0.0f;
-		float term = angle;
-		float angle_squared = angle * angle;
-		int n = 1;
-		while (term > 1e-6f || term < -1e-6f) {
-			result += term;
-			term *= -angle_squared / ((2 * n) * (2 * n + 1));
-			++n;
+	/**
+	 * @brief Inversa de la raz cuadrada, 1 / sqrt(value).
+	 * Estimacin inicial por bits y tres pasos de Newton-Raphson, sin divisiones. Los
+	 * valores menores que 2^-102, subnormales incluidos, se escalan por 2^24 para que la
+	 * estimacin y 0.5 * value operen con floats normales.
+	 * Error mximo: RSQRT_MAX_ULP. Devuelve 0 para value <= 0 y para infinito.
+	 */
+	constexpr float rsqrt(float value) {
+		if (!(value > 0.0f && value <= std::numeric_limits<float>::max())) {
+			return 0.0f;
+		}
+		// rsqrt(x) = rsqrt(x * 2^24) * 2^12.
+		float scale = 1.0f;
+		if (value < std::numeric_limits<float>::min() * 16777216.0f) {
+			value *= 16777216.0f;
+			scale = 4096.0f;
 		}
-		return result;
+		const float half = 0.5f * value;
+		float y = detail::fromBits(0x5f375a86u - (detail::toBits(value) >> 1));
+		y = y * (1.5f - half * y * y);
+		y = y * (1.5f - half * y * y);
+		y = y * (1.5f - half * y * y);
+		return y * scale;
 	}
 
-	//Calcula el coseno de un ngulo en radianes
-	inline float cos(float angle) {
-		return sin(angle + PI / 2);
+	/**
+	 * @brief Calcula la raz cuadrada.
+	 * Con SSE usa la instruccin sqrtss (redondeo correcto); sin SSE parte de rsqrt y
+	 * aplica una correccin de Newton-Raphson. Ambas son de costo fijo. En expresiones
+	 * constantes se calcula con redondeo correcto, igual que sqrtss.
+	 * Error mximo: SQRT_MAX_ULP. Devuelve 0 para value <= 0.
+	 */
+	constexpr float sqrt(float value) {
+		if (!(value > 0.0f)) {
+			return 0.0f;
+		}
+		if (MATHENGINE_IS_CONSTANT_EVALUATED()) {
+			return value > std::numeric_limits<float>::max() ? value : detail::sqrtConstant(value);
+		}
+#ifdef MATHENGINE_HAS_SSE
+		return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(value)));
+#else
+		const float r = rsqrt(value);
+		const float y = value * r;
+		return y + 0.5f * r * (value - y * y);
+#endif
+	}
+
+	/**
+	 * @brief Calcula seno y coseno de un ngulo en radianes con una sola reduccin.
+	 * Los polinomios se evalan en double y el resultado se redondea una vez a float.
+	 * Error mximo: SIN_MAX_ULP y COS_MAX_ULP para |angle| <= TRIG_ACCURATE_RANGE.
+	 */
+	constexpr void sincos(float angle, float& sine, float& cosine) {
+		int quadrant = 0;
+		const double r = detail::reduceHalfPi(angle, quadrant);
+		const float s = static_cast<float>(detail::sinKernel(r));
+		const float c = static_cast<float>(detail::cosKernel(r));
+		const bool swap = (quadrant & 1) != 0;
+		sine = detail::flipSign(swap ? c : s, static_cast<uint32_t>(quadrant & 2) << 30);
+		cosine = detail::flipSign(swap ? s : c, static_cast<uint32_t>((quadrant + 1) & 2) << 30);
+	}
+
+	// Calcula el seno de un ngulo en radianes. Error mximo: SIN_MAX_ULP.
+	constexpr float sin(float angle) {
+		int quadrant = 0;
+		const double r = detail::reduceHalfPi(angle, quadrant);
+		const float value = static_cast<float>((quadrant & 1) ? detail::cosKernel(r) : detail::sinKernel(r));
+		return detail::flipSign(value, static_cast<uint32_t>(quadrant & 2) << 30);
+	}
+
+	// Calcula el coseno de un ngulo en radianes. Error mximo: COS_MAX_ULP.
+	constexpr float cos(float angle) {
+		int quadrant = 0;
+		const double r = detail::reduceHalfPi(angle, quadrant);
+		const float value = static_cast<float>((quadrant & 1) ? detail::sinKernel(r) : detail::cosKernel(r));
+		return detail::flipSign(value, static_cast<uint32_t>((quadrant + 1) & 2) << 30);
+	}
+
+	/**
+	 * @brief Calcula la tangente de un ngulo en radianes.
+	 * El cociente se calcula en double: en cuadrantes impares tan = -cos(r) / sin(r).
+	 * Error mximo: TAN_MAX_ULP.
+	 */
+	constexpr float tan(float angle) {
+		int quadrant = 0;
+		const double r = detail::reduceHalfPi(angle, quadrant);
+		const double s = detail::sinKernel(r);
+		const double c = detail::cosKernel(r);
+		if (quadrant & 1) {
+			return s != 0.0 ? static_cast<float>(-c / s) : 0.0f; // Evita la divisin por cero
+		}
+		return static_cast<float>(s / c);
 	}
 
-	//Calcula la tangente de un ngulo en radianes.
-	inline float tan(float angle) {
-		float s = sin(angle);
-		float c = cos(angle);
-		return c != 0.0f ? s / c : 0.0f; // Evita la divisin por cero
+	/**
+	 * @brief Calcula el arco tangente en [-pi/2, pi/2].
+	 * Reduce el argumento alrededor de 0.5, 1, 1.5 o infinito a |t| <= 7/16 y evala un
+	 * polinomio de grado 11; atan del punto de corte se suma en dos partes.
+	 * Error mximo: ATAN_MAX_ULP.
+	 */
+	constexpr float atan(float value) {
+		float x = value < 0.0f ? -value : value;
+		if (x < 2.44140625e-4f) { // 2^-12: atan(x) = x en float; conserva el signo de -0
+			return value;
+		}
+		int id = -1;
+		if (x < 0.4375f) {         // 7/16: sin reduccin
+			id = -1;
+		}
+		else if (x < 0.6875f) {    // 11/16
+			id = 0;
+			x = (2.0f * x - 1.0f) / (2.0f + x);
+		}
+		else if (x < 1.1875f) {    // 19/16
+			id = 1;
+			x = (x - 1.0f) / (x + 1.0f);
+		}
+		else if (x < 2.4375f) {    // 39/16
+			id = 2;
+			x = (x - 1.5f) / (1.0f + 1.5f * x);
+		}
+		else {
+			id = 3;
+			x = -1.0f / x;
+		}
+		const float z = x * x;
+		const float w = z * z;
+		const float s1 = z * (3.3333328366e-01f + w * (1.4253635705e-01f + w * 6.1687607318e-02f));
+		const float s2 = w * (-1.9999158382e-01f + w * -1.0648017377e-01f);
+		const float result = id < 0
+			? x - x * (s1 + s2)
+			: detail::ATAN_HI[id] - ((x * (s1 + s2) - detail::ATAN_LO[id]) - x);
+		return value < 0.0f ? -result : result;
+	}
+
+	/**
+	 * @brief ngulo del vector (x, y) en [-pi, pi].
+	 * Para x < 0 el signo de y decide entre pi y -pi, as que atan2(-0, -1) = -pi. En
+	 * expresiones constantes no se distingue -0 de 0 (ver detail::toBitsConstant).
+	 * Error mximo: ATAN2_MAX_ULP. Devuelve 0 para (0, 0).
+	 */
+	constexpr float atan2(float y, float x) {
+		if (x == 0.0f) {
+			if (y > 0.0f) return HALF_PI;
+			if (y < 0.0f) return -HALF_PI;
+			return 0.0f;
+		}
+		const float angle = atan(y / x);
+		if (x > 0.0f) {
+			return angle;
+		}
+		// La suma con pi en double evita el error de PI en float.
+		const bool negative = (detail::toBits(y) & 0x80000000u) != 0;
+		return static_cast<float>(negative ? angle - detail::PI_D : angle + detail::PI_D);
 	}
-};
\ No newline at end of file
+};
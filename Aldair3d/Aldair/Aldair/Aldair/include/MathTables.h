@@ -0,0 +1,207 @@
+#pragma once
+#include "Vector2.h"
+#include "Vector3.h"
+#include "Vector4.h"
+#include "Quaternion.h"
+#include "Matrix3x3.h"
+#include "Matrix4x4.h"
+#include "FixedVector2.h"
+#include "Geometry.h"
+#include <cstddef>
+
+static_assert(MATHENGINE_HAS_CONSTEXPR,
+              "MathTables requiere std::is_constant_evaluated o __builtin_is_constant_evaluated");
+
+/**
+ * @brief Tablas precalculadas en tiempo de compilación con la biblioteca matemática.
+ * Se generan con las mismas funciones constexpr que se usan en tiempo de ejecución, así
+ * que quedan guardadas en el ejecutable sin costo al arrancar; coinciden bit a bit con
+ * la evaluación en tiempo de ejecución si no hay contracción a FMA (ver MathEngine.h).
+ * Al final del archivo hay
+ * pruebas con static_assert de la biblioteca: si una falla, el proyecto no compila.
+ */
+namespace MathTables {
+  // Puntos de un polígono regular de N lados inscrito en el círculo unitario.
+  template<size_t N>
+  struct
+  UnitCircle {
+    Vector2 points[N];
+  };
+
+  /**
+   * @brief Genera el círculo unitario de N lados con la convención de sf::CircleShape:
+   * el primer punto está arriba (ángulo -pi/2) y los demás siguen en sentido horario
+   * en pantalla.
+   */
+  template<size_t N>
+  constexpr UnitCircle<N>
+  makeUnitCircle() {
+    UnitCircle<N> circle{};
+    for (size_t i = 0; i < N; ++i) {
+      const float angle = static_cast<float>(i) * MathEngine::TWO_PI / static_cast<float>(N) - MathEngine::HALF_PI;
+      float sine = 0.0f, cosine = 0.0f;
+      MathEngine::sincos(angle, sine, cosine);
+      circle.points[i] = Vector2(cosine, sine);
+    }
+    return circle;
+  }
+
+  // Círculos de los niveles de detalle de ShapePrototypeCache (8 a 128 lados).
+  inline constexpr UnitCircle<8> kUnitCircle8 = makeUnitCircle<8>();
+  inline constexpr UnitCircle<16> kUnitCircle16 = makeUnitCircle<16>();
+  inline constexpr UnitCircle<32> kUnitCircle32 = makeUnitCircle<32>();
+  inline constexpr UnitCircle<64> kUnitCircle64 = makeUnitCircle<64>();
+  inline constexpr UnitCircle<128> kUnitCircle128 = makeUnitCircle<128>();
+
+  // Círculo unitario precalculado de pointCount lados, o nullptr si no hay tabla.
+  constexpr const Vector2*
+  getUnitCircle(unsigned int pointCount) {
+    switch (pointCount) {
+    case 8: return kUnitCircle8.points;
+    case 16: return kUnitCircle16.points;
+    case 32: return kUnitCircle32.points;
+    case 64: return kUnitCircle64.points;
+    case 128: return kUnitCircle128.points;
+    default: return nullptr;
+    }
+  }
+
+  namespace detail {
+    // a y b difieren a lo más en tolerance.
+    constexpr bool
+    isNear(float a, float b, float tolerance) {
+      return (a > b ? a - b : b - a) <= tolerance;
+    }
+
+    // a y b difieren a lo más en maxUlp unidades en la última posición.
+    constexpr bool
+    isNearUlp(float a, float b, float maxUlp) {
+      return static_cast<float>(MathEngine::detail::ulpDistance(a, b)) <= maxUlp;
+    }
+
+    // Todos los puntos del círculo están a distancia 1 del origen.
+    template<size_t N>
+    constexpr bool
+    isUnitCircle(const UnitCircle<N>& circle) {
+      for (size_t i = 0; i < N; ++i) {
+        if (!isNear(circle.points[i].magnitude(), 1.0f, 1.0e-6f)) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    template<class Matrix>
+    constexpr bool
+    isIdentity(const Matrix& matrix, int size, float tolerance) {
+      for (int i = 0; i < size; ++i) {
+        for (int j = 0; j < size; ++j) {
+          if (!isNear(matrix.m[i][j], i == j ? 1.0f : 0.0f, tolerance)) {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+  }
+}
+
+// Pruebas en tiempo de compilación de la biblioteca matemática.
+namespace MathTables {
+  namespace detail {
+    // Bits IEEE 754.
+    static_assert(MathEngine::detail::toBits(1.0f) == 0x3f800000u, "toBits(1)");
+    static_assert(MathEngine::detail::toBits(-2.0f) == 0xc0000000u, "toBits(-2)");
+    static_assert(MathEngine::detail::toBits(std::numeric_limits<float>::denorm_min()) == 1u, "toBits(subnormal)");
+    static_assert(MathEngine::detail::fromBits(0x40490fdbu) == MathEngine::PI, "fromBits(pi)");
+    static_assert(MathEngine::detail::fromBits(MathEngine::detail::toBits(0.1f)) == 0.1f, "ida y vuelta de bits");
+
+    // Raíces: sqrt redondea correctamente y rsqrt cumple su contrato.
+    static_assert(MathEngine::sqrt(4.0f) == 2.0f, "sqrt(4)");
+    static_assert(MathEngine::sqrt(2.0f) == 1.41421354f, "sqrt(2)");
+    static_assert(MathEngine::sqrt(0.0f) == 0.0f && MathEngine::sqrt(-1.0f) == 0.0f, "sqrt(x <= 0)");
+    static_assert(isNearUlp(MathEngine::rsqrt(3.0f), 0.577350259f, MathEngine::RSQRT_MAX_ULP), "rsqrt(3)");
+
+    // Trigonometría: referencias redondeadas a float y contratos de precisión.
+    static_assert(MathEngine::sin(0.0f) == 0.0f && MathEngine::cos(0.0f) == 1.0f, "sin(0) y cos(0)");
+    static_assert(isNearUlp(MathEngine::sin(1.0f), 0.841470957f, MathEngine::SIN_MAX_ULP), "sin(1)");
+    static_assert(isNearUlp(MathEngine::cos(1.0f), 0.540302277f, MathEngine::COS_MAX_ULP), "cos(1)");
+    static_assert(isNearUlp(MathEngine::tan(0.5f), 0.546302497f, MathEngine::TAN_MAX_ULP), "tan(0.5)");
+    static_assert(isNearUlp(MathEngine::sin(100000.0f), 0.0357487984f, MathEngine::SIN_MAX_ULP), "sin(1e5)");
+    static_assert(isNearUlp(MathEngine::cos(1.0e6f), 0.936752141f, MathEngine::COS_MAX_ULP), "cos(1e6)");
+    static_assert(isNearUlp(MathEngine::atan(1.0f), 0.25f * MathEngine::PI, MathEngine::ATAN_MAX_ULP), "atan(1)");
+    static_assert(isNearUlp(MathEngine::atan2(-1.0f, -1.0f), -2.3561945f, MathEngine::ATAN2_MAX_ULP), "atan2(-1, -1)");
+
+    // Vectores.
+    static_assert((Vector2(1.0f, 2.0f) + Vector2(3.0f, 4.0f)).x == 4.0f, "Vector2 +");
+    static_assert(Vector2(3.0f, 4.0f).magnitude() == 5.0f, "Vector2 magnitude");
+    static_assert(Vector2(3.0f, 4.0f).normalize().x == 0.6f, "Vector2 normalize");
+    static_assert((Vector2(1.0f, 1.0f) / 0.0f).x == 0.0f, "Vector2 / 0");
+    static_assert(Vector3(2.0f, 3.0f, 6.0f).magnitude() == 7.0f, "Vector3 magnitude");
+    static_assert(Vector4(1.0f, 2.0f, 3.0f, 4.0f).dot(Vector4(4.0f, 3.0f, 2.0f, 1.0f)) == 20.0f, "Vector4 dot");
+    static_assert(isNear(Vector4(1.0f, 2.0f, 2.0f, 4.0f).normalize().magnitude(), 1.0f, 1.0e-6f), "Vector4 normalize");
+
+    // Cuaterniones: i * j = k y un giro de 90 grados sobre z lleva x a y.
+    static_assert((Quaternion(0, 1, 0, 0) * Quaternion(0, 0, 1, 0)).z == 1.0f, "Quaternion i * j");
+    static_assert(isNear(Quaternion(MathEngine::HALF_PI, Vector3(0, 0, 1)).rotate(Vector3(1, 0, 0)).y, 1.0f, 1.0e-6f),
+                  "Quaternion rotate");
+    static_assert(isNear(Quaternion(1, 2, 3, 4).normalize().magnitude(), 1.0f, 1.0e-6f), "Quaternion normalize");
+
+    // rotateUnit coincide con rotate y slerp avanza a velocidad angular constante.
+    constexpr Quaternion kTestRotation = Quaternion(1.1f, Vector3(0.48f, 0.6f, 0.64f));
+    constexpr Vector3 kTestRotated = kTestRotation.rotate(Vector3(1, 2, 3));
+    constexpr Vector3 kTestRotatedUnit = kTestRotation.rotateUnit(Vector3(1, 2, 3));
+    static_assert(isNear(kTestRotated.x, kTestRotatedUnit.x, 1.0e-5f) && isNear(kTestRotated.y, kTestRotatedUnit.y, 1.0e-5f) &&
+                  isNear(kTestRotated.z, kTestRotatedUnit.z, 1.0e-5f), "Quaternion rotateUnit");
+    constexpr Quaternion kTestHalfway = Quaternion::slerp(Quaternion(1, 0, 0, 0), kTestRotation, 0.5f);
+    constexpr Quaternion kTestHalfAngle = Quaternion(0.55f, Vector3(0.48f, 0.6f, 0.64f));
+    static_assert(isNear(kTestHalfway.w, kTestHalfAngle.w, 1.0e-6f) && isNear(kTestHalfway.x, kTestHalfAngle.x, 1.0e-6f) &&
+                  isNear(kTestHalfway.z, kTestHalfAngle.z, 1.0e-6f), "Quaternion slerp");
+    static_assert(isNear(Quaternion::slerp(kTestRotation, kTestRotation * -1.0f, 0.7f).w, kTestRotation.w, 1.0e-6f),
+                  "slerp toma el camino más corto");
+    static_assert(isNear(Quaternion::nlerp(kTestRotation, Quaternion(1, 0, 0, 0), 1.0f).w, 1.0f, 1.0e-6f), "Quaternion nlerp");
+
+    // Matrices: M * M^-1 = I.
+    constexpr Matrix3x3 kTestAffine = Matrix3x3::fromTRS(Vector2(10.0f, -5.0f), 30.0f, Vector2(2.0f, 0.5f));
+    static_assert(isIdentity(kTestAffine * kTestAffine.inverse(), 3, 1.0e-5f), "Matrix3x3 inverse");
+    static_assert(isNear(kTestAffine.transformPoint(Vector2(0, 0)).x, 10.0f, 0.0f), "Matrix3x3 translation");
+    constexpr Matrix4x4 kTestTRS = Matrix4x4::fromTRS(Vector3(1, 2, 3), Quaternion(0.5f, Vector3(0, 1, 0)),
+                                                      Vector3(2, 2, 2));
+    static_assert(isIdentity(kTestTRS * kTestTRS.inverse(), 4, 1.0e-5f), "Matrix4x4 inverse");
+    static_assert(kTestTRS.transpose().transpose() == kTestTRS, "Matrix4x4 transpose");
+
+    // Punto fijo Q16.16: aritmética exacta y error de sqrt, sin y cos en unidades de 1/65536.
+    static_assert((Fixed32::fromInt(3) * Fixed32::fromRatio(1, 2)).raw == 98304, "Fixed32 *");
+    static_assert(Fixed32::fromInt(-3) / Fixed32::fromInt(2) == Fixed32::fromRatio(-3, 2), "Fixed32 /");
+    static_assert(Fixed32::fromInt(1) / Fixed32() == Fixed32(), "Fixed32 / 0");
+    static_assert(FixedMath::sqrt(Fixed32::fromInt(2)).raw == 92682, "Fixed32 sqrt(2)");
+    static_assert(FixedMath::sin(FixedMath::HALF_PI) == Fixed32::fromInt(1) && FixedMath::cos(Fixed32()) == Fixed32::fromInt(1),
+                  "Fixed32 sin(pi/2) y cos(0)");
+    static_assert(isNear(static_cast<float>(FixedMath::sin(Fixed32::fromInt(1)).raw), 55146.3f, 3.0f), "Fixed32 sin(1)");
+    static_assert(isNear(static_cast<float>(FixedMath::cos(Fixed32::fromInt(-2)).raw), -27273.0f, 3.0f), "Fixed32 cos(-2)");
+    static_assert(FixedVector2(Fixed32::fromInt(300), Fixed32::fromInt(400)).magnitude() == Fixed32::fromInt(500),
+                  "FixedVector2 magnitude sin desbordarse");
+
+    // Geometría: la caja transformada contiene la caja orientada y las pruebas de borde.
+    constexpr AABB kTestBox = AABB(Vector2(0, 0), Vector2(100, 50));
+    constexpr OBB kTestOriented = OBB::fromMatrix(kTestAffine, kTestBox);
+    static_assert(isNear(kTestBox.transform(kTestAffine).min.x, kTestOriented.getAABB().min.x, 1.0e-4f) &&
+                  isNear(kTestBox.transform(kTestAffine).max.y, kTestOriented.getAABB().max.y, 1.0e-4f), "AABB transform");
+    static_assert(kTestOriented.contains(kTestAffine.transformPoint(Vector2(99, 49))) &&
+                  !kTestOriented.contains(kTestAffine.transformPoint(Vector2(101, 25))), "OBB contains");
+    static_assert(kTestOriented.overlaps(OBB(Vector2(10, -5), Vector2(1, 1), Vector2(1, 0))), "OBB overlaps");
+    static_assert(Circle(Vector2(0, 0), 1).overlaps(AABB(Vector2(0.5f, 0.5f), Vector2(2, 2))) &&
+                  !Circle(Vector2(0, 0), 1).overlaps(AABB(Vector2(0.8f, 0.8f), Vector2(2, 2))), "Circle vs AABB");
+    static_assert(Segment(Vector2(0, 0), Vector2(2, 2)).intersects(Segment(Vector2(0, 2), Vector2(2, 0))) &&
+                  !Segment(Vector2(0, 0), Vector2(1, 0)).intersects(Segment(Vector2(2, 0), Vector2(3, 0))), "Segment intersects");
+    constexpr Vector2 kTestConcave[5] = { Vector2(0, 0), Vector2(4, 0), Vector2(4, 4), Vector2(2, 1), Vector2(0, 4) };
+    static_assert(Geometry::containsPoint(kTestConcave, 5, Vector2(1, 1)) &&
+                  !Geometry::containsPoint(kTestConcave, 5, Vector2(2, 3)), "containsPoint en un polígono cóncavo");
+
+    // Tablas.
+    static_assert(isNear(kUnitCircle8.points[0].x, 0.0f, 1.0e-7f) && kUnitCircle8.points[0].y == -1.0f,
+                  "el círculo empieza arriba");
+    static_assert(isUnitCircle(kUnitCircle8) && isUnitCircle(kUnitCircle16) && isUnitCircle(kUnitCircle32) &&
+                  isUnitCircle(kUnitCircle64) && isUnitCircle(kUnitCircle128), "círculos unitarios");
+  }
+}
@@ -0,0 +1,192 @@
+#pragma once
+#include "MathEngine.h"
+#include "Vector2.h"
+#include "SIMD.h"
+#include <cstddef>
+#include <cstring>
+
+/**
+ * @brief Matriz 3x3 de transformaciones afines en 2D.
+ * Usa la convención de vectores columna, p' = M * (x, y, 1), igual que sf::Transform.
+ * Cada fila ocupa 4 floats alineados a 16 bytes (el cuarto es relleno), así que una
+ * fila completa cabe en un registro SSE. Todo excepto la transformación en bloque es
+ * constexpr; en expresiones constantes se toma la ruta escalar.
+ */
+class alignas(16) Matrix3x3 {
+public:
+
+    // Filas de la matriz; la columna 3 es relleno y siempre vale 0.
+    float m[3][4];
+
+    /**
+     * @brief Constructor por defecto.
+     * Inicializa la matriz identidad.
+    */
+    constexpr Matrix3x3() : Matrix3x3(1, 0, 0,
+                                      0, 1, 0,
+                                      0, 0, 1) {}
+
+    /**
+     * @brief Constructor parametrizado.
+     * Recibe los elementos fila por fila.
+    */
+    constexpr Matrix3x3(float a00, float a01, float a02,
+                        float a10, float a11, float a12,
+                        float a20, float a21, float a22)
+        : m{ { a00, a01, a02, 0 },
+             { a10, a11, a12, 0 },
+             { a20, a21, a22, 0 } } {}
+
+    /**
+     * @brief Compone traslación, rotación y escala: M = T * R * S.
+     * Recibe el seno y el coseno del ángulo ya calculados, para que quien guarda el
+     * ángulo pueda reutilizarlos mientras no cambie.
+    */
+    static constexpr Matrix3x3 fromTRS(const Vector2& position, float sine, float cosine, const Vector2& scale) {
+        return Matrix3x3(cosine * scale.x, -sine * scale.y, position.x,
+                         sine * scale.x, cosine * scale.y, position.y,
+                         0, 0, 1);
+    }
+
+    // Compone traslación, rotación (en grados, como SFML) y escala.
+    static constexpr Matrix3x3 fromTRS(const Vector2& position, float degrees, const Vector2& scale) {
+        float sine = 0.0f, cosine = 0.0f;
+        MathEngine::sincos(degrees * (MathEngine::PI / 180.0f), sine, cosine);
+        return fromTRS(position, sine, cosine, scale);
+    }
+
+    // Sobrecarga del operador * para componer 2 matrices (primero se aplica other).
+    constexpr Matrix3x3 operator*(const Matrix3x3& other) const {
+        Matrix3x3 result;
+#if defined(ALDAIR_SIMD_SSE)
+        if (!MATHENGINE_IS_CONSTANT_EVALUATED()) {
+            const __m128 row0 = _mm_load_ps(other.m[0]);
+            const __m128 row1 = _mm_load_ps(other.m[1]);
+            const __m128 row2 = _mm_load_ps(other.m[2]);
+            for (int i = 0; i < 3; ++i) {
+                __m128 row = _mm_mul_ps(_mm_set1_ps(m[i][0]), row0);
+                row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(m[i][1]), row1));
+                row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(m[i][2]), row2));
+                _mm_store_ps(result.m[i], row);
+            }
+            return result;
+        }
+#endif
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                result.m[i][j] = m[i][0] * other.m[0][j] + m[i][1] * other.m[1][j] + m[i][2] * other.m[2][j];
+            }
+        }
+        return result;
+    }
+
+    // Compara los 9 elementos bit a bit (en expresiones constantes, por valor).
+    constexpr bool operator==(const Matrix3x3& other) const {
+        if (MATHENGINE_IS_CONSTANT_EVALUATED()) {
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    if (m[i][j] != other.m[i][j]) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+        return std::memcmp(m, other.m, sizeof(m)) == 0;
+    }
+
+    constexpr bool operator!=(const Matrix3x3& other) const {
+        return !(*this == other);
+    }
+
+    // Determinante de la matriz.
+    constexpr float determinant() const {
+        return m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) -
+               m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
+               m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+    }
+
+    /**
+     * @brief Calcula la matriz inversa por cofactores.
+     * Si la matriz no es invertible devuelve la identidad, como sf::Transform.
+    */
+    constexpr Matrix3x3 inverse() const {
+        const float det = determinant();
+        if (det == 0) {
+            return Matrix3x3();
+        }
+        const float inv = 1.0f / det;
+        return Matrix3x3((m[1][1] * m[2][2] - m[1][2] * m[2][1]) * inv,
+                         (m[0][2] * m[2][1] - m[0][1] * m[2][2]) * inv,
+                         (m[0][1] * m[1][2] - m[0][2] * m[1][1]) * inv,
+                         (m[1][2] * m[2][0] - m[1][0] * m[2][2]) * inv,
+                         (m[0][0] * m[2][2] - m[0][2] * m[2][0]) * inv,
+                         (m[0][2] * m[1][0] - m[0][0] * m[1][2]) * inv,
+                         (m[1][0] * m[2][1] - m[1][1] * m[2][0]) * inv,
+                         (m[0][1] * m[2][0] - m[0][0] * m[2][1]) * inv,
+                         (m[0][0] * m[1][1] - m[0][1] * m[1][0]) * inv);
+    }
+
+    // Transforma un punto (x, y, 1); ignora la fila de proyección.
+    constexpr Vector2 transformPoint(const Vector2& point) const {
+        return Vector2(m[0][0] * point.x + m[0][1] * point.y + m[0][2],
+                       m[1][0] * point.x + m[1][1] * point.y + m[1][2]);
+    }
+
+    /**
+     * @brief Transforma count puntos (x, y) en bloque.
+     * Los puntos de entrada y salida pueden estar intercalados con otros datos: cada
+     * stride es la distancia en bytes entre un punto y el siguiente (por ejemplo
+     * sizeof(sf::Vertex) para escribir directamente en la posición de los vértices).
+     * Con SSE se transforman dos puntos por registro.
+    */
+    void transformPoints(const float* input, size_t inputStride,
+                         float* output, size_t outputStride, size_t count) const {
+        const char* in = reinterpret_cast<const char*>(input);
+        char* out = reinterpret_cast<char*>(output);
+        size_t i = 0;
+#if defined(ALDAIR_SIMD_SSE)
+        // (a, c, a, c), (b, d, b, d) y (tx, ty, tx, ty) para dos puntos (x0, y0, x1, y1).
+        const __m128 columnX = _mm_setr_ps(m[0][0], m[1][0], m[0][0], m[1][0]);
+        const __m128 columnY = _mm_setr_ps(m[0][1], m[1][1], m[0][1], m[1][1]);
+        const __m128 translation = _mm_setr_ps(m[0][2], m[1][2], m[0][2], m[1][2]);
+        for (; i + 2 <= count; i += 2) {
+            __m128 points = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(in));
+            points = _mm_loadh_pi(points, reinterpret_cast<const __m64*>(in + inputStride));
+            const __m128 xs = _mm_shuffle_ps(points, points, _MM_SHUFFLE(2, 2, 0, 0));
+            const __m128 ys = _mm_shuffle_ps(points, points, _MM_SHUFFLE(3, 3, 1, 1));
+            const __m128 result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(xs, columnX), _mm_mul_ps(ys, columnY)),
+                                             translation);
+            _mm_storel_pi(reinterpret_cast<__m64*>(out), result);
+            _mm_storeh_pi(reinterpret_cast<__m64*>(out + outputStride), result);
+            in += 2 * inputStride;
+            out += 2 * outputStride;
+        }
+#endif
+        for (; i < count; ++i) {
+            const float* point = reinterpret_cast<const float*>(in);
+            float* result = reinterpret_cast<float*>(out);
+            const float x = point[0];
+            const float y = point[1];
+            result[0] = m[0][0] * x + m[0][1] * y + m[0][2];
+            result[1] = m[1][0] * x + m[1][1] * y + m[1][2];
+            in += inputStride;
+            out += outputStride;
+        }
+    }
+
+    // Transforma count puntos contiguos; input y output pueden ser el mismo arreglo.
+    void transformPoints(const Vector2* input, Vector2* output, size_t count) const {
+        transformPoints(&input->x, sizeof(Vector2), &output->x, sizeof(Vector2), count);
+    }
+
+    // Método para devolver un puntero a la primera fila (4 floats por fila).
+    constexpr float* data() {
+        return &m[0][0];
+    }
+
+    // Método para devolver un puntero constante a la primera fila.
+    constexpr const float* data() const {
+        return &m[0][0];
+    }
+};
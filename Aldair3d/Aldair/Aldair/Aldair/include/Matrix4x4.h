@@ -0,0 +1,258 @@
+#pragma once
+#include "MathEngine.h"
+#include "Vector3.h"
+#include "Vector4.h"
+#include "Quaternion.h"
+#include "Matrix3x3.h"
+#include "SIMD.h"
+#include <cstddef>
+#include <cstring>
+
+/**
+ * @brief Matriz 4x4 para transformaciones en 3D.
+ * Usa la convención de vectores columna, p' = M * (x, y, z, w), y guarda las filas
+ * alineadas a 16 bytes para cargar cada una en un registro SSE. Todo excepto la
+ * transformación en bloque es constexpr; en expresiones constantes se toma la ruta escalar.
+ */
+class alignas(16) Matrix4x4 {
+public:
+
+    // Filas de la matriz.
+    float m[4][4];
+
+    /**
+     * @brief Constructor por defecto.
+     * Inicializa la matriz identidad.
+    */
+    constexpr Matrix4x4() : Matrix4x4(1, 0, 0, 0,
+                                      0, 1, 0, 0,
+                                      0, 0, 1, 0,
+                                      0, 0, 0, 1) {}
+
+    /**
+     * @brief Constructor parametrizado.
+     * Recibe los elementos fila por fila.
+    */
+    constexpr Matrix4x4(float a00, float a01, float a02, float a03,
+                        float a10, float a11, float a12, float a13,
+                        float a20, float a21, float a22, float a23,
+                        float a30, float a31, float a32, float a33)
+        : m{ { a00, a01, a02, a03 },
+             { a10, a11, a12, a13 },
+             { a20, a21, a22, a23 },
+             { a30, a31, a32, a33 } } {}
+
+    /**
+     * @brief Compone traslación, rotación y escala: M = T * R * S.
+     * La rotación se normaliza antes de convertirse en matriz.
+    */
+    static constexpr Matrix4x4 fromTRS(const Vector3& position, const Quaternion& rotation, const Vector3& scale) {
+        const Quaternion q = rotation.normalize();
+        const float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+        const float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+        const float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+        return Matrix4x4((1 - 2 * (yy + zz)) * scale.x, 2 * (xy - wz) * scale.y, 2 * (xz + wy) * scale.z, position.x,
+                         2 * (xy + wz) * scale.x, (1 - 2 * (xx + zz)) * scale.y, 2 * (yz - wx) * scale.z, position.y,
+                         2 * (xz - wy) * scale.x, 2 * (yz + wx) * scale.y, (1 - 2 * (xx + yy)) * scale.z, position.z,
+                         0, 0, 0, 1);
+    }
+
+    // Extiende una transformación 2D al plano z = 0.
+    static constexpr Matrix4x4 fromMatrix3x3(const Matrix3x3& matrix) {
+        return Matrix4x4(matrix.m[0][0], matrix.m[0][1], 0, matrix.m[0][2],
+                         matrix.m[1][0], matrix.m[1][1], 0, matrix.m[1][2],
+                         0, 0, 1, 0,
+                         matrix.m[2][0], matrix.m[2][1], 0, matrix.m[2][2]);
+    }
+
+    // Sobrecarga del operador * para componer 2 matrices (primero se aplica other).
+    constexpr Matrix4x4 operator*(const Matrix4x4& other) const {
+        Matrix4x4 result;
+#if defined(ALDAIR_SIMD_SSE)
+        if (!MATHENGINE_IS_CONSTANT_EVALUATED()) {
+            const __m128 row0 = _mm_load_ps(other.m[0]);
+            const __m128 row1 = _mm_load_ps(other.m[1]);
+            const __m128 row2 = _mm_load_ps(other.m[2]);
+            const __m128 row3 = _mm_load_ps(other.m[3]);
+            for (int i = 0; i < 4; ++i) {
+                __m128 row = _mm_mul_ps(_mm_set1_ps(m[i][0]), row0);
+                row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(m[i][1]), row1));
+                row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(m[i][2]), row2));
+                row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(m[i][3]), row3));
+                _mm_store_ps(result.m[i], row);
+            }
+            return result;
+        }
+#endif
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                result.m[i][j] = m[i][0] * other.m[0][j] + m[i][1] * other.m[1][j] +
+                                 m[i][2] * other.m[2][j] + m[i][3] * other.m[3][j];
+            }
+        }
+        return result;
+    }
+
+    // Compara los 16 elementos bit a bit (en expresiones constantes, por valor).
+    constexpr bool operator==(const Matrix4x4& other) const {
+        if (MATHENGINE_IS_CONSTANT_EVALUATED()) {
+            for (int i = 0; i < 4; ++i) {
+                for (int j = 0; j < 4; ++j) {
+                    if (m[i][j] != other.m[i][j]) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+        return std::memcmp(m, other.m, sizeof(m)) == 0;
+    }
+
+    constexpr bool operator!=(const Matrix4x4& other) const {
+        return !(*this == other);
+    }
+
+    // Devuelve la matriz transpuesta.
+    constexpr Matrix4x4 transpose() const {
+        Matrix4x4 result;
+#if defined(ALDAIR_SIMD_SSE)
+        if (!MATHENGINE_IS_CONSTANT_EVALUATED()) {
+            // Igual que _MM_TRANSPOSE4_PS, con todas las variables inicializadas.
+            const __m128 low01 = _mm_unpacklo_ps(_mm_load_ps(m[0]), _mm_load_ps(m[1]));
+            const __m128 high01 = _mm_unpackhi_ps(_mm_load_ps(m[0]), _mm_load_ps(m[1]));
+            const __m128 low23 = _mm_unpacklo_ps(_mm_load_ps(m[2]), _mm_load_ps(m[3]));
+            const __m128 high23 = _mm_unpackhi_ps(_mm_load_ps(m[2]), _mm_load_ps(m[3]));
+            _mm_store_ps(result.m[0], _mm_movelh_ps(low01, low23));
+            _mm_store_ps(result.m[1], _mm_movehl_ps(low23, low01));
+            _mm_store_ps(result.m[2], _mm_movelh_ps(high01, high23));
+            _mm_store_ps(result.m[3], _mm_movehl_ps(high23, high01));
+            return result;
+        }
+#endif
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                result.m[i][j] = m[j][i];
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Calcula la matriz inversa por cofactores (desarrollo de Laplace en 2x2).
+     * Si la matriz no es invertible devuelve la identidad.
+    */
+    constexpr Matrix4x4 inverse() const {
+        // Determinantes 2x2 de las filas 0-1 (s) y 2-3 (c).
+        const float s0 = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+        const float s1 = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+        const float s2 = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+        const float s3 = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+        const float s4 = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+        const float s5 = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+        const float c5 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+        const float c4 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+        const float c3 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+        const float c2 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+        const float c1 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+        const float c0 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+
+        const float det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        if (det == 0) {
+            return Matrix4x4();
+        }
+        const float inv = 1.0f / det;
+        return Matrix4x4(
+            ( m[1][1] * c5 - m[1][2] * c4 + m[1][3] * c3) * inv,
+            (-m[0][1] * c5 + m[0][2] * c4 - m[0][3] * c3) * inv,
+            ( m[3][1] * s5 - m[3][2] * s4 + m[3][3] * s3) * inv,
+            (-m[2][1] * s5 + m[2][2] * s4 - m[2][3] * s3) * inv,
+            (-m[1][0] * c5 + m[1][2] * c2 - m[1][3] * c1) * inv,
+            ( m[0][0] * c5 - m[0][2] * c2 + m[0][3] * c1) * inv,
+            (-m[3][0] * s5 + m[3][2] * s2 - m[3][3] * s1) * inv,
+            ( m[2][0] * s5 - m[2][2] * s2 + m[2][3] * s1) * inv,
+            ( m[1][0] * c4 - m[1][1] * c2 + m[1][3] * c0) * inv,
+            (-m[0][0] * c4 + m[0][1] * c2 - m[0][3] * c0) * inv,
+            ( m[3][0] * s4 - m[3][1] * s2 + m[3][3] * s0) * inv,
+            (-m[2][0] * s4 + m[2][1] * s2 - m[2][3] * s0) * inv,
+            (-m[1][0] * c3 + m[1][1] * c1 - m[1][2] * c0) * inv,
+            ( m[0][0] * c3 - m[0][1] * c1 + m[0][2] * c0) * inv,
+            (-m[3][0] * s3 + m[3][1] * s1 - m[3][2] * s0) * inv,
+            ( m[2][0] * s3 - m[2][1] * s1 + m[2][2] * s0) * inv);
+    }
+
+    // Transforma un vector de 4 componentes: M * v.
+    constexpr Vector4 transform(const Vector4& v) const {
+        if (MATHENGINE_IS_CONSTANT_EVALUATED()) {
+            return Vector4(m[0][0] * v.x + m[0][1] * v.y + m[0][2] * v.z + m[0][3] * v.w,
+                           m[1][0] * v.x + m[1][1] * v.y + m[1][2] * v.z + m[1][3] * v.w,
+                           m[2][0] * v.x + m[2][1] * v.y + m[2][2] * v.z + m[2][3] * v.w,
+                           m[3][0] * v.x + m[3][1] * v.y + m[3][2] * v.z + m[3][3] * v.w);
+        }
+        Vector4 result;
+        transformPoints(&v, &result, 1);
+        return result;
+    }
+
+    // Transforma un punto (x, y, z, 1) sin división de perspectiva.
+    constexpr Vector3 transformPoint(const Vector3& point) const {
+        return Vector3(m[0][0] * point.x + m[0][1] * point.y + m[0][2] * point.z + m[0][3],
+                       m[1][0] * point.x + m[1][1] * point.y + m[1][2] * point.z + m[1][3],
+                       m[2][0] * point.x + m[2][1] * point.y + m[2][2] * point.z + m[2][3]);
+    }
+
+    /**
+     * @brief Transforma count vectores en bloque: output[i] = M * input[i].
+     * Las columnas se cargan una vez; con AVX2 se transforman dos vectores por
+     * registro. input y output pueden ser el mismo arreglo.
+    */
+    void transformPoints(const Vector4* input, Vector4* output, size_t count) const {
+        size_t i = 0;
+#if defined(ALDAIR_SIMD_SSE)
+        const Matrix4x4 columns = transpose();
+        const __m128 column0 = _mm_load_ps(columns.m[0]);
+        const __m128 column1 = _mm_load_ps(columns.m[1]);
+        const __m128 column2 = _mm_load_ps(columns.m[2]);
+        const __m128 column3 = _mm_load_ps(columns.m[3]);
+#if defined(ALDAIR_SIMD_AVX2)
+        const __m256 pair0 = _mm256_set_m128(column0, column0);
+        const __m256 pair1 = _mm256_set_m128(column1, column1);
+        const __m256 pair2 = _mm256_set_m128(column2, column2);
+        const __m256 pair3 = _mm256_set_m128(column3, column3);
+        for (; i + 2 <= count; i += 2) {
+            const __m256 v = _mm256_loadu_ps(input[i].data());
+            __m256 r = _mm256_mul_ps(pair0, _mm256_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+            r = _mm256_fmadd_ps(pair1, _mm256_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)), r);
+            r = _mm256_fmadd_ps(pair2, _mm256_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), r);
+            r = _mm256_fmadd_ps(pair3, _mm256_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)), r);
+            _mm256_storeu_ps(output[i].data(), r);
+        }
+#endif
+        for (; i < count; ++i) {
+            const __m128 v = input[i].load();
+            __m128 r = _mm_mul_ps(column0, _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+            r = _mm_add_ps(r, _mm_mul_ps(column1, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))));
+            r = _mm_add_ps(r, _mm_mul_ps(column2, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))));
+            r = _mm_add_ps(r, _mm_mul_ps(column3, _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))));
+            _mm_store_ps(output[i].data(), r);
+        }
+#else
+        for (; i < count; ++i) {
+            const Vector4 v = input[i];
+            output[i] = Vector4(m[0][0] * v.x + m[0][1] * v.y + m[0][2] * v.z + m[0][3] * v.w,
+                                m[1][0] * v.x + m[1][1] * v.y + m[1][2] * v.z + m[1][3] * v.w,
+                                m[2][0] * v.x + m[2][1] * v.y + m[2][2] * v.z + m[2][3] * v.w,
+                                m[3][0] * v.x + m[3][1] * v.y + m[3][2] * v.z + m[3][3] * v.w);
+        }
+#endif
+    }
+
+    // Método para devolver un puntero a la primera fila.
+    constexpr float* data() {
+        return &m[0][0];
+    }
+
+    // Método para devolver un puntero constante a la primera fila.
+    constexpr const float* data() const {
+        return &m[0][0];
+    }
+};
@@ -0,0 +1,43 @@
+#pragma once
+#include <cstddef>
+#include <new>
+
+namespace EngineUtilities {
+    /**
+   * Asignador con alineación fija para contenedores de la STL.
+   *
+   * Los arreglos de estructura de arreglos (SoA) se recorren con cargas SIMD
+   * alineadas, así que su memoria debe empezar en un múltiplo de Alignment bytes
+   * (32 cubre AVX). Se usa como std::vector<float, TAlignedAllocator<float>>.
+   */
+    template<typename T, size_t Alignment = 32>
+    class TAlignedAllocator
+    {
+    public:
+        using value_type = T;
+
+        template<typename U>
+        struct rebind { using other = TAlignedAllocator<U, Alignment>; };
+
+        TAlignedAllocator() noexcept = default;
+
+        template<typename U>
+        TAlignedAllocator(const TAlignedAllocator<U, Alignment>&) noexcept {}
+
+        // Reserva memoria alineada para count elementos.
+        T* allocate(size_t count) {
+            return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(Alignment)));
+        }
+
+        // Libera memoria reservada con allocate.
+        void deallocate(T* ptr, size_t) noexcept {
+            ::operator delete(ptr, std::align_val_t(Alignment));
+        }
+
+        template<typename U>
+        bool operator==(const TAlignedAllocator<U, Alignment>&) const noexcept { return true; }
+
+        template<typename U>
+        bool operator!=(const TAlignedAllocator<U, Alignment>&) const noexcept { return false; }
+    };
+}
@@ -0,0 +1,164 @@
+#pragma once
+#include "Prerequisites.h"
+#include "Component.h"
+#include "Window.h"
+#include "Random.h"
+
+/**
+ * @brief Componente emisor de partículas.
+ * Las partículas viven en una reserva de estructura de arreglos (SoA): posición,
+ * velocidad, vida y color en arreglos separados y alineados, de forma que la
+ * integración recorre memoria contigua con MathBatch::integrateBatch, que usa AVX2
+ * (8 partículas por instrucción) o SSE2 (4) según el procesador. Las partículas
+ * muertas se eliminan intercambiándolas con la última, así que las vivas siempre
+ * ocupan [0, getCount()).
+ *
+ * BaseApp copia los quads de todos los emisores a la instantánea de render.
+ */
+class
+ParticleEmitter : public Component {
+public:
+  /**
+   * @brief Constructor del emisor.
+   * @param capacity Número máximo de partículas vivas.
+   */
+  ParticleEmitter(size_t capacity = 10000);
+
+  virtual
+  ~ParticleEmitter() = default;
+
+  /**
+   * @brief Emite nuevas partículas según la tasa y simula las vivas.
+   * @param deltaTime El tiempo transcurrido desde la ultima actualización.
+   */
+  void
+  update(float deltaTime) override;
+
+  void
+  render(Window window) override {};
+
+  /**
+   * @brief Integra todas las partículas vivas y elimina las muertas.
+   * @param deltaTime Paso de tiempo en segundos.
+   * @param parallel `true` para repartir la integración con el JobSystem.
+   */
+  void
+  simulate(float deltaTime, bool parallel);
+
+  /**
+   * @brief Integra con el kernel escalar, sin SIMD ni hilos.
+   * Sirve de referencia para medir los kernels vectoriales.
+   */
+  void
+  simulateScalar(float deltaTime);
+
+  // Emite count partículas en el origen, hasta llenar la capacidad.
+  void
+  emit(size_t count);
+
+  // Elimina todas las partículas vivas.
+  void
+  clear() { m_count = 0; }
+
+  /**
+   * @brief Agrega un quad (4 vértices, sf::Quads) por partícula viva.
+   * Así se copian las partículas a la instantánea de render.
+   */
+  void
+  appendVertices(std::vector<sf::Vertex>& vertices) const;
+
+  // Establece el punto desde el que se emiten las partículas.
+  void
+  setOrigin(const sf::Vector2f& origin) { m_origin = origin; }
+
+  const sf::Vector2f&
+  getOrigin() const { return m_origin; }
+
+  // Partículas emitidas por segundo.
+  void
+  setEmissionRate(float rate) { m_emissionRate = std::max(0.0f, rate); }
+
+  float
+  getEmissionRate() const { return m_emissionRate; }
+
+  // Rango de la vida inicial en segundos.
+  void
+  setLifetime(float minLife, float maxLife);
+
+  float
+  getMinLifetime() const { return m_minLifetime; }
+
+  float
+  getMaxLifetime() const { return m_maxLifetime; }
+
+  // Velocidad inicial máxima (dirección aleatoria).
+  void
+  setSpeed(float speed) { m_speed = speed; }
+
+  float
+  getSpeed() const { return m_speed; }
+
+  // Aceleración vertical aplicada a todas las partículas.
+  void
+  setGravity(float gravity) { m_gravity = gravity; }
+
+  float
+  getGravity() const { return m_gravity; }
+
+  // Color base de las partículas nuevas; el alfa se desvanece con la vida.
+  void
+  setColor(const sf::Color& color) { m_color = color; }
+
+  const sf::Color&
+  getColor() const { return m_color; }
+
+  // Tamaño en píxeles del lado de cada quad.
+  void
+  setParticleSize(float size) { m_particleSize = size; }
+
+  float
+  getParticleSize() const { return m_particleSize; }
+
+  // Número de partículas vivas.
+  size_t
+  getCount() const { return m_count; }
+
+  // Número máximo de partículas vivas.
+  size_t
+  getCapacity() const { return m_capacity; }
+
+  // Nombre del conjunto de instrucciones que usa MathBatch para integrar.
+  static const char*
+  getKernelName();
+
+private:
+  using FloatArray = std::vector<float, EngineUtilities::TAlignedAllocator<float>>;
+
+  // Elimina las partículas sin vida intercambiándolas con la última viva.
+  void
+  compact();
+
+  size_t m_capacity;
+  size_t m_count = 0;
+
+  // Reserva SoA; cada arreglo tiene m_capacity elementos.
+  FloatArray m_positionX;
+  FloatArray m_positionY;
+  FloatArray m_velocityX;
+  FloatArray m_velocityY;
+  FloatArray m_life;       // Vida restante en segundos.
+  FloatArray m_invMaxLife; // Inverso de la vida inicial, para desvanecer el alfa.
+  std::vector<sf::Color> m_colors;
+
+  sf::Vector2f m_origin;
+  float m_emissionRate = 2000.0f;
+  float m_emissionAccumulator = 0.0f;
+  float m_minLifetime = 1.0f;
+  float m_maxLifetime = 2.5f;
+  float m_speed = 120.0f;
+  float m_gravity = 98.0f;
+  float m_particleSize = 3.0f;
+  sf::Color m_color = sf::Color(255, 180, 60);
+
+  Random m_random; // Flujo propio de RandomService.
+};
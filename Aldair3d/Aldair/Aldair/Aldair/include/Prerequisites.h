@@ -9,6 +9,10 @@
 #include <map>
 #include <fstream> 
 #include <unordered_map>
+#include <memory>
+#include <algorithm>
+#include <cmath>
+#include <array>
 
 // Third Parties
 #include <SFML/Graphics.hpp>
@@ -16,6 +20,7 @@
 #include "Memory/TStaticPtr.h"
 #include "Memory/TUniquePtr.h"
 #include "Memory/TWeakPointer.h"
+#include "Memory/TAlignedAllocator.h"
 
 // Libreria Matematica
 #include "Vector2.h"
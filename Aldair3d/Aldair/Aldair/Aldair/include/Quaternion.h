@@ -1,8 +1,16 @@
 ﻿#pragma once
 #include "MathEngine.h"
 #include "Vector3.h"
+#include "Vector4.h"
+#include "SIMD.h"
 
-class Quaternion {
+/**
+ * @brief Cuaternion alineado a 16 bytes, con las componentes en orden (w, x, y, z).
+ * Con SSE el producto de Hamilton usa permutaciones de registros y la normalizacion
+ * usa rsqrt con un paso de Newton-Raphson; sin SSE se calcula componente por componente.
+ * Las operaciones son constexpr: en expresiones constantes toman la ruta escalar.
+ */
+class alignas(16) Quaternion {
 public:
 
     //Partes vectoriales (x, y, z y w) del cuaterni�n.
@@ -12,45 +20,65 @@ public:
      * @brief Constructor por defecto.
      * Inicializa las componentes del cuaterni�n a (0, 0, 0, 0).
      */
-    Quaternion() : w(0), x(0), y(0), z(0) {}
+    constexpr Quaternion() : w(0), x(0), y(0), z(0) {}
 
     /**
      * @brief Constructor parametrizado.
      * Inicializa las componentes del cuaterni�n con los valores especificados.
      */
-    Quaternion(float w, float x, float y, float z) : w(w), x(x), y(y), z(z) {}
+    constexpr Quaternion(float w, float x, float y, float z) : w(w), x(x), y(y), z(z) {}
 
     /**
      * @brief Constructor que inicializa un cuaterni�n a partir de un �ngulo y un eje de rotaci�n.
      * Este constructor genera un cuaterni�n que representa una rotaci�n en 3D dada por un
      * �ngulo (en radianes) y un eje de rotaci�n.
      */
-    Quaternion(float angle, const Vector3& axis) {
+    constexpr Quaternion(float angle, const Vector3& axis) : w(0), x(0), y(0), z(0) {
         float halfAngle = angle / 2.0f;
-        float sinHalfAngle = MathEngine::sin(halfAngle);
-        w = MathEngine::cos(halfAngle);
+        float sinHalfAngle = 0.0f;
+        MathEngine::sincos(halfAngle, sinHalfAngle, w);
         x = axis.x * sinHalfAngle;
         y = axis.y * sinHalfAngle;
         z = axis.z * sinHalfAngle;
     }
 
     // Sobrecarga del operador + para sumar 2 cuaterniones.
-    Quaternion operator+(const Quaternion& other) const {
+    constexpr Quaternion operator+(const Quaternion& other) const {
+#if defined(ALDAIR_SIMD_SSE)
+        if (!MATHENGINE_IS_CONSTANT_EVALUATED()) {
+            return Quaternion(_mm_add_ps(load(), other.load()));
+        }
+#endif
         return Quaternion(w + other.w, x + other.x, y + other.y, z + other.z);
     }
 
     // Sobrecarga del operador + para restar 2 cuaterniones.
-    Quaternion operator-(const Quaternion& other) const {
+    constexpr Quaternion operator-(const Quaternion& other) const {
+#if defined(ALDAIR_SIMD_SSE)
+        if (!MATHENGINE_IS_CONSTANT_EVALUATED()) {
+            return Quaternion(_mm_sub_ps(load(), other.load()));
+        }
+#endif
         return Quaternion(w - other.w, x - other.x, y - other.y, z - other.z);
     }
 
     // Sobrecarga del operador * para multiplicar un cuaterni�n por un escalar.
-    Quaternion operator*(float scalar) const {
+    constexpr Quaternion operator*(float scalar) const {
+#if defined(ALDAIR_SIMD_SSE)
+        if (!MATHENGINE_IS_CONSTANT_EVALUATED()) {
+            return Quaternion(_mm_mul_ps(load(), _mm_set1_ps(scalar)));
+        }
+#endif
         return Quaternion(w * scalar, x * scalar, y * scalar, z * scalar);
     }
 
     //Sobrecarga del operador * para multiplicar dos cuaterniones.
-    Quaternion operator*(const Quaternion& other) const {
+    constexpr Quaternion operator*(const Quaternion& other) const {
+#if defined(ALDAIR_SIMD_SSE)
+        if (!MATHENGINE_IS_CONSTANT_EVALUATED()) {
+            return Quaternion(SIMD::quaternionMultiply(load(), other.load()));
+        }
+#endif
         return Quaternion(
             w * other.w - x * other.x - y * other.y - z * other.z,
             w * other.x + x * other.w + y * other.z - z * other.y,
@@ -59,13 +87,23 @@ public:
         );
     }
 
+    // Producto punto de 2 cuaterniones.
+    constexpr float dot(const Quaternion& other) const {
+#if defined(ALDAIR_SIMD_SSE)
+        if (!MATHENGINE_IS_CONSTANT_EVALUATED()) {
+            return _mm_cvtss_f32(SIMD::dot4(load(), other.load()));
+        }
+#endif
+        return w * other.w + x * other.x + y * other.y + z * other.z;
+    }
+
     /**
      * @brief Calcula la magnitud del cuaterni�n.
      * La magnitud de un cuaterni�n se calcula como la ra�z cuadrada de la suma de los cuadrados de sus componentes.
      * Se calcular la ra�z cuadrada a trav�s de MathEngine.h.
      */
-    float magnitude() const {
-        return MathEngine::sqrt(w * w + x * x + y * y + z * z);
+    constexpr float magnitude() const {
+        return MathEngine::sqrt(dot(*this));
     }
 
     /**
@@ -73,19 +111,30 @@ public:
      * Devuelve un cuaterni�n con la misma direcci�n, pero con magnitud 1.
      * Si la magnitud es 0, devuelve un cuaterni�n nulo.
      */
-    Quaternion normalize() const {
-        float mag = magnitude();
-        if (mag == 0) {
+    constexpr Quaternion normalize() const {
+#if defined(ALDAIR_SIMD_SSE)
+        if (!MATHENGINE_IS_CONSTANT_EVALUATED()) {
+            // rsqrt con un paso de Newton-Raphson: sin raiz ni divisiones.
+            return Quaternion(SIMD::normalize4(load()));
+        }
+#endif
+        float magSquared = dot(*this);
+        if (magSquared == 0) {
             return Quaternion(0, 0, 0, 0);
         }
-        return Quaternion(w / mag, x / mag, y / mag, z / mag);
+        return *this * MathEngine::rsqrt(magSquared);
     }
 
     /**
      * @brief Calcula el conjugado del cuaterni�n.
      * El conjugado de un cuaterni�n se obtiene invirtiendo el signo de su parte vectorial.
      */
-    Quaternion conjugate() const {
+    constexpr Quaternion conjugate() const {
+#if defined(ALDAIR_SIMD_SSE)
+        if (!MATHENGINE_IS_CONSTANT_EVALUATED()) {
+            return Quaternion(_mm_xor_ps(load(), SIMD::signMask(0, 1, 1, 1)));
+        }
+#endif
         return Quaternion(w, -x, -y, -z);
     }
 
@@ -93,8 +142,8 @@ public:
      * @brief Calcula el inverso del cuaterni�n.
      * El inverso de un cuaterni�n se define como su conjugado dividido entre su magnitud al cuadrado.
      */
-    Quaternion inverse() const {
-        float magSquared = w * w + x * x + y * y + z * z;
+    constexpr Quaternion inverse() const {
+        float magSquared = dot(*this);
         if (magSquared == 0) {
             return Quaternion(0, 0, 0, 0);
         }
@@ -105,20 +154,158 @@ public:
      * @brief Rota un vector utilizando el cuaterni�n.
      * Este m�todo rota un vector en el espacio 3D utilizando el cuaterni�n como rotaci�n.
      */
-    Vector3 rotate(const Vector3& v) const {
+    constexpr Vector3 rotate(const Vector3& v) const {
         Quaternion qv(0, v.x, v.y, v.z);
         Quaternion result = (*this) * qv * this->inverse();
         return Vector3(result.x, result.y, result.z);
     }
 
+    /**
+     * @brief Rota un vector con un cuaternión unitario, sin productos de Hamilton.
+     * Usa la forma con productos cruz: t = 2 (u x v), v' = v + w t + u x t, con u la
+     * parte vectorial. No calcula el inverso; si el cuaternión no es unitario el
+     * resultado queda escalado por |q|^2 (usar rotate o normalizar antes).
+     */
+    constexpr Vector3 rotateUnit(const Vector3& v) const {
+        const Vector3 t((y * v.z - z * v.y) * 2.0f, (z * v.x - x * v.z) * 2.0f, (x * v.y - y * v.x) * 2.0f);
+        return Vector3(v.x + w * t.x + (y * t.z - z * t.y),
+                       v.y + w * t.y + (z * t.x - x * t.z),
+                       v.z + w * t.z + (x * t.y - y * t.x));
+    }
+
+    /**
+     * @brief Rota count vectores en bloque; input y output pueden ser el mismo arreglo.
+     * Rota (x, y, z) de cada vector como rotate() y conserva w. El inverso se calcula
+     * una sola vez; con AVX2 se rotan dos vectores por registro.
+     */
+    void rotate(const Vector4* input, Vector4* output, size_t count) const {
+        const Quaternion inv = inverse();
+        size_t i = 0;
+#if defined(ALDAIR_SIMD_AVX2)
+        const __m256 q2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&w));
+        const __m256 inv2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&inv.w));
+        const __m256 pairLanes = _mm256_castsi256_ps(_mm256_set_epi32(-1, -1, -1, 0, -1, -1, -1, 0));
+        for (; i + 2 <= count; i += 2) {
+            const __m256 v = _mm256_loadu_ps(input[i].data());
+            // (x, y, z, w) -> (0, x, y, z) en cada mitad del registro.
+            const __m256 qv = _mm256_and_ps(_mm256_permute_ps(v, _MM_SHUFFLE(2, 1, 0, 3)), pairLanes);
+            const __m256 r = SIMD::quaternionMultiply(SIMD::quaternionMultiply(q2, qv), inv2);
+            // (rw, x, y, z) -> (x, y, z, w original).
+            _mm256_storeu_ps(output[i].data(), _mm256_blend_ps(_mm256_permute_ps(r, _MM_SHUFFLE(0, 3, 2, 1)), v, 0x88));
+        }
+#endif
+#if defined(ALDAIR_SIMD_SSE)
+        const __m128 q = load();
+        const __m128 inv1 = inv.load();
+        const __m128 vectorLanes = _mm_castsi128_ps(_mm_set_epi32(-1, -1, -1, 0));
+        for (; i < count; ++i) {
+            const __m128 v = input[i].load();
+            const __m128 qv = _mm_and_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 1, 0, 3)), vectorLanes);
+            const __m128 r = SIMD::quaternionMultiply(SIMD::quaternionMultiply(q, qv), inv1);
+            _mm_store_ps(output[i].data(), SIMD::blendLane3(_mm_shuffle_ps(r, r, _MM_SHUFFLE(0, 3, 2, 1)), v));
+        }
+#else
+        for (; i < count; ++i) {
+            const Quaternion r = (*this) * Quaternion(0, input[i].x, input[i].y, input[i].z) * inv;
+            output[i] = Vector4(r.x, r.y, r.z, input[i].w);
+        }
+#endif
+    }
+
+    /**
+     * @brief Versión en bloque de rotateUnit; input y output pueden ser el mismo arreglo.
+     * Rota (x, y, z) de cada vector y conserva w. Con SSE cada vector usa dos productos
+     * cruz en un registro; con AVX2 se rotan dos vectores por registro.
+     */
+    void rotateUnit(const Vector4* input, Vector4* output, size_t count) const {
+        size_t i = 0;
+#if defined(ALDAIR_SIMD_SSE)
+        // Parte vectorial (x, y, z, 0) en el orden de Vector4.
+        const __m128 u = _mm_setr_ps(x, y, z, 0.0f);
+        const __m128 twoW = _mm_set1_ps(2.0f * w);
+        const __m128 two = _mm_set1_ps(2.0f);
+#if defined(ALDAIR_SIMD_AVX2)
+        const __m256 u2 = _mm256_set_m128(u, u);
+        const __m256 twoW2 = _mm256_set1_ps(2.0f * w);
+        const __m256 two2 = _mm256_set1_ps(2.0f);
+        for (; i + 2 <= count; i += 2) {
+            const __m256 v = _mm256_loadu_ps(input[i].data());
+            // v' = v + 2w (u x v) + 2 u x (u x v); el carril w de ambos productos es 0.
+            const __m256 c = SIMD::cross3(u2, v);
+            const __m256 r = _mm256_fmadd_ps(twoW2, c, v);
+            _mm256_storeu_ps(output[i].data(), _mm256_fmadd_ps(two2, SIMD::cross3(u2, c), r));
+        }
+#endif
+        for (; i < count; ++i) {
+            const __m128 v = input[i].load();
+            const __m128 c = SIMD::cross3(u, v);
+            const __m128 r = _mm_add_ps(v, _mm_mul_ps(twoW, c));
+            _mm_store_ps(output[i].data(), _mm_add_ps(r, _mm_mul_ps(two, SIMD::cross3(u, c))));
+        }
+#else
+        for (; i < count; ++i) {
+            const Vector3 r = rotateUnit(Vector3(input[i].x, input[i].y, input[i].z));
+            output[i] = Vector4(r.x, r.y, r.z, input[i].w);
+        }
+#endif
+    }
+
+    // Por encima de este coseno slerp usa nlerp: el ángulo es tan chico que sin(theta) pierde precisión.
+    static constexpr float kSlerpLinearThreshold = 0.9995f;
+
+    /**
+     * @brief Interpolación lineal normalizada entre 2 rotaciones por el camino más corto.
+     * Más barata que slerp; la velocidad angular no es constante, pero el error frente a
+     * slerp es pequeño para ángulos chicos. t = 0 devuelve a y t = 1 devuelve b (o -b).
+     */
+    static constexpr Quaternion nlerp(const Quaternion& a, const Quaternion& b, float t) {
+        // q y -q son la misma rotación; se toma la que está del mismo lado que a.
+        const float sign = a.dot(b) < 0.0f ? -1.0f : 1.0f;
+        return (a * (1.0f - t) + b * (sign * t)).normalize();
+    }
+
+    /**
+     * @brief Interpolación esférica entre 2 rotaciones unitarias por el camino más corto.
+     * Avanza con velocidad angular constante. Si el ángulo entre ambas es muy pequeño
+     * (coseno > kSlerpLinearThreshold) usa nlerp, que ahí coincide con slerp.
+     */
+    static constexpr Quaternion slerp(const Quaternion& a, const Quaternion& b, float t) {
+        float cosTheta = a.dot(b);
+        float sign = 1.0f;
+        if (cosTheta < 0.0f) {
+            cosTheta = -cosTheta;
+            sign = -1.0f;
+        }
+        if (cosTheta > kSlerpLinearThreshold) {
+            return (a * (1.0f - t) + b * (sign * t)).normalize();
+        }
+        const float sinTheta = MathEngine::sqrt(1.0f - cosTheta * cosTheta);
+        const float theta = MathEngine::atan2(sinTheta, cosTheta);
+        const float inverseSin = 1.0f / sinTheta;
+        return a * (MathEngine::sin((1.0f - t) * theta) * inverseSin) +
+               b * (sign * MathEngine::sin(t * theta) * inverseSin);
+    }
+
     // Devuelve un puntero no constante a los datos del cuaterni�n.
-    float* data() {
+    constexpr float* data() {
         return &w;
     }
 
 
     // Devuelve un puntero constante a los datos del cuaterni�n.
-    const float* data() const {
+    constexpr const float* data() const {
         return &w;
     }
+
+#if defined(ALDAIR_SIMD_SSE)
+    // Construye el cuaternion desde un registro con los carriles (w, x, y, z).
+    explicit Quaternion(__m128 value) {
+        _mm_store_ps(&w, value);
+    }
+
+    // Carga las cuatro componentes en un registro.
+    __m128 load() const {
+        return _mm_load_ps(&w);
+    }
+#endif
 };
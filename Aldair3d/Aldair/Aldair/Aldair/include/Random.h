@@ -0,0 +1,121 @@
+#pragma once
+#include "MathEngine.h"
+#include "MathBatch.h"
+#include "Vector2.h"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Generador de números aleatorios del motor: xoshiro256** (Blackman y Vigna).
+ * Periodo 2^256 - 1, 32 bytes de estado y solo sumas, corrimientos y xor, así que la
+ * misma semilla produce la misma secuencia en cualquier compilador y procesador.
+ *
+ * Además del flujo escalar tiene cuatro flujos internos, separados 2^128 pasos entre
+ * sí, para los llenados en bloque: SSE2 avanza dos por registro y AVX2 los cuatro a la
+ * vez. El orden de los resultados no depende del conjunto de instrucciones.
+ *
+ * Un Random no es seguro entre hilos: cada hilo usa el suyo (ver split y
+ * RandomService).
+ */
+class
+Random {
+public:
+  // Flujos internos de los llenados en bloque.
+  static constexpr size_t kLanes = 4;
+
+  // Números que produce un paso de los cuatro flujos (dos de 32 bits por flujo).
+  static constexpr size_t kBlockSize = 2 * kLanes;
+
+  // Inicializa el estado con splitmix64 a partir de seed.
+  explicit Random(uint64_t seed = 0);
+
+  // Siguiente número de 64 bits.
+  uint64_t
+  nextU64() {
+    const uint64_t result = rotl(m_state[1] * 5, 7) * 9;
+    const uint64_t t = m_state[1] << 17;
+    m_state[2] ^= m_state[0];
+    m_state[3] ^= m_state[1];
+    m_state[1] ^= m_state[2];
+    m_state[0] ^= m_state[3];
+    m_state[2] ^= t;
+    m_state[3] = rotl(m_state[3], 45);
+    return result;
+  }
+
+  // Siguiente número de 32 bits (los bits altos de nextU64).
+  uint32_t
+  nextU32() { return static_cast<uint32_t>(nextU64() >> 32); }
+
+  // Entero uniforme en [0, bound) sin sesgo de módulo apreciable (método de Lemire).
+  uint32_t
+  nextInt(uint32_t bound) {
+    return static_cast<uint32_t>((static_cast<uint64_t>(nextU32()) * bound) >> 32);
+  }
+
+  // Float uniforme en [0, 1) con 24 bits aleatorios.
+  float
+  nextFloat() { return static_cast<float>(nextU64() >> 40) * kFloatUnit; }
+
+  // Float uniforme en [min, max).
+  float
+  range(float min, float max) { return min + (max - min) * nextFloat(); }
+
+  // Vector de magnitud 1 con dirección uniforme.
+  Vector2
+  unitVector() {
+    float sine = 0.0f, cosine = 0.0f;
+    MathEngine::sincos(range(-MathEngine::PI, MathEngine::PI), sine, cosine);
+    return Vector2(cosine, sine);
+  }
+
+  /**
+   * @brief Separa un flujo independiente.
+   * Devuelve un generador con el estado actual y adelanta este 2^192 pasos, así que
+   * ninguno de los dos (ni sus flujos internos) se traslapa con el otro. Llamadas
+   * sucesivas desde la misma semilla dan los mismos flujos.
+   */
+  Random
+  split();
+
+  /**
+   * @brief Llena out con count floats uniformes en [0, 1).
+   * Cada paso de los flujos internos produce kBlockSize números; si count no es
+   * múltiplo se descarta el resto del último paso.
+   */
+  void
+  fillUniform(float* out, size_t count);
+
+  // Llena out con count floats uniformes en [min, max).
+  void
+  fillRange(float* out, size_t count, float min, float max);
+
+  /**
+   * @brief Llena out con vectores unitarios de dirección uniforme.
+   * Genera ángulos en [-pi, pi) en bloque y los convierte con MathBatch::rotateScaleBatch.
+   */
+  void
+  fillUnitVectors(MathBatch::Vector2Span out);
+
+private:
+  // 2^-24: convierte 24 bits a un float en [0, 1).
+  static constexpr float kFloatUnit = 1.0f / 16777216.0f;
+
+  static constexpr uint64_t
+  rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+  // Aplica un polinomio de salto (avanza 2^128 o 2^192 pasos) al estado state.
+  static void
+  jump(uint64_t state[4], const uint64_t polynomial[4]);
+
+  // Reparte los flujos internos a 1..kLanes saltos de 2^128 desde el estado escalar.
+  void
+  resetLanes();
+
+  // Llena blocks pasos completos: out[i] = offset + scale * u con u en [0, 1).
+  void
+  fillBlocks(float* out, size_t blocks, float offset, float scale);
+
+  uint64_t m_state[4];
+  uint64_t m_lanes[4][kLanes]; // [palabra][flujo], para cargar un registro por palabra.
+};
@@ -0,0 +1,84 @@
+#pragma once
+#include "Prerequisites.h"
+#include "RenderQueue.h"
+#include "ShapeFactory.h"
+#include "SceneSnapshot.h"
+
+class Window;
+
+/**
+ * @brief Estadísticas de render del frame.
+ */
+struct
+RenderStats {
+  size_t commands = 0;          // Comandos enviados a la cola.
+  size_t drawCalls = 0;         // Llamadas de dibujo emitidas por el batcher.
+  size_t stateChanges = 0;      // Cambios de textura/mezcla después de ordenar.
+  size_t stateChangesSaved = 0; // Cambios evitados frente al orden de envío.
+  size_t vertices = 0;          // Vértices dinámicos generados.
+  size_t staticVertices = 0;    // Vértices horneados de los actores estáticos.
+  size_t lodSwitches = 0;       // Formas que cambiaron de nivel de detalle en el frame.
+  size_t threads = 1;           // Hilos que construyeron vértices.
+  float buildMs = 0.0f;         // Tiempo de la fase paralela de construcción.
+  float submitMs = 0.0f;        // Tiempo de la fase serial de envío.
+};
+
+/**
+ * @brief Fusiona los comandos ordenados en lotes de dibujo.
+ * El render se divide en dos fases:
+ * - build: la cola ordenada se parte en bloques contiguos y cada hilo del JobSystem
+ *   genera los vértices de su bloque en su propio chunk, abriendo un lote nuevo cada
+ *   vez que cambia la textura o el modo de mezcla. No toca SFML/OpenGL.
+ * - submit: el hilo dueño del contexto recorre los chunks en orden y emite una
+ *   llamada de dibujo por lote.
+ */
+class
+RenderBatcher {
+public:
+  RenderBatcher() = default;
+  ~RenderBatcher() = default;
+
+ /**
+  * @brief Construye los lotes a partir de la cola ordenada (fase paralela).
+  * @param queue Cola de comandos ya ordenada.
+  * @param items Formas de la instantánea a las que apuntan los índices de los comandos.
+  */
+  void
+  build(const RenderQueue& queue, const std::vector<RenderProxy>& items);
+
+  // Dibuja los lotes construidos en la ventana (fase serial, hilo principal).
+  void
+  submit(Window& window);
+
+  // Estadísticas del último frame construido.
+  const RenderStats&
+  getStats() const { return m_stats; }
+
+private:
+  // Rango de vértices que comparten estado de render.
+  struct
+  Batch {
+    const sf::Texture* texture = nullptr;
+    sf::BlendMode blendMode;
+    size_t firstVertex = 0;
+    size_t vertexCount = 0;
+  };
+
+  // Vértices y lotes generados por un hilo.
+  struct
+  Chunk {
+    std::vector<sf::Vertex> vertices;
+    std::vector<Batch> batches;
+  };
+
+  // Genera los vértices de los comandos [begin, end) en el chunk indicado.
+  void
+  buildRange(const RenderQueue& queue,
+             const std::vector<RenderProxy>& items,
+             size_t begin,
+             size_t end,
+             Chunk& chunk) const;
+
+  std::vector<Chunk> m_chunks;
+  RenderStats m_stats;
+};
@@ -0,0 +1,131 @@
+#pragma once
+#include "Prerequisites.h"
+
+/**
+ * @brief Comando de render compacto.
+ * La llave de 64 bits empaqueta, del bit más significativo al menos significativo:
+ * - capa (8 bits)
+ * - profundidad / z-order (16 bits, con sesgo para ordenar valores negativos)
+ * - id de textura (16 bits)
+ * - modo de mezcla (4 bits)
+ * - 20 bits en cero: el radix sort es estable, así que los comandos con la misma llave
+ *   conservan el orden de envío sin guardar una secuencia (que se desbordaría).
+ */
+struct
+RenderCommand {
+  uint64_t key = 0;    // Llave de ordenamiento.
+  uint32_t index = 0;  // Índice del elemento que genera el comando (p. ej. el actor).
+};
+
+/**
+ * @brief Cola de comandos de render ordenada por llave.
+ * Cada frame se llenan los comandos, se ordenan con radix sort (LSD, 8 bits por
+ * pasada) y el batcher fusiona los comandos adyacentes que comparten estado.
+ */
+class
+RenderQueue {
+public:
+  // Desplazamientos y tamaños de cada campo de la llave.
+  static constexpr int kLayerShift = 56;
+  static constexpr int kDepthShift = 40;
+  static constexpr int kTextureShift = 24;
+  static constexpr int kBlendShift = 20;
+
+  // Ids distintos que caben en cada campo por frame.
+  static constexpr size_t kMaxTextureIds = 1u << 16;
+  static constexpr size_t kMaxBlendIds = 1u << 4;
+
+  RenderQueue() = default;
+  ~RenderQueue() = default;
+
+  /**
+   * @brief Limpia los comandos del frame anterior.
+   * También olvida los ids de textura y los modos de mezcla propios, que solo valen
+   * dentro de un frame; así las tablas no crecen con cada textura que se haya usado.
+   */
+  void
+  clear();
+
+ /**
+  * @brief Agrega un comando a la cola.
+  * @param layer Capa del elemento (las capas bajas se dibujan primero).
+  * @param depth Orden dentro de la capa (los valores bajos se dibujan primero).
+  * @param texture Textura que usa el elemento (puede ser nullptr).
+  * @param blendMode Modo de mezcla del elemento.
+  * @param index Índice del elemento que genera el comando.
+  */
+  void
+  push(uint8_t layer,
+       int16_t depth,
+       const sf::Texture* texture,
+       const sf::BlendMode& blendMode,
+       uint32_t index);
+
+  // Ordena los comandos por llave con radix sort.
+  void
+  sort();
+
+  // Obtiene los comandos de la cola.
+  const std::vector<RenderCommand>&
+  getCommands() const { return m_commands; }
+
+  // Obtiene la textura asociada a un id.
+  const sf::Texture*
+  getTexture(uint16_t textureId) const;
+
+  // Obtiene el modo de mezcla asociado a un id.
+  const sf::BlendMode&
+  getBlendMode(uint8_t blendId) const;
+
+  // Extrae el id de textura de una llave.
+  static uint16_t
+  textureIdFromKey(uint64_t key) {
+    return static_cast<uint16_t>(key >> kTextureShift);
+  }
+
+  // Extrae el id del modo de mezcla de una llave.
+  static uint8_t
+  blendIdFromKey(uint64_t key) {
+    return static_cast<uint8_t>((key >> kBlendShift) & 0xF);
+  }
+
+  // Extrae la parte de la llave que define el estado de render (textura y mezcla).
+  static uint32_t
+  stateFromKey(uint64_t key) {
+    return static_cast<uint32_t>((key >> kBlendShift) & 0xFFFFF);
+  }
+
+ /**
+  * @brief Cambios de estado que provocaría dibujar en el orden de envío.
+  * Se compara con los cambios después de ordenar para medir el ahorro.
+  */
+  size_t
+  getUnsortedStateChanges() const { return m_unsortedStateChanges; }
+
+private:
+  // Obtiene (o asigna) el id de una textura. El id 0 corresponde a "sin textura".
+  uint16_t
+  getTextureId(const sf::Texture* texture);
+
+  /**
+   * @brief Obtiene (o asigna) el id de 4 bits de un modo de mezcla.
+   * Los ids 0-3 son BlendAlpha, BlendAdd, BlendMultiply y BlendNone; cualquier otro modo
+   * (BlendMin, modos propios) recibe el siguiente id libre.
+   */
+  uint8_t
+  getBlendId(const sf::BlendMode& blendMode);
+
+  // Modos de mezcla predefinidos, en el orden de sus ids.
+  static std::vector<sf::BlendMode>
+  getBuiltinBlendModes() {
+    return { sf::BlendAlpha, sf::BlendAdd, sf::BlendMultiply, sf::BlendNone };
+  }
+
+  std::vector<RenderCommand> m_commands;
+  std::vector<RenderCommand> m_scratch; // Buffer auxiliar del radix sort.
+  std::unordered_map<const sf::Texture*, uint16_t> m_textureIds;
+  std::vector<const sf::Texture*> m_textures; // Textura por id.
+  std::vector<sf::BlendMode> m_blendModes = getBuiltinBlendModes(); // Modo por id.
+  size_t m_unsortedStateChanges = 0;
+  uint32_t m_lastState = 0xFFFFFFFF;
+};
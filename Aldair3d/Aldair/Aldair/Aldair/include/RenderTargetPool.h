@@ -0,0 +1,85 @@
+#pragma once
+#include "Prerequisites.h"
+
+/**
+ * @brief Formato de un destino de render.
+ * Dos destinos solo son intercambiables si comparten el mismo formato.
+ */
+struct
+RenderTargetFormat {
+  unsigned int depthBits = 0;     // Bits del buffer de profundidad.
+  unsigned int antialiasing = 0;  // Nivel de multisampling.
+  bool sRgb = false;              // Framebuffer con conversión sRGB.
+
+  bool
+  operator==(const RenderTargetFormat& other) const {
+    return depthBits == other.depthBits && antialiasing == other.antialiasing && sRgb == other.sRgb;
+  }
+};
+
+/**
+ * @brief Reserva de sf::RenderTexture reutilizables.
+ * Los destinos se crean con tamaños redondeados hacia arriba a múltiplos de un paso,
+ * por lo que tamaños intermedios (por ejemplo durante un redimensionamiento) caben en
+ * un destino ya existente. Quien lo usa dibuja solo en el subrectángulo que necesita,
+ * ajustando el viewport de su vista.
+ *
+ * Al liberar un destino este vuelve a la reserva sin destruirse; trim() libera la
+ * memoria de los que no están en uso.
+ */
+class
+RenderTargetPool {
+public:
+  /**
+   * @brief Constructor de la reserva.
+   * @param step Paso en píxeles al que se redondea el tamaño de cada destino.
+   */
+  RenderTargetPool(unsigned int step = 256);
+
+  ~RenderTargetPool() = default;
+
+  RenderTargetPool(const RenderTargetPool&) = delete;
+  RenderTargetPool& operator=(const RenderTargetPool&) = delete;
+
+  /**
+   * @brief Obtiene un destino de al menos el tamaño pedido.
+   * Reutiliza el destino libre más pequeño del mismo formato que lo contenga (sin
+   * exceder el doble del tamaño redondeado en cada eje); si no hay ninguno crea uno.
+   * @return Destino propiedad de la reserva, o nullptr si no se pudo crear.
+   */
+  sf::RenderTexture*
+  acquire(unsigned int width, unsigned int height,
+          const RenderTargetFormat& format = RenderTargetFormat());
+
+  // Devuelve un destino a la reserva para que pueda reutilizarse.
+  void
+  release(sf::RenderTexture* target);
+
+  // Destruye los destinos que no están en uso.
+  void
+  trim();
+
+  // Redondea un tamaño hacia arriba al paso de la reserva.
+  unsigned int
+  bucketSize(unsigned int size) const;
+
+  // Número de destinos vivos (en uso y libres).
+  size_t
+  getTargetCount() const { return m_entries.size(); }
+
+  // Número total de destinos creados desde el inicio.
+  size_t
+  getAllocationCount() const { return m_allocations; }
+
+private:
+  struct
+  Entry {
+    std::unique_ptr<sf::RenderTexture> target;
+    RenderTargetFormat format;
+    bool inUse = false;
+  };
+
+  unsigned int m_step;
+  size_t m_allocations = 0;
+  std::vector<Entry> m_entries;
+};
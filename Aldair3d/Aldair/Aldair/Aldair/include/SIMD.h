@@ -0,0 +1,153 @@
+#pragma once
+#include <cstdint>
+/**
+ * @brief Selección del conjunto de instrucciones SIMD de la biblioteca matemática.
+ * Se decide al compilar:
+ *  - AVX2 (/arch:AVX2, -mavx2): rutas de 256 bits para operaciones en bloque.
+ *  - SSE4.1 (/arch:AVX, -msse4.1): producto punto con dpps y mezclas con blendps.
+ *  - SSE2 (toda compilación x64): mismas rutas con equivalentes de SSE2.
+ *  - Escalar: cualquier otra arquitectura.
+ */
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define ALDAIR_SIMD_AVX2
+#define ALDAIR_SIMD_SSE41
+#define ALDAIR_SIMD_SSE
+#elif defined(__SSE4_1__) || defined(__AVX__)
+#include <smmintrin.h>
+#define ALDAIR_SIMD_SSE41
+#define ALDAIR_SIMD_SSE
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ALDAIR_SIMD_SSE
+#endif
+
+namespace SIMD {
+  // Nombre del conjunto de instrucciones con el que se compiló.
+  inline const char*
+  getInstructionSetName() {
+#if defined(ALDAIR_SIMD_AVX2)
+    return "AVX2";
+#elif defined(ALDAIR_SIMD_SSE41)
+    return "SSE4.1";
+#elif defined(ALDAIR_SIMD_SSE)
+    return "SSE2";
+#else
+    return "Escalar";
+#endif
+  }
+
+#if defined(ALDAIR_SIMD_SSE)
+  // Máscara con el bit de signo en los carriles indicados (1 = cambia el signo).
+  inline __m128
+  signMask(int lane0, int lane1, int lane2, int lane3) {
+    return _mm_castsi128_ps(_mm_set_epi32(lane3 ? INT32_MIN : 0, lane2 ? INT32_MIN : 0,
+                                          lane1 ? INT32_MIN : 0, lane0 ? INT32_MIN : 0));
+  }
+
+  // Producto punto de cuatro componentes, repetido en los cuatro carriles.
+  inline __m128
+  dot4(__m128 a, __m128 b) {
+#if defined(ALDAIR_SIMD_SSE41)
+    return _mm_dp_ps(a, b, 0xFF);
+#else
+    __m128 product = _mm_mul_ps(a, b);
+    product = _mm_add_ps(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_add_ps(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(1, 0, 3, 2)));
+#endif
+  }
+
+  /**
+   * @brief 1 / sqrt(x) con la estimación de rsqrtps y un paso de Newton-Raphson.
+   * El error relativo queda cerca de 2^-22. Para x = 0 devuelve infinito.
+   */
+  inline __m128
+  rsqrt(__m128 x) {
+    const __m128 estimate = _mm_rsqrt_ps(x);
+    const __m128 halfX = _mm_mul_ps(_mm_set1_ps(0.5f), x);
+    const __m128 correction = _mm_sub_ps(_mm_set1_ps(1.5f),
+                                         _mm_mul_ps(halfX, _mm_mul_ps(estimate, estimate)));
+    return _mm_mul_ps(estimate, correction);
+  }
+
+  // Normaliza v; un vector de magnitud 0 queda en 0.
+  inline __m128
+  normalize4(__m128 v) {
+    const __m128 lengthSquared = dot4(v, v);
+    const __m128 nonZero = _mm_cmpgt_ps(lengthSquared, _mm_setzero_ps());
+    return _mm_and_ps(_mm_mul_ps(v, rsqrt(lengthSquared)), nonZero);
+  }
+
+  // Toma los carriles 0-2 de a y el carril 3 de b.
+  inline __m128
+  blendLane3(__m128 a, __m128 b) {
+#if defined(ALDAIR_SIMD_SSE41)
+    return _mm_blend_ps(a, b, 0x8);
+#else
+    const __m128 mask = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+    return _mm_or_ps(_mm_andnot_ps(mask, a), _mm_and_ps(mask, b));
+#endif
+  }
+
+  // Producto cruz de los carriles (x, y, z); el carril 3 del resultado queda en 0.
+  inline __m128
+  cross3(__m128 a, __m128 b) {
+    const __m128 aYzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+    const __m128 bYzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+    const __m128 c = _mm_sub_ps(_mm_mul_ps(a, bYzx), _mm_mul_ps(aYzx, b));
+    return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+  }
+
+  /**
+   * @brief Producto de Hamilton a * b con los carriles en orden (w, x, y, z).
+   * Cada componente de a se repite en los cuatro carriles y multiplica una permutación
+   * de b con los signos del producto; no hay accesos a componentes sueltas.
+   */
+  inline __m128
+  quaternionMultiply(__m128 a, __m128 b) {
+    const __m128 aw = _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 0));
+    const __m128 ax = _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1));
+    const __m128 ay = _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 2, 2));
+    const __m128 az = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 3, 3));
+    // (-bx, bw, -bz, by), (-by, bz, bw, -bx), (-bz, -by, bx, bw)
+    const __m128 bx = _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1)), signMask(1, 0, 1, 0));
+    const __m128 by = _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2)), signMask(1, 0, 0, 1));
+    const __m128 bz = _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 1, 2, 3)), signMask(1, 1, 0, 0));
+    __m128 result = _mm_mul_ps(aw, b);
+    result = _mm_add_ps(result, _mm_mul_ps(ax, bx));
+    result = _mm_add_ps(result, _mm_mul_ps(ay, by));
+    return _mm_add_ps(result, _mm_mul_ps(az, bz));
+  }
+#endif
+
+#if defined(ALDAIR_SIMD_AVX2)
+  // Igual que cross3, con dos pares de vectores por registro. Con FMA el carril 3 solo
+  // queda en 0 si el de a es 0.
+  inline __m256
+  cross3(__m256 a, __m256 b) {
+    const __m256 aYzx = _mm256_permute_ps(a, _MM_SHUFFLE(3, 0, 2, 1));
+    const __m256 bYzx = _mm256_permute_ps(b, _MM_SHUFFLE(3, 0, 2, 1));
+    const __m256 c = _mm256_fmsub_ps(a, bYzx, _mm256_mul_ps(aYzx, b));
+    return _mm256_permute_ps(c, _MM_SHUFFLE(3, 0, 2, 1));
+  }
+
+  // Igual que quaternionMultiply, con dos pares de cuaterniones por registro.
+  inline __m256
+  quaternionMultiply(__m256 a, __m256 b) {
+    const __m256 aw = _mm256_permute_ps(a, _MM_SHUFFLE(0, 0, 0, 0));
+    const __m256 ax = _mm256_permute_ps(a, _MM_SHUFFLE(1, 1, 1, 1));
+    const __m256 ay = _mm256_permute_ps(a, _MM_SHUFFLE(2, 2, 2, 2));
+    const __m256 az = _mm256_permute_ps(a, _MM_SHUFFLE(3, 3, 3, 3));
+    const __m256 signX = _mm256_set_m128(signMask(1, 0, 1, 0), signMask(1, 0, 1, 0));
+    const __m256 signY = _mm256_set_m128(signMask(1, 0, 0, 1), signMask(1, 0, 0, 1));
+    const __m256 signZ = _mm256_set_m128(signMask(1, 1, 0, 0), signMask(1, 1, 0, 0));
+    const __m256 bx = _mm256_xor_ps(_mm256_permute_ps(b, _MM_SHUFFLE(2, 3, 0, 1)), signX);
+    const __m256 by = _mm256_xor_ps(_mm256_permute_ps(b, _MM_SHUFFLE(1, 0, 3, 2)), signY);
+    const __m256 bz = _mm256_xor_ps(_mm256_permute_ps(b, _MM_SHUFFLE(0, 1, 2, 3)), signZ);
+    __m256 result = _mm256_mul_ps(aw, b);
+    result = _mm256_fmadd_ps(ax, bx, result);
+    result = _mm256_fmadd_ps(ay, by, result);
+    return _mm256_fmadd_ps(az, bz, result);
+  }
+#endif
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include "MathEngine.h"
+#include "Vector2.h"
+#include "FixedVector2.h"
+#include <cstdint>
+
+/**
+ * @brief Operaciones del escalar de la simulación, para escribir sistemas de juego como
+ * plantillas sobre float (rápido, pero sus bits cambian entre compiladores) o Fixed32
+ * (determinista, para lockstep y repeticiones).
+ *
+ * Cada especialización define el vector 2D que corresponde al escalar y las funciones
+ * que el código genérico no puede escribir con operadores.
+ */
+template<typename Scalar>
+struct
+ScalarTraits;
+
+template<>
+struct
+ScalarTraits<float> {
+  using Vector = Vector2;
+
+  static constexpr float
+  fromInt(int value) { return static_cast<float>(value); }
+
+  static constexpr float
+  fromRatio(int numerator, int denominator) { return static_cast<float>(numerator) / static_cast<float>(denominator); }
+
+  static constexpr float
+  toFloat(float value) { return value; }
+
+  static constexpr float
+  sqrt(float value) { return MathEngine::sqrt(value); }
+
+  static constexpr float
+  sin(float angle) { return MathEngine::sin(angle); }
+
+  static constexpr float
+  cos(float angle) { return MathEngine::cos(angle); }
+
+  static constexpr float
+  pi() { return MathEngine::PI; }
+
+  // Bits que entran al hash del estado.
+  static constexpr uint32_t
+  toBits(float value) { return MathEngine::detail::toBits(value); }
+};
+
+template<>
+struct
+ScalarTraits<Fixed32> {
+  using Vector = FixedVector2;
+
+  static constexpr Fixed32
+  fromInt(int value) { return Fixed32::fromInt(value); }
+
+  static constexpr Fixed32
+  fromRatio(int numerator, int denominator) { return Fixed32::fromRatio(numerator, denominator); }
+
+  static constexpr float
+  toFloat(Fixed32 value) { return value.toFloat(); }
+
+  static constexpr Fixed32
+  sqrt(Fixed32 value) { return FixedMath::sqrt(value); }
+
+  static constexpr Fixed32
+  sin(Fixed32 angle) { return FixedMath::sin(angle); }
+
+  static constexpr Fixed32
+  cos(Fixed32 angle) { return FixedMath::cos(angle); }
+
+  static constexpr Fixed32
+  pi() { return FixedMath::PI; }
+
+  static constexpr uint32_t
+  toBits(Fixed32 value) { return static_cast<uint32_t>(value.raw); }
+};
+
+// Sistemas de movimiento escritos sobre cualquier escalar con ScalarTraits.
+namespace Steering {
+  /**
+   * @brief Mueve position hacia target a speed unidades por segundo.
+   * No se mueve si ya está a menos de range. Es el cuerpo de Transform::Seek.
+   */
+  template<typename Scalar>
+  constexpr void
+  seek(typename ScalarTraits<Scalar>::Vector& position,
+       const typename ScalarTraits<Scalar>::Vector& target,
+       Scalar speed,
+       Scalar deltaTime,
+       Scalar range) {
+    typename ScalarTraits<Scalar>::Vector direction = target - position;
+    const Scalar length = direction.magnitude();
+    if (length > range) {
+      direction /= length;  // Normaliza el vector
+      position += direction * speed * deltaTime;
+    }
+  }
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include "Prerequisites.h"
+#include "Services/ShapePrototypeCache.h"
+#include <chrono>
+
+/**
+ * @brief Estado de render de una forma copiado desde la simulación.
+ * No apunta a ningún actor: la geometría es el prototipo compartido (inmutable) y la
+ * textura pertenece al ResourceManager, así que el hilo de render puede usarla
+ * mientras la simulación sigue modificando los actores.
+ */
+struct
+RenderProxy {
+  Matrix3x3 transform;                      // Transformación de la forma.
+  const ShapePrototype* prototype = nullptr; // Geometría compartida.
+  const sf::Texture* texture = nullptr;     // Textura (nullptr si no tiene).
+  sf::IntRect textureRect;                  // Región de la textura.
+  sf::Color color = sf::Color::White;       // Color de relleno.
+  sf::BlendMode blendMode = sf::BlendAlpha; // Modo de mezcla.
+  uint8_t layer = 0;                        // Capa del actor.
+  int16_t zOrder = 0;                       // Orden dentro de la capa.
+
+  // Agrega los triángulos de la forma en espacio de mundo.
+  void
+  appendVertices(std::vector<sf::Vertex>& vertices) const {
+    if (prototype) {
+      prototype->appendVertices(transform, color, textureRect, vertices);
+    }
+  }
+};
+
+/**
+ * @brief Instantánea inmutable de lo que se dibuja en un paso de simulación.
+ * La simulación la llena y la publica en un TripleBuffer; el hilo principal dibuja la
+ * más reciente que esté completa.
+ */
+struct
+SceneSnapshot {
+  std::vector<RenderProxy> shapes;      // Formas dinámicas visibles.
+  std::vector<sf::Vertex> particles;    // Quads de todos los emisores.
+  uint64_t step = 0;                    // Paso de simulación que la generó.
+  uint64_t sceneVersion = 0;            // Cambia cuando algo visible cambió.
+  size_t totalActors = 0;               // Actores en la escena.
+  size_t lodSwitches = 0;               // Formas que cambiaron de nivel de detalle.
+  float simulationWaitMs = 0.0f;        // Espera de la simulación por el mundo.
+  std::chrono::steady_clock::time_point publishedAt; // Momento de la publicación.
+};
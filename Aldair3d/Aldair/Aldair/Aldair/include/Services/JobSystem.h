@@ -0,0 +1,185 @@
+#pragma once
+#include "Prerequisites.h"
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+/**
+ * @brief Sistema de trabajos con hilos persistentes.
+ * Ofrece un parallelFor que divide un rango en bloques contiguos y los reparte entre
+ * los hilos de trabajo y el hilo que lo llama. Cada bloque recibe un índice de
+ * ranura (slot) menor que getThreadCount(), de forma que el llamador puede escribir
+ * resultados por hilo sin sincronización y luego unirlos en orden.
+ *
+ * Las llamadas a parallelFor no deben anidarse dentro de un trabajo.
+ */
+class
+JobSystem {
+private:
+  /**
+   * @brief Constructor privado para evitar instancias múltiples.
+   * Crea un hilo de trabajo por núcleo, menos el del hilo principal.
+   */
+  JobSystem() {
+    unsigned int cores = std::thread::hardware_concurrency();
+    start(cores > 1 ? cores - 1 : 0);
+  }
+
+  // Deshabilitar copia y asignación
+  JobSystem(const JobSystem&) = delete;
+  JobSystem& operator=(const JobSystem&) = delete;
+
+public:
+  ~JobSystem() {
+    stop();
+  }
+
+  /**
+   * @brief Obtiene la instancia única del JobSystem.
+   * @return Referencia al Singleton JobSystem.
+   */
+  static JobSystem&
+  getInstance() {
+    static JobSystem instance;
+    return instance;
+  }
+
+  // Número de hilos que participan en un parallelFor (incluye al llamador).
+  size_t
+  getThreadCount() const {
+    return m_workers.size() + 1;
+  }
+
+  /**
+   * @brief Cambia el número de hilos que participan en los trabajos.
+   * Se usa para medir cómo escala una fase con el número de núcleos.
+   * @param count Hilos totales, incluido el llamador (mínimo 1).
+   */
+  void
+  setThreadCount(size_t count) {
+    std::lock_guard<std::mutex> submitLock(m_submitMutex);
+    stop();
+    start(count > 1 ? count - 1 : 0);
+  }
+
+  /**
+   * @brief Ejecuta fn sobre el rango [0, count) repartido entre los hilos.
+   * @param count Número de elementos.
+   * @param minBatch Tamaño mínimo de cada bloque; rangos pequeños se ejecutan en el llamador.
+   * @param fn Función con firma fn(begin, end, slot).
+   */
+  template<typename Fn>
+  void
+  parallelFor(size_t count, size_t minBatch, Fn&& fn) {
+    if (count == 0) {
+      return;
+    }
+
+    std::lock_guard<std::mutex> submitLock(m_submitMutex);
+    size_t slots = std::min(getThreadCount(), (count + minBatch - 1) / std::max<size_t>(minBatch, 1));
+    if (slots <= 1) {
+      fn(size_t(0), count, size_t(0));
+      return;
+    }
+
+    const size_t blockSize = (count + slots - 1) / slots;
+    uint64_t generation = 0;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_job = [&fn, blockSize, count](size_t slot) {
+        size_t begin = slot * blockSize;
+        size_t end = std::min(begin + blockSize, count);
+        if (begin < end) {
+          fn(begin, end, slot);
+        }
+      };
+      m_jobSlots = slots;
+      m_nextSlot = 0;
+      m_pendingSlots = slots;
+      generation = ++m_generation;
+    }
+    m_wake.notify_all();
+
+    // El hilo que llama también trabaja.
+    runSlots(generation);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this]() { return m_pendingSlots == 0; });
+    m_job = nullptr;
+  }
+
+private:
+  void
+  start(size_t workerCount) {
+    m_stop = false;
+    for (size_t i = 0; i < workerCount; ++i) {
+      m_workers.emplace_back([this]() { workerLoop(); });
+    }
+  }
+
+  void
+  stop() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_wake.notify_all();
+    for (std::thread& worker : m_workers) {
+      worker.join();
+    }
+    m_workers.clear();
+  }
+
+  /**
+   * @brief Toma ranuras libres del trabajo actual hasta que no quede ninguna.
+   * Las ranuras se reclaman bajo el mutex junto con la generación, así un hilo que
+   * despertó tarde nunca toma una ranura de un trabajo posterior.
+   */
+  void
+  runSlots(uint64_t generation) {
+    for (;;) {
+      size_t slot = 0;
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (generation != m_generation || m_nextSlot >= m_jobSlots) {
+          return;
+        }
+        slot = m_nextSlot++;
+      }
+      m_job(slot);
+
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (--m_pendingSlots == 0) {
+        m_done.notify_one();
+      }
+    }
+  }
+
+  void
+  workerLoop() {
+    uint64_t seenGeneration = 0;
+    for (;;) {
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_wake.wait(lock, [&]() { return m_stop || m_generation != seenGeneration; });
+        if (m_stop) {
+          return;
+        }
+        seenGeneration = m_generation;
+      }
+      runSlots(seenGeneration);
+    }
+  }
+
+  std::vector<std::thread> m_workers;
+  std::mutex m_submitMutex; // Serializa las llamadas a parallelFor.
+  std::mutex m_mutex;
+  std::condition_variable m_wake;
+  std::condition_variable m_done;
+  std::function<void(size_t)> m_job;
+  size_t m_jobSlots = 0;
+  size_t m_nextSlot = 0;
+  size_t m_pendingSlots = 0;
+  uint64_t m_generation = 0;
+  bool m_stop = false;
+};
@@ -0,0 +1,74 @@
+#pragma once
+#include "Prerequisites.h"
+#include "Random.h"
+#include <mutex>
+
+/**
+ * @brief Servicio de números aleatorios del motor.
+ * Todos los flujos salen de una sola semilla con Random::split, así que fijar la
+ * semilla (por ejemplo la de una repetición) reproduce todos los números del motor:
+ *  - un flujo principal para el hilo principal,
+ *  - flujos propios para componentes, en el orden en que se crean.
+ * Ningún flujo depende de la máquina (por ejemplo del número de núcleos), así que una
+ * repetición grabada en un equipo da los mismos números en otro.
+ */
+class
+RandomService {
+private:
+  // Constructor privado para evitar instancias múltiples.
+  RandomService() { setSeed(kDefaultSeed); }
+
+  // Deshabilitar copia y asignación
+  RandomService(const RandomService&) = delete;
+  RandomService& operator=(const RandomService&) = delete;
+
+public:
+  // Semilla con la que arranca el motor.
+  static constexpr uint64_t kDefaultSeed = 0x41646c6169723344ull;
+
+  /**
+   * @brief Obtiene la instancia única del RandomService.
+   * @return Referencia al Singleton RandomService.
+   */
+  static RandomService&
+  getInstance() {
+    static RandomService instance;
+    return instance;
+  }
+
+  /**
+   * @brief Reinicia todos los flujos a partir de seed.
+   * No debe llamarse mientras otro hilo usa un flujo del servicio.
+   */
+  void
+  setSeed(uint64_t seed) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_seed = seed;
+    Random root(seed);
+    m_mainStream = root.split();
+    m_spawner = root.split();
+  }
+
+  uint64_t
+  getSeed() const { return m_seed; }
+
+  // Flujo del hilo principal.
+  Random&
+  getMainStream() { return m_mainStream; }
+
+  /**
+   * @brief Crea un flujo independiente para un componente.
+   * Con la misma semilla y el mismo orden de creación, cada componente recibe el mismo flujo.
+   */
+  Random
+  createStream() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_spawner.split();
+  }
+
+private:
+  std::mutex m_mutex;
+  uint64_t m_seed = 0;
+  Random m_mainStream;
+  Random m_spawner;
+};
@@ -1,6 +1,7 @@
 #pragma once
 #include "Prerequisites.h"
 #include "Texture.h"
+#include "TextureAtlas.h"
 
 class ResourceManager {
 private:
@@ -40,6 +41,47 @@ public:
         return true; // Retornar xito
     }
 
+    /**
+     * @brief Carga una textura dentro del atlas compartido si no existe.
+     * Las texturas pequeas se empaquetan en las pginas del atlas para que las formas
+     * que las usan compartan el mismo sf::Texture y puedan dibujarse en un solo lote.
+     * Antes de insertar se recupera el espacio de las texturas descargadas si supera el
+     * umbral del atlas, para no crear pginas nuevas con huecos libres.
+     * @param fileName Nombre del archivo de la textura.
+     * @param extension Extensin del archivo de textura.
+     * @return `false` si la imagen no se pudo cargar o no cabe en una pgina del atlas.
+     */
+    bool loadTextureToAtlas(const std::string& fileName, const std::string& extension) {
+        if (m_atlas.contains(fileName)) {
+            return true;
+        }
+        sf::Image image;
+        if (!image.loadFromFile(fileName + "." + extension)) {
+            return false;
+        }
+        m_atlas.defragmentIfNeeded();
+        return m_atlas.insert(fileName, image);
+    }
+
+    /**
+     * @brief Descarga una textura del administrador y del atlas.
+     * Si el espacio libre del atlas supera el umbral, lo desfragmenta; las formas y los
+     * mapas de tiles remapean sus regiones al ver la nueva versin del atlas.
+     * @param fileName Nombre del archivo de la textura.
+     */
+    void unloadTexture(const std::string& fileName) {
+        m_textures.erase(fileName);
+        if (m_atlas.contains(fileName)) {
+            m_atlas.remove(fileName);
+            m_atlas.defragmentIfNeeded();
+        }
+    }
+
+    // Obtiene el atlas compartido de texturas.
+    TextureAtlas& getAtlas() {
+        return m_atlas;
+    }
+
     /**
      * @brief Obtiene una textura por su nombre. Si no existe, se retorna una textura por defecto.
      * Un puntero compartido a la textura solicitada o a una textura por defecto.
@@ -64,4 +106,7 @@ public:
 private:
     // Almacena todas las texturas cargadas con sus nombres como claves.
     std::unordered_map<std::string, EngineUtilities::TSharedPointer<Texture>> m_textures;
+
+    // Atlas donde se empaquetan las texturas pequeas.
+    TextureAtlas m_atlas;
 };
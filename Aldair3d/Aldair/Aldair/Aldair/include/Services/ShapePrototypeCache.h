@@ -0,0 +1,232 @@
+#pragma once
+#include "Prerequisites.h"
+#include "Matrix3x3.h"
+#include "MathTables.h"
+#include <tuple>
+
+/**
+ * @brief Geometría compartida de una forma en espacio local.
+ * Guarda los puntos del contorno igual que sf::Shape y su triangulación en abanico,
+ * con las coordenadas de textura normalizadas (0-1) dentro de los límites locales.
+ * Todas las formas con el mismo tipo y parámetros apuntan al mismo prototipo.
+ */
+struct
+ShapePrototype {
+  ShapeType type = ShapeType::EMPTY;
+  std::vector<sf::Vector2f> points;        // Contorno en espacio local.
+  std::vector<sf::Vector2f> triangles;     // Triangulación en abanico (3 vértices por triángulo).
+  std::vector<sf::Vector2f> textureCoords; // Coordenadas normalizadas de cada vértice de triangles.
+  sf::FloatRect localBounds;               // Límites de los puntos en espacio local.
+
+  /**
+   * @brief Agrega la triangulación transformada a espacio de mundo.
+   * Las coordenadas de textura normalizadas se mapean al rectángulo de textura de la
+   * instancia, igual que en sf::Shape. Las posiciones se transforman en bloque y se
+   * escriben directamente en los vértices de salida.
+   */
+  void
+  appendVertices(const Matrix3x3& transform, const sf::Color& color,
+                 const sf::IntRect& textureRect, std::vector<sf::Vertex>& vertices) const {
+    const sf::Vector2f textureOrigin(static_cast<float>(textureRect.left), static_cast<float>(textureRect.top));
+    const sf::Vector2f textureSize(static_cast<float>(textureRect.width), static_cast<float>(textureRect.height));
+
+    const size_t first = vertices.size();
+    vertices.resize(first + triangles.size());
+    if (triangles.empty()) {
+      return;
+    }
+    sf::Vertex* out = vertices.data() + first;
+    transform.transformPoints(&triangles[0].x, sizeof(sf::Vector2f),
+                              &out[0].position.x, sizeof(sf::Vertex), triangles.size());
+    for (size_t i = 0; i < triangles.size(); ++i) {
+      out[i].color = color;
+      out[i].texCoords = sf::Vector2f(textureOrigin.x + textureSize.x * textureCoords[i].x,
+                                      textureOrigin.y + textureSize.y * textureCoords[i].y);
+    }
+  }
+};
+
+/**
+ * @brief Caché de prototipos de formas (flyweight).
+ * Crea cada combinación de tipo y parámetros una sola vez y la comparte entre todas
+ * las formas, de modo que cada ShapeFactory solo guarda su transformación, color y
+ * rectángulo de textura. Los prototipos nunca se destruyen mientras la aplicación
+ * esté viva, así que los punteros devueltos son estables.
+ */
+class
+ShapePrototypeCache {
+public:
+  // Niveles de detalle de los círculos; cada uno duplica los lados del anterior.
+  static constexpr unsigned int kCircleLevelCount = 5;
+
+  // Nivel inicial de un círculo: 32 lados, lo más cercano a los 30 de sf::CircleShape.
+  static constexpr unsigned int kDefaultCircleLevel = 2;
+
+  // Error máximo en píxeles entre el polígono y el círculo real.
+  static constexpr float kMaxCircleError = 0.25f;
+
+  // Fracción del umbral por debajo de la cual se baja de nivel (histéresis).
+  static constexpr float kLevelHysteresis = 0.75f;
+
+private:
+  // Los círculos unitarios de cada nivel ya vienen precalculados en MathTables.
+  ShapePrototypeCache() {
+    for (unsigned int level = 0; level < kCircleLevelCount; ++level) {
+      const unsigned int pointCount = getCircleLevelPoints(level);
+      const float sagitta = 1.0f - MathEngine::cos(MathEngine::PI / pointCount);
+      m_levelMaxRadius[level] = kMaxCircleError / sagitta;
+    }
+  }
+
+  ~ShapePrototypeCache() = default;
+
+  // Deshabilitar copia y asignación
+  ShapePrototypeCache(const ShapePrototypeCache&) = delete;
+  ShapePrototypeCache& operator=(const ShapePrototypeCache&) = delete;
+
+public:
+  /**
+   * @brief Obtiene la instancia única de la caché.
+   * @return Referencia al Singleton ShapePrototypeCache.
+   */
+  static ShapePrototypeCache&
+  getInstance() {
+    static ShapePrototypeCache instance;
+    return instance;
+  }
+
+  /**
+   * @brief Obtiene el prototipo de un polígono regular inscrito en un círculo.
+   * Los puntos siguen la misma convención que sf::CircleShape: el primero está arriba
+   * y el círculo ocupa el cuadrado [0, 2r] x [0, 2r].
+   * @param type Tipo con el que se registra la forma (CIRCLE o TRIANGLE).
+   * @param radius Radio del círculo.
+   * @param pointCount Número de lados.
+   */
+  const ShapePrototype*
+  getCircle(ShapeType type, float radius, unsigned int pointCount) {
+    Key key(type, pointCount, radius, 0.0f);
+    auto it = m_prototypes.find(key);
+    if (it != m_prototypes.end()) {
+      return it->second.get();
+    }
+
+    std::vector<sf::Vector2f> points(pointCount);
+    const Vector2* unit = MathTables::getUnitCircle(pointCount);
+    for (unsigned int i = 0; i < pointCount; ++i) {
+      sf::Vector2f direction;
+      if (unit) {
+        direction = sf::Vector2f(unit[i].x, unit[i].y);
+      }
+      else {
+        const float angle = i * 2.0f * 3.14159265f / pointCount - 3.14159265f / 2.0f;
+        direction = sf::Vector2f(std::cos(angle), std::sin(angle));
+      }
+      points[i] = sf::Vector2f(radius + direction.x * radius, radius + direction.y * radius);
+    }
+    return store(key, type, std::move(points));
+  }
+
+  // Obtiene el prototipo de un círculo con los lados de un nivel de detalle.
+  const ShapePrototype*
+  getCircleLevel(ShapeType type, float radius, unsigned int level) {
+    return getCircle(type, radius, getCircleLevelPoints(level));
+  }
+
+  // Número de lados del nivel de detalle (8, 16, 32, 64, 128).
+  static unsigned int
+  getCircleLevelPoints(unsigned int level) {
+    return 8u << std::min(level, kCircleLevelCount - 1);
+  }
+
+  /**
+   * @brief Elige el nivel de detalle de un círculo según su radio en pantalla.
+   * Cada nivel se usa mientras el error de su polígono no pase de kMaxCircleError
+   * píxeles. Para subir basta con pasar el umbral del nivel actual, pero para bajar
+   * el radio debe quedar por debajo de kLevelHysteresis veces el umbral del nivel
+   * inferior, así un zoom que oscila cerca del límite no alterna entre niveles.
+   * @param projectedRadius Radio en píxeles.
+   * @param currentLevel Nivel que usa la forma actualmente.
+   */
+  unsigned int
+  selectCircleLevel(float projectedRadius, unsigned int currentLevel) const {
+    unsigned int level = std::min(currentLevel, kCircleLevelCount - 1);
+    while (level + 1 < kCircleLevelCount && projectedRadius > m_levelMaxRadius[level]) {
+      ++level;
+    }
+    while (level > 0 && projectedRadius < m_levelMaxRadius[level - 1] * kLevelHysteresis) {
+      --level;
+    }
+    return level;
+  }
+
+  /**
+   * @brief Obtiene el prototipo de un rectángulo con la esquina superior izquierda en el origen.
+   * @param size Ancho y alto del rectángulo.
+   */
+  const ShapePrototype*
+  getRectangle(const sf::Vector2f& size) {
+    Key key(ShapeType::RECTANGLE, 4u, size.x, size.y);
+    auto it = m_prototypes.find(key);
+    if (it != m_prototypes.end()) {
+      return it->second.get();
+    }
+
+    std::vector<sf::Vector2f> points = {
+      sf::Vector2f(0.0f, 0.0f), sf::Vector2f(size.x, 0.0f),
+      sf::Vector2f(size.x, size.y), sf::Vector2f(0.0f, size.y)
+    };
+    return store(key, ShapeType::RECTANGLE, std::move(points));
+  }
+
+  // Número de prototipos creados.
+  size_t
+  getPrototypeCount() const { return m_prototypes.size(); }
+
+private:
+  using Key = std::tuple<int, unsigned int, float, float>;
+
+  /**
+   * @brief Triangula el contorno y guarda el prototipo.
+   * Todas las formas de la caché son convexas, así que N puntos producen N - 2
+   * triángulos en abanico desde el primer punto.
+   */
+  const ShapePrototype*
+  store(const Key& key, ShapeType type, std::vector<sf::Vector2f> points) {
+    auto prototype = std::make_unique<ShapePrototype>();
+    prototype->type = type;
+    prototype->points = std::move(points);
+
+    const auto& contour = prototype->points;
+    if (!contour.empty()) {
+      sf::Vector2f min = contour[0];
+      sf::Vector2f max = contour[0];
+      for (const sf::Vector2f& point : contour) {
+        min.x = std::min(min.x, point.x);
+        min.y = std::min(min.y, point.y);
+        max.x = std::max(max.x, point.x);
+        max.y = std::max(max.y, point.y);
+      }
+      prototype->localBounds = sf::FloatRect(min, max - min);
+    }
+
+    const sf::FloatRect& bounds = prototype->localBounds;
+    auto normalized = [&](const sf::Vector2f& point) {
+      return sf::Vector2f(bounds.width > 0.0f ? (point.x - bounds.left) / bounds.width : 0.0f,
+                          bounds.height > 0.0f ? (point.y - bounds.top) / bounds.height : 0.0f);
+    };
+    for (size_t i = 2; i < contour.size(); ++i) {
+      for (size_t index : { size_t(0), i - 1, i }) {
+        prototype->triangles.push_back(contour[index]);
+        prototype->textureCoords.push_back(normalized(contour[index]));
+      }
+    }
+
+    const ShapePrototype* result = prototype.get();
+    m_prototypes[key] = std::move(prototype);
+    return result;
+  }
+
+  std::map<Key, std::unique_ptr<ShapePrototype>> m_prototypes;
+  std::array<float, kCircleLevelCount> m_levelMaxRadius{}; // Radio máximo en píxeles de cada nivel.
+};
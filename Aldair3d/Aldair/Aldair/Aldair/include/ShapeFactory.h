@@ -2,7 +2,17 @@
 #include "Prerequisites.h"
 #include "Component.h"
 #include "Window.h"
+#include "TextureAtlas.h"
+#include "Geometry.h"
+#include "Services/ShapePrototypeCache.h"
 
+/**
+ * @brief Componente de forma.
+ * La geometría en espacio local es un prototipo compartido de ShapePrototypeCache;
+ * cada instancia solo guarda su transformación, color, textura y rectángulo de
+ * textura. Los vértices en espacio de mundo se generan al dibujar o al construir los
+ * lotes del render.
+ */
 class
 ShapeFactory : public Component {
 public:
@@ -13,9 +23,13 @@ public:
 
   // Constructor que inicializa ShapeFactory con un tipo de forma específico.
   ShapeFactory(ShapeType shapeType) :
-  m_shape(nullptr), m_ShapeType(ShapeType::EMPTY), Component(ComponentType::SHAPE) {}
+  Component(ComponentType::SHAPE), m_ShapeType(ShapeType::EMPTY) {}
 
-  sf::Shape*
+  /**
+   * @brief Asigna a la forma el prototipo del tipo indicado.
+   * @return El prototipo compartido, o nullptr si el tipo no es válido.
+   */
+  const ShapePrototype*
   createShape(ShapeType shapeType);
 
  /**
@@ -48,6 +62,10 @@ public:
   void
   setFillColor(const sf::Color& color);
 
+  // Obtiene el color de relleno de la forma.
+  const sf::Color&
+  getFillColor() const { return m_fillColor; }
+
   // Establece la rotación de la forma.
   void
   setRotation(float angle);
@@ -56,13 +74,189 @@ public:
   void
   setScale(const Vector2& scl);
 
-  // Obtiene un puntero a la forma actual.
-  sf::Shape*
-  getShape() {
-    return m_shape;
-  }
+  /**
+   * @brief Reemplaza la transformación completa por una matriz ya compuesta.
+   * Solo marca cambios si la matriz es distinta. Los métodos setPosition, setRotation
+   * y setScale vuelven a componerla a partir de sus últimos valores.
+   */
+  void
+  setMatrix(const Matrix3x3& matrix);
+
+  // Establece el modo de mezcla con el que se dibuja la forma.
+  void
+  setBlendMode(const sf::BlendMode& blendMode);
+
+  // Obtiene el modo de mezcla con el que se dibuja la forma.
+  const sf::BlendMode&
+  getBlendMode() const { return m_blendMode; }
+
+  // Asigna una textura independiente a la forma (usa la textura completa).
+  void
+  setTexture(const sf::Texture* texture);
+
+  /**
+   * @brief Asigna a la forma una textura empaquetada en el atlas.
+   * Usa la página que contiene la textura y recorta su rectángulo. Guarda el nombre de
+   * la entrada para remapear el rectángulo si el atlas se desfragmenta.
+   * @return `false` si la textura no está dentro del atlas.
+   */
+  bool
+  setAtlasTexture(const TextureAtlas& atlas, const std::string& name);
+
+  /**
+   * @brief Vuelve a consultar la región del atlas si este cambió de versión.
+   * @return `true` si el rectángulo de textura cambió.
+   */
+  bool
+  refreshAtlasRegion();
+
+  /**
+   * @brief Agrega la geometría de la forma en espacio de mundo como triángulos.
+   * Los vértices incluyen color y coordenadas de textura, listos para dibujarse con
+   * sf::Triangles usando la textura de la forma.
+   * @param vertices Lista a la que se agregan los vértices.
+   */
+  void
+  appendVertices(std::vector<sf::Vertex>& vertices) const;
+
+  /**
+   * @brief Obtiene el AABB de la forma en coordenadas de mundo.
+   * Se guarda en caché y solo se recalcula cuando cambia la transformación o la forma.
+   */
+  const sf::FloatRect&
+  getGlobalBounds() const;
+
+  // Obtiene el AABB de la forma en coordenadas de mundo como primitiva de Geometry.h.
+  const AABB&
+  getBounds() const;
+
+  /**
+   * @brief Obtiene la caja orientada de la forma en coordenadas de mundo.
+   * Sigue la rotación de la forma, así que es más ajustada que el AABB.
+   */
+  OBB
+  getOrientedBounds() const;
+
+  /**
+   * @brief Obtiene un círculo que contiene la forma en coordenadas de mundo.
+   * Para círculos y triángulos es el círculo circunscrito del prototipo (escalado por el
+   * mayor factor de escala); para las demás formas rodea la caja orientada.
+   */
+  Circle
+  getBoundingCircle() const;
+
+  /**
+   * @brief Indica si el AABB cambió desde la última llamada y limpia el aviso.
+   * Lo usa el índice espacial para actualizar solo las formas que se movieron.
+   */
+  bool
+  consumeBoundsChange();
+
+  /**
+   * @brief Indica si algo visible de la forma cambió desde la última llamada y limpia el aviso.
+   * Incluye transformación, color, textura y modo de mezcla. Permite saber si la escena
+   * debe redibujarse.
+   */
+  bool
+  consumeVisualChange();
+
+  /**
+   * @brief Dibuja la forma en la ventana.
+   * Genera sus triángulos en espacio de mundo y los envía en una llamada.
+   */
+  void
+  draw(Window& window) const;
+
+  // Indica si la forma tiene geometría para dibujar.
+  bool
+  hasGeometry() const { return m_prototype != nullptr; }
+
+  /**
+   * @brief Ajusta los lados de un círculo a su tamaño en pantalla.
+   * Elige el nivel de detalle con histéresis a partir del radio proyectado; las demás
+   * formas conservan su geometría.
+   * @param pixelsPerUnit Píxeles del destino por unidad de mundo.
+   * @return `true` si la forma cambió de nivel.
+   */
+  bool
+  updateLevelOfDetail(float pixelsPerUnit);
+
+  // Nivel de detalle actual del círculo.
+  unsigned int
+  getLevelOfDetail() const { return m_lodLevel; }
+
+  // Vértices que genera la forma al dibujarse.
+  size_t
+  getVertexCount() const { return m_prototype ? m_prototype->triangles.size() : 0; }
+
+  // Obtiene el prototipo compartido de la forma.
+  const ShapePrototype*
+  getPrototype() const { return m_prototype; }
+
+  // Obtiene la textura de la forma (nullptr si no tiene).
+  const sf::Texture*
+  getTexture() const { return m_texture; }
+
+  // Obtiene el rectángulo de textura de la forma.
+  const sf::IntRect&
+  getTextureRect() const { return m_textureRect; }
+
+  // Obtiene la matriz de espacio local a espacio de mundo.
+  const Matrix3x3&
+  getMatrix() const { return m_matrix; }
 
 private:
-  sf::Shape* m_shape; // Puntero a la forma gráfica creada.
-  ShapeType m_ShapeType; // Tipo de forma que se está gestionando.
+  // Invalida el AABB en caché después de modificar la forma.
+  void
+  markTransformChanged();
+
+  // Compone la matriz con la posición, el seno y coseno en caché y la escala.
+  void
+  composeMatrix();
+
+  // Radio del círculo en espacio local.
+  static constexpr float kCircleRadius = 10.0f;
+
+  // Radio del círculo circunscrito del triángulo en espacio local.
+  static constexpr float kTriangleRadius = 50.0f;
+
+  // Límites locales del prototipo como AABB (vacío si no hay prototipo).
+  AABB
+  getLocalBounds() const;
+
+  // Asigna el prototipo de un círculo de radio 10.
+  const ShapePrototype*
+  createCircle();
+
+  // Asigna el prototipo de un rectángulo de 100x50.
+  const ShapePrototype*
+  createRectangle();
+
+  // Asigna el prototipo de un triángulo (círculo de 3 lados) de radio 50.
+  const ShapePrototype*
+  createTriangle();
+
+  const ShapePrototype* m_prototype = nullptr; // Geometría local compartida.
+  Matrix3x3 m_matrix; // Transformación de espacio local a espacio de mundo.
+  Vector2 m_position{ 0.0f, 0.0f }; // Posición de la instancia.
+  float m_rotation = 0.0f; // Rotación en grados, normalizada a [0, 360).
+  float m_sine = 0.0f; // Seno de la rotación en caché.
+  float m_cosine = 1.0f; // Coseno de la rotación en caché.
+  Vector2 m_scale{ 1.0f, 1.0f }; // Escala de la instancia.
+  sf::Color m_fillColor = sf::Color::White; // Color de relleno.
+  const sf::Texture* m_texture = nullptr; // Textura de la forma (puede ser una página del atlas).
+  sf::IntRect m_textureRect; // Región de la textura que cubre la forma.
+  ShapeType m_ShapeType = ShapeType::EMPTY; // Tipo de forma que se está gestionando.
+  unsigned int m_lodLevel = ShapePrototypeCache::kDefaultCircleLevel; // Nivel de detalle del círculo.
+  sf::BlendMode m_blendMode = sf::BlendAlpha; // Modo de mezcla de la forma.
+
+  const TextureAtlas* m_atlas = nullptr; // Atlas del que proviene la textura (si aplica).
+  std::string m_atlasKey; // Nombre de la textura dentro del atlas.
+  unsigned int m_atlasVersion = 0; // Versión del atlas con la que se calculó el rectángulo.
+
+  mutable sf::FloatRect m_globalBounds; // AABB en caché en coordenadas de mundo.
+  mutable AABB m_bounds; // El mismo AABB como primitiva de Geometry.h.
+  mutable bool m_boundsDirty = true; // El AABB en caché debe recalcularse.
+  bool m_boundsChanged = true; // El AABB cambió desde la última consulta del índice espacial.
+  bool m_visualChanged = true; // La apariencia cambió desde el último frame dibujado.
 };
\ No newline at end of file
@@ -0,0 +1,77 @@
+#pragma once
+#include "Prerequisites.h"
+#include <atomic>
+#include <chrono>
+#include <functional>
+
+/**
+ * @brief Métricas de la simulación desacoplada, vistas desde el hilo principal.
+ */
+struct
+SimulationStats {
+  bool threaded = true;          // La simulación corre en su propio hilo.
+  float rateHz = 0.0f;           // Pasos de simulación por segundo.
+  float stepMs = 0.0f;           // Duración de un paso (sin contar la espera).
+  float simulationWaitMs = 0.0f; // Espera de la simulación por el mundo.
+  float renderWaitMs = 0.0f;     // Espera del hilo principal por el mundo en el frame.
+  float snapshotAgeMs = 0.0f;    // Antigüedad de la instantánea dibujada.
+  uint64_t stepsPerFrame = 0;    // Pasos publicados desde el frame anterior.
+};
+
+/**
+ * @brief Hilo dedicado que ejecuta la simulación a una frecuencia fija.
+ * Llama a la función de paso con el tiempo real transcurrido (limitado para que una
+ * pausa larga no produzca un salto enorme) y duerme hasta el siguiente tick. Si un
+ * paso tarda más que el periodo, el siguiente empieza de inmediato sin intentar
+ * recuperar los ticks perdidos.
+ */
+class
+SimulationThread {
+public:
+  using StepFunction = std::function<void(float)>;
+
+  SimulationThread() = default;
+
+  ~SimulationThread() { stop(); }
+
+  // Deshabilitar copia y asignación
+  SimulationThread(const SimulationThread&) = delete;
+  SimulationThread& operator=(const SimulationThread&) = delete;
+
+  /**
+   * @brief Inicia el hilo.
+   * @param step Función que avanza la simulación; recibe el paso en segundos.
+   * @param rateHz Pasos por segundo objetivo.
+   */
+  void
+  start(StepFunction step, float rateHz);
+
+  // Detiene el hilo y espera a que termine el paso en curso.
+  void
+  stop();
+
+  bool
+  isRunning() const { return m_thread.joinable(); }
+
+  // Promedio móvil de la duración de cada paso.
+  float
+  getStepMs() const { return m_stepMs.load(std::memory_order_relaxed); }
+
+  // Promedio móvil de los pasos por segundo.
+  float
+  getRateHz() const { return m_rateHz.load(std::memory_order_relaxed); }
+
+  // Paso máximo en segundos que recibe la función de paso.
+  static constexpr float kMaxStepSeconds = 0.1f;
+
+private:
+  void
+  loop();
+
+  std::thread m_thread;
+  std::atomic<bool> m_running{ false };
+  StepFunction m_step;
+  std::chrono::steady_clock::duration m_period{};
+  std::atomic<float> m_stepMs{ 0.0f };
+  std::atomic<float> m_rateHz{ 0.0f };
+};
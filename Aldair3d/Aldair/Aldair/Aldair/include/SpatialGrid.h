@@ -0,0 +1,128 @@
+#pragma once
+#include "Prerequisites.h"
+
+/**
+ * @brief Índice espacial de rejilla uniforme (spatial hash).
+ * Guarda el AABB de cada elemento en las celdas que toca. Las consultas por
+ * rectángulo solo recorren las celdas que se intersectan, por lo que su costo es
+ * proporcional a los elementos cercanos y no al total de la escena.
+ *
+ * Los elementos se identifican con un id entero (por ejemplo, el índice del actor).
+ * Las coordenadas de celda se limitan a ±kMaxCell, así que valores enormes no
+ * desbordan la conversión a int. Los elementos que tocan más de kMaxEntryCells celdas
+ * se guardan en una lista aparte que revisa cada consulta, y una consulta que cubre más
+ * celdas que las ocupadas recorre las ocupadas: alejar la cámara no recorre celdas vacías.
+ */
+class
+SpatialGrid {
+public:
+  /**
+   * @brief Constructor de la rejilla.
+   * @param cellSize Tamaño en unidades de mundo de cada celda.
+   */
+  SpatialGrid(float cellSize = 256.0f) : m_cellSize(cellSize) {}
+
+  ~SpatialGrid() = default;
+
+  /**
+   * @brief Inserta o actualiza un elemento.
+   * Si el elemento ya existe y sigue tocando las mismas celdas, solo se actualiza su AABB.
+   * Un AABB con NaN o infinitos no se puede ubicar, así que el elemento se elimina.
+   * @param id Identificador del elemento.
+   * @param bounds AABB en coordenadas de mundo.
+   */
+  void
+  update(uint32_t id, const sf::FloatRect& bounds);
+
+  // Elimina un elemento del índice.
+  void
+  remove(uint32_t id);
+
+  // Elimina todos los elementos.
+  void
+  clear();
+
+  /**
+   * @brief Obtiene los elementos cuyo AABB intersecta el rectángulo.
+   * El resultado no tiene duplicados y está ordenado por id; queda vacío si el área
+   * tiene NaN o infinitos.
+   * @param area Rectángulo de consulta en coordenadas de mundo.
+   * @param result Lista donde se escriben los ids (se limpia antes).
+   */
+  void
+  query(const sf::FloatRect& area, std::vector<uint32_t>& result) const;
+
+  // Verifica si el elemento está dentro del índice.
+  bool
+  contains(uint32_t id) const;
+
+  // Número de elementos en el índice.
+  size_t
+  size() const { return m_count; }
+
+private:
+  // Coordenada de celda máxima en valor absoluto.
+  static constexpr int kMaxCell = 1 << 24;
+
+  // Celdas a partir de las cuales un elemento va a la lista de elementos grandes.
+  static constexpr int64_t kMaxEntryCells = 1024;
+
+  // Rango de celdas (inclusivo) que toca un AABB.
+  struct
+  CellRange {
+    int minX = 0, minY = 0, maxX = -1, maxY = -1;
+
+    bool
+    operator==(const CellRange& other) const {
+      return minX == other.minX && minY == other.minY &&
+             maxX == other.maxX && maxY == other.maxY;
+    }
+
+    // Número de celdas del rango, sin desbordar.
+    int64_t
+    getCellCount() const {
+      return static_cast<int64_t>(maxX - minX + 1) * static_cast<int64_t>(maxY - minY + 1);
+    }
+  };
+
+  // Datos guardados por elemento.
+  struct
+  Entry {
+    sf::FloatRect bounds;
+    CellRange cells;
+    bool active = false;
+  };
+
+  CellRange
+  computeRange(const sf::FloatRect& bounds) const;
+
+  // Celda que contiene la coordenada, limitada a [-kMaxCell, kMaxCell].
+  int
+  toCell(float coordinate) const;
+
+  // Combina las coordenadas de una celda en una llave de 64 bits. Se arma sin signo
+  // porque desplazar a la izquierda una coordenada negativa no está definido.
+  static uint64_t
+  cellKey(int x, int y) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+  }
+
+  // Agrega el id a las celdas del rango, o a la lista de elementos grandes.
+  void
+  insertCells(uint32_t id, const CellRange& range);
+
+  void
+  removeCells(uint32_t id, const CellRange& range);
+
+  // Agrega id al resultado una sola vez si su AABB intersecta el área.
+  void
+  testCandidate(uint32_t id, const sf::FloatRect& area, std::vector<uint32_t>& result) const;
+
+  float m_cellSize;
+  size_t m_count = 0;
+  std::vector<Entry> m_entries; // Indexado por id.
+  std::unordered_map<uint64_t, std::vector<uint32_t>> m_cells;
+  std::vector<uint32_t> m_oversized; // Elementos con más de kMaxEntryCells celdas.
+  mutable std::vector<uint32_t> m_queryMarks; // Marca por id para eliminar duplicados.
+  mutable uint32_t m_queryStamp = 0;
+};
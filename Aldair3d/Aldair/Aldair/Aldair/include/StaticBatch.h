@@ -0,0 +1,67 @@
+#pragma once
+#include "Prerequisites.h"
+#include "Actor.h"
+
+class Window;
+
+/**
+ * @brief Geometría horneada de los actores estáticos.
+ * Los actores marcados como estáticos no se mueven, así que su geometría se
+ * transforma una sola vez a espacio de mundo y se sube a sf::VertexBuffer con uso
+ * sf::VertexBuffer::Static, un buffer por textura. Cada frame se dibujan con una
+ * llamada por textura en lugar de sincronizar y dibujar cada sf::Shape.
+ *
+ * El horneado solo se reconstruye cuando se marca como sucio (un actor estático
+ * cambió en el inspector, se agregó o dejó de ser estático).
+ */
+class
+StaticBatch {
+public:
+  StaticBatch() = default;
+  ~StaticBatch() = default;
+
+  // Indica que la geometría horneada debe reconstruirse.
+  void
+  markDirty() { m_dirty = true; }
+
+  // Indica si el horneado está desactualizado.
+  bool
+  isDirty() const { return m_dirty; }
+
+ /**
+  * @brief Hornea la geometría de todos los actores estáticos.
+  * Agrupa los triángulos por textura y los sube a un buffer estático por grupo.
+  * @param actors Lista de actores de la escena.
+  */
+  void
+  build(std::vector<EngineUtilities::TSharedPointer<Actor>>& actors);
+
+ /**
+  * @brief Dibuja la geometría horneada.
+  * Los grupos cuyo AABB queda fuera de la vista se omiten.
+  * @param window Ventana donde se dibujan los buffers.
+  */
+  void
+  render(Window& window) const;
+
+  // Número de buffers (uno por textura).
+  size_t
+  getBatchCount() const { return m_batches.size(); }
+
+  // Número total de vértices horneados.
+  size_t
+  getVertexCount() const;
+
+private:
+  // Geometría de todos los actores estáticos que comparten textura.
+  struct
+  Batch {
+    const sf::Texture* texture = nullptr;
+    sf::FloatRect bounds; // AABB de toda la geometría del grupo.
+    sf::VertexBuffer buffer{ sf::Triangles, sf::VertexBuffer::Static };
+    std::vector<sf::Vertex> vertices; // Solo se usa si no hay soporte para VertexBuffer.
+  };
+
+  std::vector<Batch> m_batches;
+  bool m_dirty = true;
+};
@@ -0,0 +1,137 @@
+#pragma once
+#include "Prerequisites.h"
+#include "imstb_rectpack.h"
+
+/**
+ * @brief Región de una textura dentro del atlas.
+ * Indica la página que la contiene y el rectángulo (en píxeles) que ocupa.
+ */
+struct
+AtlasRegion {
+  int page = -1;      // Índice de la página dentro del atlas (-1 si no es válida).
+  sf::IntRect rect;   // Rectángulo de la textura dentro de la página.
+
+  // Indica si la región apunta a una página existente.
+  bool
+  isValid() const { return page >= 0; }
+};
+
+/**
+ * @brief Empaquetador de texturas en tiempo de ejecución.
+ * Agrupa muchas texturas pequeñas en pocas páginas grandes usando stb_rect_pack
+ * (imstb_rectpack.h, incluido con ImGui). Las formas que comparten página usan el
+ * mismo sf::Texture, por lo que pueden dibujarse en un solo lote.
+ *
+ * Las inserciones son incrementales: cada página conserva su contexto de empaquetado
+ * y las nuevas texturas se colocan en el primer hueco disponible. Al eliminar texturas
+ * el espacio no se recupera hasta llamar a defragment(), que reempaqueta todas las
+ * entradas vivas e incrementa la versión del atlas para que las formas y los mapas de
+ * tiles remapeen sus rectángulos de textura. ResourceManager lo hace al cargar y al
+ * descargar texturas con defragmentIfNeeded().
+ */
+class
+TextureAtlas {
+public:
+  /**
+   * @brief Constructor del atlas.
+   * @param pageSize Tamaño (ancho y alto) en píxeles de cada página.
+   * @param padding Separación en píxeles entre texturas para evitar sangrado al filtrar.
+   */
+  TextureAtlas(unsigned int pageSize = 2048, unsigned int padding = 1);
+
+  ~TextureAtlas() = default;
+
+  TextureAtlas(const TextureAtlas&) = delete;
+  TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+  /**
+   * @brief Inserta una imagen en el atlas.
+   * Si el nombre ya existe se devuelve true sin modificar el atlas.
+   * @param name Nombre con el que se identificará la textura.
+   * @param image Imagen a copiar dentro de la página.
+   * @return `false` si la imagen no cabe en una página del atlas.
+   */
+  bool
+  insert(const std::string& name, const sf::Image& image);
+
+  // Elimina una textura del atlas. Su espacio se recupera al desfragmentar.
+  void
+  remove(const std::string& name);
+
+  // Verifica si una textura ya está dentro del atlas.
+  bool
+  contains(const std::string& name) const;
+
+  // Obtiene la región de una textura, o una región inválida si no existe.
+  AtlasRegion
+  getRegion(const std::string& name) const;
+
+  // Obtiene la textura de la página indicada, o nullptr si no existe.
+  const sf::Texture*
+  getPageTexture(int page) const;
+
+  /**
+   * @brief Reempaqueta todas las texturas vivas en el menor número de páginas.
+   * Las regiones cambian de lugar, por lo que incrementa la versión del atlas.
+   * @return `false` si alguna entrada no cupo en una página vacía; en ese caso el atlas
+   * conserva sus páginas y regiones anteriores.
+   */
+  bool
+  defragment();
+
+  /**
+   * @brief Desfragmenta solo si el espacio desperdiciado supera el umbral.
+   * @param threshold Fracción (0-1) de área asignada que ya no está en uso.
+   * @return `true` si se desfragmentó el atlas.
+   */
+  bool
+  defragmentIfNeeded(float threshold = 0.35f);
+
+  // Fracción del área empaquetada que pertenece a texturas eliminadas.
+  float
+  getFragmentation() const;
+
+  // Número de páginas creadas.
+  size_t
+  getPageCount() const { return m_pages.size(); }
+
+  // Número de texturas dentro del atlas.
+  size_t
+  getEntryCount() const { return m_entries.size(); }
+
+  // Versión del atlas. Cambia cada vez que las regiones se mueven.
+  unsigned int
+  getVersion() const { return m_version; }
+
+private:
+  // Página del atlas con su contexto de empaquetado incremental.
+  struct
+  Page {
+    sf::Texture texture;              // Textura en GPU de la página.
+    stbrp_context context;            // Estado del empaquetador (skyline).
+    std::vector<stbrp_node> nodes;    // Memoria temporal requerida por stb_rect_pack.
+    unsigned int packedArea = 0;      // Área total empaquetada (incluye eliminadas).
+  };
+
+  /**
+   * @brief Crea una página sin agregarla al atlas.
+   * @param clear Sube píxeles transparentes a la textura; sf::Texture::create deja la
+   * memoria sin inicializar y el filtrado muestrea el padding entre regiones.
+   */
+  std::unique_ptr<Page>
+  makePage(bool clear);
+
+  // Crea una página vacía y transparente y la agrega al atlas.
+  Page&
+  createPage();
+
+  // Intenta empaquetar un rectángulo en la página dada.
+  bool
+  packInto(Page& page, int width, int height, sf::IntRect& outRect);
+
+  unsigned int m_pageSize;
+  unsigned int m_padding;
+  unsigned int m_version = 0;
+  std::vector<std::unique_ptr<Page>> m_pages;
+  std::unordered_map<std::string, AtlasRegion> m_entries;
+};
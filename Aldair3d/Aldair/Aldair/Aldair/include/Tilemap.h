@@ -0,0 +1,175 @@
+#pragma once
+#include "Prerequisites.h"
+#include "Component.h"
+#include "Window.h"
+#include "TextureAtlas.h"
+
+/**
+ * @brief Componente de mapa de tiles dividido en chunks.
+ * Los IDs de tile se guardan por chunks de chunkSize x chunkSize. Cada chunk tiene su
+ * propio sf::VertexBuffer estático con dos triángulos por tile no vacío, generado
+ * contra un tileset (una región de una textura, normalmente del atlas).
+ *
+ * Los buffers se construyen de forma perezosa: solo se reconstruyen los chunks
+ * visibles cuyos tiles cambiaron, y solo se dibujan los chunks que intersectan la
+ * vista. El ID 0 es un tile vacío; el ID n usa la celda n - 1 del tileset, contando
+ * de izquierda a derecha y de arriba a abajo.
+ */
+class
+Tilemap : public Component {
+public:
+  /**
+   * @brief Constructor del mapa.
+   * @param chunkSize Tiles por lado de cada chunk.
+   */
+  Tilemap(unsigned int chunkSize = 32);
+
+  virtual
+  ~Tilemap() = default;
+
+  void
+  update(float deltaTime) override {};
+
+  void
+  render(Window window) override {};
+
+  /**
+   * @brief Crea un mapa vacío.
+   * @param width Ancho en tiles.
+   * @param height Alto en tiles.
+   * @param tileSize Tamaño en unidades de mundo del lado de cada tile.
+   */
+  void
+  create(unsigned int width, unsigned int height, float tileSize);
+
+  /**
+   * @brief Carga una capa de tiles desde un archivo de texto.
+   * El formato es una cabecera "ancho alto tamañoTile" seguida de ancho x alto IDs
+   * separados por espacios, comas o saltos de línea. Las líneas que empiezan con '#'
+   * son comentarios.
+   * @return `false` si el archivo no existe o está incompleto.
+   */
+  bool
+  loadFromFile(const std::string& fileName);
+
+  /**
+   * @brief Asigna el tileset.
+   * @param texture Textura que contiene el tileset.
+   * @param region Rectángulo del tileset dentro de la textura.
+   * @param tilePixels Tamaño en píxeles de cada celda del tileset.
+   */
+  void
+  setTileset(const sf::Texture* texture, const sf::IntRect& region, unsigned int tilePixels);
+
+  /**
+   * @brief Asigna como tileset una textura empaquetada en el atlas.
+   * Si el atlas se desfragmenta, prepare() vuelve a leer la región.
+   * @return `false` si la textura no está en el atlas.
+   */
+  bool
+  setTileset(const TextureAtlas& atlas, const std::string& name, unsigned int tilePixels);
+
+  // Cambia un tile y marca su chunk para reconstruirse.
+  void
+  setTile(unsigned int x, unsigned int y, uint16_t id);
+
+  // Obtiene el ID de un tile (0 fuera del mapa).
+  uint16_t
+  getTile(unsigned int x, unsigned int y) const;
+
+  // Establece la posición en el mundo de la esquina superior izquierda del mapa.
+  void
+  setPosition(const sf::Vector2f& position);
+
+  const sf::Vector2f&
+  getPosition() const { return m_position; }
+
+  /**
+   * @brief Prepara los chunks visibles en el área indicada.
+   * Reconstruye los buffers de los chunks visibles que cambiaron y guarda la lista de
+   * chunks a dibujar. No necesita una ventana, así que se usa también en las pruebas.
+   */
+  void
+  prepare(const sf::FloatRect& view);
+
+  // Prepara los chunks visibles según la vista de la ventana y los dibuja.
+  void
+  draw(Window& window);
+
+  /**
+   * @brief Indica si el mapa cambió desde la última llamada y limpia el aviso.
+   * Incluye ediciones de tiles, cambios de tileset y de posición.
+   */
+  bool
+  consumeChange();
+
+  unsigned int
+  getWidth() const { return m_width; }
+
+  unsigned int
+  getHeight() const { return m_height; }
+
+  float
+  getTileSize() const { return m_tileSize; }
+
+  // Número total de chunks.
+  size_t
+  getChunkCount() const { return m_chunks.size(); }
+
+  // Chunks que pasaron el culling en la última preparación.
+  size_t
+  getVisibleChunkCount() const { return m_visibleChunks.size(); }
+
+  // Chunks reconstruidos en la última preparación.
+  size_t
+  getRebuiltChunkCount() const { return m_rebuiltChunks; }
+
+  // Vértices de los chunks visibles.
+  size_t
+  getVisibleVertexCount() const;
+
+private:
+  struct
+  Chunk {
+    std::vector<uint16_t> tiles;      // chunkSize x chunkSize IDs.
+    sf::VertexBuffer buffer{ sf::Triangles, sf::VertexBuffer::Static };
+    std::vector<sf::Vertex> vertices; // Copia en memoria si no hay buffers de vértices.
+    size_t vertexCount = 0;
+    bool dirty = true;
+  };
+
+  // Genera los triángulos de un chunk y los sube a su buffer.
+  void
+  buildChunk(unsigned int chunkX, unsigned int chunkY, Chunk& chunk);
+
+  // Marca todos los chunks para reconstruirse.
+  void
+  markAllDirty();
+
+  // Vuelve a leer la región del tileset si el atlas movió sus regiones.
+  void
+  refreshAtlasRegion();
+
+  unsigned int m_chunkSize;
+  unsigned int m_width = 0;
+  unsigned int m_height = 0;
+  unsigned int m_chunksX = 0;
+  unsigned int m_chunksY = 0;
+  float m_tileSize = 16.0f;
+  sf::Vector2f m_position;
+
+  const sf::Texture* m_tileset = nullptr;
+  sf::IntRect m_tilesetRegion;
+  unsigned int m_tilePixels = 16;
+
+  // Atlas del tileset, si vino de uno, y la versión con la que se leyó su región.
+  const TextureAtlas* m_atlas = nullptr;
+  std::string m_atlasKey;
+  unsigned int m_atlasVersion = 0;
+
+  std::vector<Chunk> m_chunks;
+  std::vector<size_t> m_visibleChunks;
+  std::vector<sf::Vertex> m_scratch; // Memoria reutilizada al construir chunks.
+  size_t m_rebuiltChunks = 0;
+  bool m_changed = true;
+};
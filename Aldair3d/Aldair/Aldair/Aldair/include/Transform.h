@@ -2,6 +2,8 @@
 #include "Prerequisites.h"
 #include "Component.h"
 #include "Window.h"
+#include "Matrix3x3.h"
+#include "ScalarTraits.h"
 
 class
 Transform : public Component {
@@ -106,13 +108,30 @@ public:
       float speed,
       float deltaTime,
       float range) {
-    Vector2 direction = (targetPosition) - position;
-    float length = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+    Steering::seek(position, targetPosition, speed, deltaTime, range);
+  }
 
-    if (length > range) {
-      direction /= length;  // Normaliza el vector
-      position += direction * speed * deltaTime;
+  /**
+   * @brief Obtiene la matriz de espacio local a espacio de mundo (T * R * S).
+   * La GUI modifica posición, rotación y escala por puntero, así que la caché se
+   * valida comparando los valores con los usados en la última composición; el seno y
+   * el coseno solo se recalculan cuando cambia el ángulo. rotation.x está en grados.
+   */
+  const Matrix3x3&
+  getMatrix() const {
+    if (m_matrixDirty || rotation.x != m_cachedAngle ||
+        position.x != m_cachedPosition.x || position.y != m_cachedPosition.y ||
+        scale.x != m_cachedScale.x || scale.y != m_cachedScale.y) {
+      if (m_matrixDirty || rotation.x != m_cachedAngle) {
+        MathEngine::sincos(rotation.x * (MathEngine::PI / 180.0f), m_sine, m_cosine);
+        m_cachedAngle = rotation.x;
+      }
+      m_cachedPosition = position;
+      m_cachedScale = scale;
+      m_matrix = Matrix3x3::fromTRS(position, m_sine, m_cosine, scale);
+      m_matrixDirty = false;
     }
+    return m_matrix;
   }
 
   // Libera los recursos asociados al componente.
@@ -123,4 +142,12 @@ private:
   Vector2 position; // Posici�n del objeto
   Vector2 rotation; // Rotaci�n del objeto
   Vector2 scale;	// Escala del objeto
+
+  mutable Matrix3x3 m_matrix; // Matriz compuesta en caché.
+  mutable Vector2 m_cachedPosition; // Posición usada en la última composición.
+  mutable Vector2 m_cachedScale; // Escala usada en la última composición.
+  mutable float m_cachedAngle = 0.0f; // Ángulo (grados) del seno y coseno en caché.
+  mutable float m_sine = 0.0f; // Seno del ángulo en caché.
+  mutable float m_cosine = 1.0f; // Coseno del ángulo en caché.
+  mutable bool m_matrixDirty = true; // La caché aún no se ha calculado.
 };
\ No newline at end of file
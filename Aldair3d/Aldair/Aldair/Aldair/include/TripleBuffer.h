@@ -0,0 +1,61 @@
+#pragma once
+#include "Prerequisites.h"
+#include <atomic>
+
+/**
+ * @brief Triple buffer sin bloqueos entre un productor y un consumidor.
+ * El productor escribe siempre en su propio búfer y al publicarlo lo intercambia con
+ * el búfer intermedio; el consumidor toma el intermedio solo si hay uno nuevo. Ninguno
+ * de los dos espera al otro: el productor puede publicar varias veces sin que el
+ * consumidor lea (se conserva solo la última) y el consumidor puede releer la última
+ * que tomó tantas veces como quiera.
+ *
+ * Solo un hilo debe llamar a beginWrite/publish y solo un hilo a acquire/read.
+ */
+template<typename T>
+class
+TripleBuffer {
+public:
+  TripleBuffer() = default;
+  ~TripleBuffer() = default;
+
+  // Deshabilitar copia y asignación
+  TripleBuffer(const TripleBuffer&) = delete;
+  TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+  // Búfer del productor; su contenido es el de una publicación anterior.
+  T&
+  beginWrite() { return m_buffers[m_back]; }
+
+  // Publica el búfer del productor como el más reciente.
+  void
+  publish() {
+    m_back = m_middle.exchange(static_cast<uint8_t>(m_back | kFresh), std::memory_order_acq_rel) & kIndexMask;
+  }
+
+  /**
+   * @brief Toma el búfer publicado más reciente, si hay uno nuevo.
+   * @return `true` si read() cambió de búfer.
+   */
+  bool
+  acquire() {
+    if ((m_middle.load(std::memory_order_acquire) & kFresh) == 0) {
+      return false;
+    }
+    m_front = m_middle.exchange(m_front, std::memory_order_acq_rel) & kIndexMask;
+    return true;
+  }
+
+  // Último búfer tomado por el consumidor.
+  const T&
+  read() const { return m_buffers[m_front]; }
+
+private:
+  static constexpr uint8_t kIndexMask = 0x3;
+  static constexpr uint8_t kFresh = 0x4; // El búfer intermedio no ha sido tomado.
+
+  std::array<T, 3> m_buffers;
+  uint8_t m_back = 0;                 // Solo lo usa el productor.
+  std::atomic<uint8_t> m_middle{ 1 }; // Índice intermedio y bit de nuevo.
+  uint8_t m_front = 2;                // Solo lo usa el consumidor.
+};
@@ -12,38 +12,38 @@ public:
      * @brief Constructor por defecto
      * Inicializa las coordenadas del los vectores desde 0
     */
-    Vector2() : x(0), y(0) {}
+    constexpr Vector2() : x(0), y(0) {}
 
     /**
      * @brief Constructor parametrizado.
      * Inicializa las coordenadas de los vectores de los valores dados.
     */
-    Vector2(float xVal, float yVal) : x(xVal), y(yVal) {}
+    constexpr Vector2(float xVal, float yVal) : x(xVal), y(yVal) {}
 
     // Sobrecarga del operador para la suma de 2 vectores.
-    Vector2 operator+(const Vector2& other) const {
+    constexpr Vector2 operator+(const Vector2& other) const {
         return Vector2(x + other.x, y + other.y);
     }
 
     // Sobrecarga del operador +=
-    Vector2& operator+=(const Vector2& other) {
+    constexpr Vector2& operator+=(const Vector2& other) {
         x += other.x;
         y += other.y;
         return *this;
     }
 
     // Sobrecarga del operador para la resta de 2 vectores.
-    Vector2 operator-(const Vector2& other) const {
+    constexpr Vector2 operator-(const Vector2& other) const {
         return Vector2(x - other.x, y - other.y);
     }
 
     // Sobrecarga del operador para la multiplicaci�n de 2 vectores.
-    Vector2 operator*(float scalar) const {
+    constexpr Vector2 operator*(float scalar) const {
         return Vector2(x * scalar, y * scalar);
     }
 
     // Sobrecarga del operador /
-    Vector2 operator/(float scalar) const {
+    constexpr Vector2 operator/(float scalar) const {
         if (scalar != 0) {
             return Vector2(x / scalar, y / scalar);
         }
@@ -51,7 +51,7 @@ public:
     }
 
     // Sobrecarga del operador /=
-    Vector2& operator/=(float scalar) {
+    constexpr Vector2& operator/=(float scalar) {
         if (scalar != 0) {
             x /= scalar;
             y /= scalar;
@@ -69,7 +69,7 @@ public:
      * La magnitud se calcula como la ra�z cuadrada de la suma de los cuadrados de sus componentes.
      * Se calcular la ra�z cuadrada a trav�s de MathEngine.h.
     */
-    float magnitude() const {
+    constexpr float magnitude() const {
         return MathEngine::sqrt(x * x + y * y);
     }
 
@@ -78,7 +78,7 @@ public:
      * Devuelve un vector en la misma direcci�n pero con magnitud 1.
      * Si el vector tiene magnitud 0, devuelve un vector con componentes (0, 0).
     */
-    Vector2 normalize() const {
+    constexpr Vector2 normalize() const {
         float mag = magnitude();
         if (mag == 0) {
             return Vector2(0, 0);
@@ -87,12 +87,12 @@ public:
     }
 
     // M�todo para devolver un puntero a los datos no constantes.
-    float* data() {
+    constexpr float* data() {
         return &x;
     }
 
     // M�todo para devolver un puntero a los datos constantes.
-    const float*
+    constexpr const float*
         data() const {
         return &x;
     }
@@ -1,7 +1,14 @@
 #pragma once
 #include "MathEngine.h"
+#include "SIMD.h"
 
-class Vector4 {
+/**
+ * @brief Vector de cuatro componentes alineado a 16 bytes.
+ * Con SSE las operaciones cargan las cuatro componentes en un registro; sin SSE se
+ * calculan componente por componente. Las operaciones son constexpr: en expresiones
+ * constantes toman la ruta escalar.
+ */
+class alignas(16) Vector4 {
 public:
 
     // Valores de las coordenadas x, y, z y w.
@@ -11,36 +18,61 @@ public:
      * @brief Constructor por defecto
      * Inicializa las coordenadas del los vectores desde 0
     */
-    Vector4() : x(0), y(0), z(0), w(0) {}
+    constexpr Vector4() : x(0), y(0), z(0), w(0) {}
 
     /**
      * @brief Constructor parametrizado.
      * Inicializa las coordenadas de los vectores de los valores dados.
     */
-    Vector4(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+    constexpr Vector4(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
 
     // Sobrecarga del operador para la suma de 2 vectores.
-    Vector4 operator+(const Vector4& other) const {
+    constexpr Vector4 operator+(const Vector4& other) const {
+#if defined(ALDAIR_SIMD_SSE)
+        if (!MATHENGINE_IS_CONSTANT_EVALUATED()) {
+            return Vector4(_mm_add_ps(load(), other.load()));
+        }
+#endif
         return Vector4(x + other.x, y + other.y, z + other.z, w + other.w);
     }
 
     // Sobrecarga del operador para la resta de 2 vectores.
-    Vector4 operator-(const Vector4& other) const {
+    constexpr Vector4 operator-(const Vector4& other) const {
+#if defined(ALDAIR_SIMD_SSE)
+        if (!MATHENGINE_IS_CONSTANT_EVALUATED()) {
+            return Vector4(_mm_sub_ps(load(), other.load()));
+        }
+#endif
         return Vector4(x - other.x, y - other.y, z - other.z, w - other.w);
     }
 
     // Sobrecarga del operador para la multiplicaci?n de un vector por un escalar
-    Vector4 operator*(float scalar) const {
+    constexpr Vector4 operator*(float scalar) const {
+#if defined(ALDAIR_SIMD_SSE)
+        if (!MATHENGINE_IS_CONSTANT_EVALUATED()) {
+            return Vector4(_mm_mul_ps(load(), _mm_set1_ps(scalar)));
+        }
+#endif
         return Vector4(x * scalar, y * scalar, z * scalar, w * scalar);
     }
 
+    // Producto punto de 2 vectores.
+    constexpr float dot(const Vector4& other) const {
+#if defined(ALDAIR_SIMD_SSE)
+        if (!MATHENGINE_IS_CONSTANT_EVALUATED()) {
+            return _mm_cvtss_f32(SIMD::dot4(load(), other.load()));
+        }
+#endif
+        return x * other.x + y * other.y + z * other.z + w * other.w;
+    }
+
     /**
      * @brief Calcula la magnitud del vector.
      * La magnitud se calcula como la ra?z cuadrada de la suma de los cuadrados de sus componentes.
      * Se calcular la ra?z cuadrada a trav?s de MathEngine.h.
     */
-    float magnitude() const {
-        return MathEngine::sqrt(x * x + y * y + z * z + w * w);
+    constexpr float magnitude() const {
+        return MathEngine::sqrt(dot(*this));
     }
 
     /**
@@ -48,21 +80,39 @@ public:
      * Devuelve un vector en la misma direcci?n pero con magnitud 1.
      * Si el vector tiene magnitud 0, devuelve un vector con componentes (0, 0).
     */
-    Vector4 normalize() const {
-        float mag = magnitude();
-        if (mag == 0) {
+    constexpr Vector4 normalize() const {
+#if defined(ALDAIR_SIMD_SSE)
+        if (!MATHENGINE_IS_CONSTANT_EVALUATED()) {
+            // rsqrt con un paso de Newton-Raphson: sin raiz ni divisiones.
+            return Vector4(SIMD::normalize4(load()));
+        }
+#endif
+        float magSquared = dot(*this);
+        if (magSquared == 0) {
             return Vector4(0, 0, 0, 0);
         }
-        return Vector4(x / mag, y / mag, z / mag, w / mag);
+        return *this * MathEngine::rsqrt(magSquared);
     }
 
     // M?todo para devolver un puntero a los datos no constantes.
-    float* data() {
+    constexpr float* data() {
         return &x;
     }
 
     // M?todo para devolver un puntero a los datos constantes.
-    const float* data() const {
+    constexpr const float* data() const {
         return &x;
     }
+
+#if defined(ALDAIR_SIMD_SSE)
+    // Construye el vector desde un registro con los carriles (x, y, z, w).
+    explicit Vector4(__m128 value) {
+        _mm_store_ps(&x, value);
+    }
+
+    // Carga las cuatro componentes en un registro.
+    __m128 load() const {
+        return _mm_load_ps(&x);
+    }
+#endif
 };
\ No newline at end of file
@@ -1,5 +1,8 @@
 ﻿#pragma once
 #include "Prerequisites.h"
+#include "RenderTargetPool.h"
+
+class FrameCapture;
 
 class
 Window {
@@ -12,9 +15,12 @@ public:
   void
   handleEvents();
 
-  // Limpia el contenido de la ventana con el color predeterminado.
+  /**
+   * @brief Limpia el contenido de la ventana con el color predeterminado.
+   * @param clearScene `false` conserva el contenido de la RenderTexture del frame anterior.
+   */
   void
-  clear();
+  clear(bool clearScene = true);
 
   // Muestra el contenido de la ventana en la pantalla.
   void
@@ -31,6 +37,25 @@ public:
   void
   draw(const sf::Drawable& drawable);
 
+ /**
+  * @brief Dibuja un objeto con estados de render (textura, transformación, mezcla).
+  * drawable Objeto SFML que puede ser dibujado.
+  * states Estados de render a utilizar.
+  */
+  void
+  draw(const sf::Drawable& drawable, const sf::RenderStates& states);
+
+ /**
+  * @brief Dibuja una lista de vértices sin crear un objeto intermedio.
+  * vertices Puntero al primer vértice.
+  * vertexCount Número de vértices a dibujar.
+  * type Tipo de primitiva que forman los vértices.
+  * states Estados de render a utilizar.
+  */
+  void
+  draw(const sf::Vertex* vertices, size_t vertexCount,
+       sf::PrimitiveType type, const sf::RenderStates& states = sf::RenderStates::Default);
+
  /**
   * @brief Obtiene el objeto interno SFML RenderWindow.
   * Un puntero al objeto interno SFML RenderWindow.
@@ -62,12 +87,118 @@ public:
   void
   showInImGui();
 
+ /**
+  * @brief Obtiene el rectángulo visible de la escena en coordenadas de mundo.
+  * Corresponde a la vista con la que se dibujan los actores en el destino activo.
+  */
+  sf::FloatRect
+  getViewBounds() const;
+
+ /**
+  * @brief Obtiene cuántos píxeles del destino ocupa una unidad de mundo.
+  * Toma en cuenta la escala de resolución, así que baja junto con ella.
+  */
+  float
+  getPixelsPerUnit() const;
+
+ /**
+  * @brief Activa o desactiva el modo juego.
+  * En modo juego los actores se dibujan directamente en la sf::RenderWindow, sin la
+  * RenderTexture intermedia ni los paneles del editor, y la RenderTexture se libera
+  * (a menos que la escala de resolución sea menor a 1). Se alterna en tiempo de ejecución con F1.
+  */
+  void
+  setGameMode(bool gameMode);
+
+  // Indica si la ventana está en modo juego.
+  bool
+  isGameMode() const { return m_gameMode; }
+
+ /**
+  * @brief Envía la escena del frame actual a la grabación.
+  * Toma la región de la RenderTexture ocupada por la escena o, en modo juego sin
+  * RenderTexture, la ventana. Debe llamarse antes de dibujar ImGui para no grabar
+  * los paneles.
+  */
+  void
+  capture(FrameCapture& capture);
+
+  // Indica si se pulsó F2 (iniciar o detener la grabación) y limpia el aviso.
+  bool
+  consumeCaptureToggle();
+
+ /**
+  * @brief Obtiene el destino donde se dibuja la escena.
+  * La ventana en modo juego o la RenderTexture en modo editor; nullptr si no hay destino válido.
+  */
+  sf::RenderTarget*
+  getRenderTarget();
+
+ /**
+  * @brief Indica si el contenido de la RenderTexture se perdió y limpia el aviso.
+  * Ocurre al crear o redimensionar la textura y al volver del modo juego.
+  */
+  bool
+  consumeSceneInvalidation();
+
+  // Tamaño en píxeles de la escena dentro de la RenderTexture (puede ser menor que esta).
+  sf::Vector2u
+  getSceneSize() const { return m_sceneSize; }
+
+ /**
+  * @brief Cambia la escala de resolución con la que se dibuja la escena.
+  * La escena se dibuja en un subrectángulo escalado del destino y se amplía al
+  * mostrarse en ImGui o, en modo juego, al componerse en la ventana.
+  * @param scale Fracción (0-1] del tamaño de la ventana.
+  */
+  void
+  setResolutionScale(float scale);
+
+  // Escala de resolución actual de la escena.
+  float
+  getResolutionScale() const { return m_resolutionScale; }
+
+  // Reserva de destinos de render de la ventana.
+  const RenderTargetPool&
+  getTargetPool() const { return m_targetPool; }
+
 private:
-  sf::RenderWindow* m_window; // Puntero al objeto `RenderWindow` de SFML.
+ /**
+  * @brief Ajusta la escena al tamaño indicado.
+  * Devuelve el destino actual a la reserva y obtiene uno que contenga el tamaño escalado;
+  * si cae en el mismo paso se reutiliza el mismo destino sin recrearlo. La vista dibuja
+  * solo en el subrectángulo superior izquierdo.
+  */
+  void
+  resizeScene(unsigned int width, unsigned int height);
+
+  // Obtiene o libera la RenderTexture según el modo, el tamaño y la escala actuales.
+  void
+  rebuildSceneTarget();
+
+  // La escena pasa por la RenderTexture: en el editor o en modo juego a resolución reducida.
+  bool
+  usesSceneTarget() const { return !m_gameMode || m_resolutionScale < 1.0f; }
+
+  // Tiempo que el tamaño debe permanecer estable antes de reasignar la RenderTexture.
+  static constexpr float kResizeDebounceSeconds = 0.15f;
+
+  sf::RenderWindow* m_window = nullptr; // Puntero al objeto `RenderWindow` de SFML.
   sf::View m_view; // Vista de la ventana para manejar la perspectiva de visualización.
+  bool m_gameMode = false; // Dibuja directo a la ventana, sin editor.
+  bool m_sceneInvalidated = true; // La RenderTexture no conserva una escena válida.
+  bool m_captureToggle = false; // Se pulsó F2 desde la última consulta.
+
+  RenderTargetPool m_targetPool; // Destinos reutilizables para la escena.
+  sf::Vector2u m_sceneSize; // Subrectángulo de la RenderTexture ocupado por la escena.
+  sf::Vector2u m_sceneLogicalSize; // Tamaño de la ventana que cubre la vista de la escena.
+  float m_resolutionScale = 1.0f; // Escala de resolución de la escena.
+  sf::Vector2u m_pendingSize; // Último tamaño recibido mientras se redimensiona.
+  sf::Clock m_resizeClock; // Tiempo desde el último evento de redimensionamiento.
+  bool m_resizePending = false; // Hay un tamaño esperando a estabilizarse.
 
 public:
-  sf::RenderTexture m_renderTexture; // Textura para renderizar el contenido.
+  sf::RenderTexture* m_renderTexture = nullptr; // Textura para renderizar el contenido (solo en modo editor, propiedad de la reserva).
   sf::Time deltaTime; // Tiempo transcurrido entre frames.
   sf::Clock clock; // Reloj para calcular el tiempo transcurrido entre frames.
 };
\ No newline at end of file
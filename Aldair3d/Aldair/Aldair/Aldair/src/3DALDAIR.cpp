@@ -1,14 +1,42 @@
 #include "BaseApp.h"
 #include <SFML/Graphics.hpp>
 #include "Window.h"
+#include "LockstepReplay.h"
 
 // Declaramos un puntero a la ventana globalmente si es necesario.
 sf::RenderWindow* window = nullptr; // Inicializacin de window
 
-int main() {
+int main(int argc, char* argv[]) {
+    // --replay <archivo> [frames] y --replay-float <archivo> [frames]: prueba de determinismo
+    // sin ventana. La primera ejecucin graba los hashes por frame y las siguientes los comparan.
+    for (int i = 1; i < argc; ++i) {
+        const std::string option = argv[i];
+        if ((option == "--replay" || option == "--replay-float") && i + 1 < argc) {
+            unsigned int frames = 600;
+            if (i + 2 < argc) {
+                frames = static_cast<unsigned int>(std::strtoul(argv[i + 2], nullptr, 10));
+            }
+            return runReplayCheck(argv[i + 1], frames, option == "--replay");
+        }
+    }
+
     // Creamos una instancia de BaseApp, que probablemente maneja la lgica del ciclo de vida de la aplicacin.
     BaseApp app;
 
+    // --headless <carpeta> [frames]: graba frames sin interfaz para pruebas de regresin visual.
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) == "--headless" && i + 1 < argc) {
+            CaptureSettings settings;
+            settings.directory = argv[++i];
+            settings.overflow = CaptureOverflow::Backpressure;
+            unsigned int frames = 300;
+            if (i + 1 < argc) {
+                frames = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            app.setHeadless(settings, frames);
+        }
+    }
+
     // Ejecutamos la aplicacin, que puede manejar la ventana y el ciclo de actualizacin/renderizado.
     return app.run();
 }
@@ -31,12 +31,22 @@ void Actor::update(float deltaTime) {
     auto transform = getComponent<Transform>();
     auto shape = getComponent<ShapeFactory>();
 
-    // Si ambos componentes estn disponibles, sincronizar valores
-    if (transform && shape) {
-        shape->setPosition(Vector2(transform->getPosition().x, transform->getPosition().y));
-        shape->setRotation(transform->getRotation().x);
-        shape->setScale(Vector2(transform->getScale().x, transform->getScale().y));
+    if (!transform || !shape) {
+        return;
     }
+
+    // Si el atlas movi la textura, la geometra horneada qued desactualizada.
+    if (shape->refreshAtlasRegion() && m_isStatic) {
+        m_staticDirty = true;
+    }
+
+    // Los actores estticos ya estn horneados; solo se sincronizan cuando cambian.
+    if (m_isStatic && !m_staticDirty) {
+        return;
+    }
+
+    // Sincronizar la matriz en cach del Transform
+    shape->setMatrix(transform->getMatrix());
 }
 
 /**
@@ -49,11 +59,76 @@ void Actor::render(Window& window) {
     for (const auto& component : components) {
         auto shape = component.dynamic_pointer_cast<ShapeFactory>();
         if (shape) {
-            window.draw(*shape->getShape());
+            shape->draw(window);
         }
     }
 }
 
+/**
+ * @brief Marca al actor como esttico o dinmico.
+ * Cualquier cambio obliga a reconstruir la geometra horneada, ya sea para
+ * agregar al actor o para quitarlo de ella.
+ *
+ * @param isStatic `true` si el actor no se mueve.
+ */
+void Actor::setStatic(bool isStatic) {
+    if (m_isStatic != isStatic) {
+        m_isStatic = isStatic;
+        m_staticDirty = true;
+    }
+}
+
+/**
+ * @brief Consume el aviso de cambio de la geometra esttica.
+ *
+ * @return `true` si la geometra horneada debe reconstruirse.
+ */
+bool Actor::consumeStaticChange() {
+    bool changed = m_staticDirty;
+    m_staticDirty = false;
+    return changed;
+}
+
+/**
+ * @brief Cambia la capa de render del actor.
+ *
+ * @param layer Nueva capa.
+ */
+void Actor::setLayer(uint8_t layer) {
+    if (m_layer != layer) {
+        m_layer = layer;
+        m_orderChanged = true;
+    }
+}
+
+/**
+ * @brief Cambia el orden de dibujo del actor dentro de su capa.
+ *
+ * @param zOrder Nuevo orden (los valores bajos se dibujan primero).
+ */
+void Actor::setZOrder(int16_t zOrder) {
+    if (m_zOrder != zOrder) {
+        m_zOrder = zOrder;
+        m_orderChanged = true;
+    }
+}
+
+/**
+ * @brief Consume los avisos de cambio visibles del actor y de su forma.
+ *
+ * @return `true` si la escena debe redibujarse por este actor.
+ */
+bool Actor::consumeRenderChange() {
+    bool changed = m_orderChanged;
+    m_orderChanged = false;
+
+    auto shape = getComponent<ShapeFactory>();
+    if (shape && shape->consumeVisualChange()) {
+        changed = true;
+    }
+    return changed;
+}
+
 /**
  * @brief Mtodo para liberar recursos del actor.
  * Actualmente est vaco, pero puede ser extendido para realizar limpieza.
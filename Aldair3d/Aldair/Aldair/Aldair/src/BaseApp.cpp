@@ -30,17 +30,69 @@ int BaseApp::run() {
         "Todos los programas se inicializaron correctamente.");
     m_GUI.init();
 
+    // Sin interfaz: ventana oculta, resolución fija y simulación determinista.
+    if (m_headless) {
+        m_window->getWindow()->setVisible(false);
+        m_window->setGameMode(true);
+        m_resolution.setEnabled(false);
+        m_simulationStats.threaded = false;
+        if (!m_capture.start()) {
+            notifier.addMessage(ConsolErrorType::ERROR,
+                "No se pudo crear la carpeta de captura " + m_capture.getSettings().directory);
+            notifier.saveMessagesToFile("LogData.txt");
+            return -1;
+        }
+    }
+    setThreadedSimulation(m_simulationStats.threaded);
+
     while (m_window->isOpen()) {
         m_window->handleEvents();
         deltaTime = clock.restart();
         update();
         render();
+
+        if (m_headless && ++m_renderedFrames >= m_headlessFrames) {
+            m_window->getWindow()->close();
+        }
+
+        // El modo de simulación se cambia desde el panel de estadísticas.
+        if (m_simulationStats.threaded != m_simulation.isRunning()) {
+            setThreadedSimulation(m_simulationStats.threaded);
+        }
     }
 
+    m_simulation.stop();
+    m_capture.stop();
     cleanup();
     return 0;
 }
 
+void BaseApp::setHeadless(const CaptureSettings& settings, unsigned int frames) {
+    m_headless = true;
+    m_headlessFrames = std::max(frames, 1u);
+    m_capture.setSettings(settings);
+}
+
+// Alterna la grabación desde F2 o desde el panel de captura.
+void BaseApp::toggleCapture() {
+    NotificationService& notifier = NotificationService::getInstance();
+    if (m_capture.isRecording()) {
+        m_capture.stop();
+        const CaptureStats stats = m_capture.getStats();
+        notifier.addMessage(ConsolErrorType::NORMAL,
+            "Grabacion terminada: " + std::to_string(stats.written) + " frames escritos, " +
+            std::to_string(stats.dropped) + " descartados.");
+    }
+    else if (m_capture.start()) {
+        notifier.addMessage(ConsolErrorType::NORMAL,
+            "Grabando frames en " + m_capture.getSettings().directory);
+    }
+    else {
+        notifier.addMessage(ConsolErrorType::ERROR,
+            "No se pudo crear la carpeta de captura " + m_capture.getSettings().directory);
+    }
+}
+
 /**
  * @brief Inicializa los recursos de la aplicación.
  * Configura la ventana principal, actores y texturas necesarias.
@@ -59,9 +111,6 @@ bool BaseApp::initialize() {
         return false;
     }
 
-    // Configurar waypoints
-    initializeWaypoints();
-
     // Configurar actores
     if (!initializeActors(resourceManager, notifier)) {
         return false;
@@ -72,45 +121,415 @@ bool BaseApp::initialize() {
 
 /**
  * @brief Actualiza el estado de la aplicación en cada cuadro.
- * Gestiona los actores y su interacción con los puntos de recorrido.
+ * Atiende la ventana, la resolución y las pruebas de rendimiento, y hornea los actores
+ * estáticos. La simulación de los actores corre en su propio hilo; sin él, el paso se
+ * ejecuta aquí antes de dibujar.
  */
 void BaseApp::update() {
     m_window->update();
+    m_frameWaitMs = 0.0f;
+    if (m_window->consumeCaptureToggle() || m_GUI.consumeCaptureToggle()) {
+        toggleCapture();
+    }
+
+    // Promedio móvil del tiempo de frame, asignado al modo con el que se dibujó.
+    const float frameMs = deltaTime.asSeconds() * 1000.0f;
+    float& modeMs = m_renderedGameMode ? m_frameTimes.gameMs : m_frameTimes.editorMs;
+    modeMs = modeMs > 0.0f ? modeMs + 0.05f * (frameMs - modeMs) : frameMs;
 
-    for (auto& actor : m_actors) {
+    // La resolución de la escena sigue al tiempo de frame medido.
+    m_resolution.update(frameMs);
+    if (m_window->getResolutionScale() != m_resolution.getScale()) {
+        m_window->setResolutionScale(m_resolution.getScale());
+    }
+
+    // Vista y escala con las que la simulación hace el culling y elige el nivel de detalle.
+    const float pixelsPerUnit = m_window->getPixelsPerUnit();
+    {
+        std::lock_guard<std::mutex> lock(m_viewMutex);
+        m_simulationView = m_window->getViewBounds();
+        m_simulationPixelsPerUnit = pixelsPerUnit;
+    }
+
+    // Las pruebas de la biblioteca matemática no tocan el mundo.
+    if (m_benchmark.mathRequested) {
+        m_benchmark.measureMath();
+        m_benchmark.mathRequested = false;
+    }
+    if (m_benchmark.rotationRequested) {
+        m_benchmark.measureRotation(10000000);
+        m_benchmark.rotationRequested = false;
+    }
+    if (m_benchmark.batchRequested) {
+        m_benchmark.measureBatch(50000);
+        m_benchmark.batchRequested = false;
+    }
+    if (m_benchmark.quaternionRequested) {
+        m_benchmark.measureQuaternion(1000000);
+        m_benchmark.quaternionRequested = false;
+    }
+    if (m_benchmark.randomRequested) {
+        m_benchmark.measureRandom(10000000);
+        m_benchmark.randomRequested = false;
+    }
+    if (m_benchmark.geometryRequested) {
+        m_benchmark.measureGeometry(100000);
+        m_benchmark.geometryRequested = false;
+    }
+
+    // Las pruebas de rendimiento y el paso sin hilo modifican el mundo.
+    const bool benchmarkRequested = m_benchmark.spawnRequested || m_benchmark.tilemapRequested ||
+                                    m_benchmark.lodRequested || m_benchmark.particlesRequested;
+    if (benchmarkRequested || !m_simulation.isRunning()) {
+        auto world = lockWorld();
+
+        // Escena de prueba de rendimiento (formas en movimiento).
+        if (m_benchmark.spawnRequested) {
+            m_benchmark.spawn(m_actors, 100000, m_window->getViewBounds());
+            m_benchmark.spawnRequested = false;
+        }
+        if (m_benchmark.tilemapRequested) {
+            m_benchmark.measureTilemap(4096, m_window->getViewBounds());
+            m_benchmark.tilemapRequested = false;
+        }
+        if (m_benchmark.lodRequested) {
+            m_benchmark.measureLevelOfDetail(100000);
+            m_benchmark.lodRequested = false;
+        }
+        if (m_benchmark.particlesRequested) {
+            m_benchmark.measureParticles(1000000);
+            m_benchmark.particlesRequested = false;
+        }
+
+        if (!m_simulation.isRunning()) {
+            sf::Clock stepClock;
+            simulate(m_headless ? kHeadlessStep : m_window->deltaTime.asSeconds());
+            publishSnapshot();
+            const float stepMs = stepClock.getElapsedTime().asSeconds() * 1000.0f;
+            m_simulationStats.stepMs = m_simulationStats.stepMs > 0.0f
+                ? m_simulationStats.stepMs + 0.05f * (stepMs - m_simulationStats.stepMs) : stepMs;
+            m_simulationStats.rateHz = frameMs > 0.0f ? 1000.0f / frameMs : 0.0f;
+        }
+    }
+
+    // Mapas de tiles: siguen la posición de su actor. Solo el hilo principal los toca.
+    for (auto& actor : m_tilemapActors) {
+        auto tilemap = actor->getComponent<Tilemap>();
+        auto transform = actor->getComponent<Transform>();
+        if (tilemap.isNull() || transform.isNull()) {
+            continue;
+        }
+        tilemap->setPosition(sf::Vector2f(transform->getPosition().x, transform->getPosition().y));
+        if (tilemap->consumeChange()) {
+            m_sceneDirty = true;
+        }
+    }
+
+    // Pase estático: se hornea cuando un actor estático cambió o cuando, al cambiar la
+    // escala, algún círculo estático cambió de nivel de detalle.
+    const bool staticChanged = m_staticChanged.exchange(false);
+    if (staticChanged || m_staticBatch.isDirty() || pixelsPerUnit != m_lodPixelsPerUnit) {
+        auto world = lockWorld();
+        m_lodPixelsPerUnit = pixelsPerUnit;
+        bool rebuild = staticChanged || m_staticBatch.isDirty();
+        for (auto& actor : m_actors) {
+            if (actor.isNull() || !actor->isStatic()) {
+                continue;
+            }
+            auto shape = actor->getComponent<ShapeFactory>();
+            if (!shape.isNull() && shape->updateLevelOfDetail(pixelsPerUnit)) {
+                rebuild = true;
+            }
+        }
+        if (rebuild) {
+            m_staticBatch.build(m_actors);
+            m_sceneDirty = true;
+        }
+    }
+}
+
+/**
+ * @brief Inicia o detiene el hilo de simulación.
+ * Sin hilo, update() ejecuta el mismo paso en el hilo principal antes de dibujar.
+ */
+void BaseApp::setThreadedSimulation(bool threaded) {
+    m_simulationStats.threaded = threaded;
+    if (threaded) {
+        m_simulation.start([this](float step) { simulationStep(step); }, kSimulationRate);
+    }
+    else {
+        m_simulation.stop();
+    }
+}
+
+/**
+ * @brief Paso del hilo de simulación.
+ * Toma el mundo, avanza la simulación y publica la instantánea; mientras tanto el
+ * hilo principal sigue dibujando la anterior.
+ */
+void BaseApp::simulationStep(float deltaTime) {
+    const auto waitStart = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> world(m_worldMutex);
+    const float waitMs = std::chrono::duration<float, std::milli>(
+        std::chrono::steady_clock::now() - waitStart).count();
+    m_simulationWaitMs = m_simulationWaitMs > 0.0f
+        ? m_simulationWaitMs + 0.05f * (waitMs - m_simulationWaitMs) : waitMs;
+
+    simulate(deltaTime);
+    publishSnapshot();
+}
+
+/**
+ * @brief Avanza la simulación de los actores.
+ * Se llama con el mundo tomado, desde el hilo de simulación o desde update().
+ */
+void BaseApp::simulate(float deltaTime) {
+    bool changed = false;
+    m_benchmark.update(deltaTime);
+
+    // Altas y bajas de actores cambian la escena aunque nadie se mueva.
+    if (m_actors.size() != m_lastActorCount) {
+        m_lastActorCount = m_actors.size();
+        changed = true;
+    }
+
+    for (size_t i = 0; i < m_actors.size(); ++i) {
+        auto& actor = m_actors[i];
         if (!actor.isNull()) {
-            actor->update(m_window->deltaTime.asSeconds());
+            actor->update(deltaTime);
 
             if (actor->getName() == "Player") {
-                updateMovement(m_window->deltaTime.asSeconds(), actor);
+                updateMovement(deltaTime, actor);
+            }
+
+            // Un actor estático que cambió invalida la geometría horneada.
+            if (actor->consumeStaticChange()) {
+                m_staticChanged = true;
+                changed = true;
+            }
+
+            // Solo las formas que se movieron actualizan su entrada en el índice espacial.
+            auto shape = actor->getComponent<ShapeFactory>();
+            if (!shape.isNull() && shape->consumeBoundsChange()) {
+                m_spatialGrid.update(static_cast<uint32_t>(i), shape->getGlobalBounds());
+            }
+
+            if (actor->consumeRenderChange()) {
+                changed = true;
             }
         }
     }
+
+    // Emisores de partículas: emiten desde la posición de su actor.
+    for (auto& actor : m_emitterActors) {
+        auto emitter = actor->getComponent<ParticleEmitter>();
+        auto transform = actor->getComponent<Transform>();
+        if (emitter.isNull() || transform.isNull()) {
+            continue;
+        }
+        emitter->setOrigin(sf::Vector2f(transform->getPosition().x, transform->getPosition().y));
+        emitter->update(deltaTime);
+        if (emitter->getCount() > 0) {
+            changed = true;
+        }
+    }
+
+    if (changed) {
+        ++m_sceneVersion;
+    }
+}
+
+/**
+ * @brief Copia a la instantánea el estado de render de lo visible.
+ * Solo se copian los actores dinámicos cuyo AABB intersecta la última vista enviada
+ * por el hilo principal, con el nivel de detalle ya elegido, y los quads de las
+ * partículas. Se llama con el mundo tomado.
+ */
+void BaseApp::publishSnapshot() {
+    sf::FloatRect view;
+    float pixelsPerUnit = 1.0f;
+    {
+        std::lock_guard<std::mutex> lock(m_viewMutex);
+        view = m_simulationView;
+        pixelsPerUnit = m_simulationPixelsPerUnit;
+    }
+
+    SceneSnapshot& snapshot = m_snapshots.beginWrite();
+    snapshot.shapes.clear();
+    snapshot.particles.clear();
+    snapshot.lodSwitches = 0;
+
+    m_spatialGrid.query(view, m_visibleActors);
+    for (uint32_t index : m_visibleActors) {
+        const auto& actor = m_actors[index];
+        if (actor.isNull() || actor->isStatic()) {
+            continue;
+        }
+        auto shape = actor->getComponent<ShapeFactory>();
+        if (shape.isNull() || !shape->hasGeometry()) {
+            continue;
+        }
+        if (shape->updateLevelOfDetail(pixelsPerUnit)) {
+            ++snapshot.lodSwitches;
+        }
+
+        RenderProxy proxy;
+        proxy.transform = shape->getMatrix();
+        proxy.prototype = shape->getPrototype();
+        proxy.texture = shape->getTexture();
+        proxy.textureRect = shape->getTextureRect();
+        proxy.color = shape->getFillColor();
+        proxy.blendMode = shape->getBlendMode();
+        proxy.layer = actor->getLayer();
+        proxy.zOrder = actor->getZOrder();
+        snapshot.shapes.push_back(proxy);
+    }
+
+    for (auto& actor : m_emitterActors) {
+        auto emitter = actor->getComponent<ParticleEmitter>();
+        if (!emitter.isNull()) {
+            emitter->appendVertices(snapshot.particles);
+        }
+    }
+
+    // Un cambio de nivel de detalle cambia la geometría de esta misma instantánea.
+    if (snapshot.lodSwitches > 0) {
+        ++m_sceneVersion;
+    }
+    snapshot.step = ++m_simulationSteps;
+    snapshot.sceneVersion = m_sceneVersion;
+    snapshot.totalActors = m_actors.size();
+    snapshot.simulationWaitMs = m_simulationWaitMs;
+    snapshot.publishedAt = std::chrono::steady_clock::now();
+    m_snapshots.publish();
+}
+
+/**
+ * @brief Toma el mundo desde el hilo principal y acumula la espera del frame.
+ */
+std::unique_lock<std::mutex> BaseApp::lockWorld() {
+    const auto waitStart = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> world(m_worldMutex);
+    m_frameWaitMs += std::chrono::duration<float, std::milli>(
+        std::chrono::steady_clock::now() - waitStart).count();
+    return world;
 }
 
 /**
  * @brief Renderiza la ventana y los actores.
- * Dibuja cada actor, gestiona las interfaces gráficas y muestra el contenido en pantalla.
+ * Dibuja la instantánea más reciente publicada por la simulación. La escena solo se
+ * redibuja cuando la instantánea trae cambios; en otro caso se reutiliza el contenido
+ * de la RenderTexture y solo se redibuja la capa de ImGui. Gestiona las interfaces
+ * gráficas y muestra el contenido en pantalla.
+ * En modo juego los actores se dibujan directo en la ventana y se omiten los paneles del editor.
  */
 void BaseApp::render() {
     NotificationService& notifier = NotificationService::getInstance();
 
-    m_window->clear();
-    for (const auto& actor : m_actors) {
-        if (!actor.isNull()) {
-            actor->render(*m_window);
-        }
+    // Si no hay una instantánea nueva se sigue usando la anterior.
+    m_snapshots.acquire();
+    const SceneSnapshot& snapshot = m_snapshots.read();
+    if (snapshot.sceneVersion != m_renderedSceneVersion) {
+        m_renderedSceneVersion = snapshot.sceneVersion;
+        m_sceneDirty = true;
+    }
+    m_simulationStats.stepsPerFrame = snapshot.step - m_renderedStep;
+    m_renderedStep = snapshot.step;
+    if (snapshot.step > 0) {
+        m_simulationStats.snapshotAgeMs = std::chrono::duration<float, std::milli>(
+            std::chrono::steady_clock::now() - snapshot.publishedAt).count();
+    }
+
+    // La ventana en modo juego se limpia cada frame, así que ahí siempre se dibuja la escena.
+    if (m_window->consumeSceneInvalidation() || m_benchmark.scalingRequested) {
+        m_sceneDirty = true;
+    }
+    const bool redrawScene = m_sceneDirty || m_window->isGameMode();
+    m_sceneDirty = false;
+    m_frameTimes.sceneReused = !redrawScene;
+
+    m_window->clear(redrawScene);
+    if (redrawScene) {
+        renderScene(snapshot);
+    }
+
+    // En modo juego los actores ya están en la ventana: solo queda el overlay.
+    m_renderedGameMode = m_window->isGameMode();
+    m_frameTimes.gameMode = m_renderedGameMode;
+    if (redrawScene) {
+        m_window->renderToTexture();  // Finalizar el renderizado a la textura
+    }
+    if (m_capture.isRecording()) {
+        m_window->capture(m_capture); // Solo la escena, antes de los paneles
+    }
+    if (!m_renderedGameMode) {
+        m_window->showInImGui();      // Mostrar en la interfaz gráfica (ImGui)
+        m_GUI.console(notifier.getNotifications());
+
+        // Los paneles del editor leen y modifican los actores en vivo.
+        auto world = lockWorld();
+        m_GUI.inspector();
+        m_GUI.hierarchy(m_actors);
+        m_GUI.benchmark(m_benchmark);
+        m_GUI.capture(m_capture);
     }
 
-    m_window->renderToTexture();  // Finalizar el renderizado a la textura
-    m_window->showInImGui();      // Mostrar en la interfaz gráfica (ImGui)
-    m_GUI.console(notifier.getNotifications());
-    m_GUI.inspector();
-    m_GUI.hierarchy(m_actors);
+    if (m_simulation.isRunning()) {
+        m_simulationStats.stepMs = m_simulation.getStepMs();
+        m_simulationStats.rateHz = m_simulation.getRateHz();
+    }
+    m_simulationStats.simulationWaitMs = snapshot.simulationWaitMs;
+    m_simulationStats.renderWaitMs += 0.05f * (m_frameWaitMs - m_simulationStats.renderWaitMs);
+
+    RenderStats renderStats = m_batcher.getStats();
+    renderStats.staticVertices = m_staticBatch.getVertexCount();
+    renderStats.lodSwitches = snapshot.lodSwitches;
+    m_GUI.stats(renderStats, snapshot.shapes.size(), snapshot.totalActors, m_frameTimes,
+                m_resolution, m_simulationStats);
     m_window->render();
     m_window->display();
 }
 
+/**
+ * @brief Dibuja una instantánea de la escena en el destino activo de la ventana.
+ * Dibuja primero los mapas de tiles y la geometría horneada de los actores estáticos,
+ * después las formas dinámicas de la instantánea y al final las partículas.
+ */
+void BaseApp::renderScene(const SceneSnapshot& snapshot) {
+    // Fondo: mapas de tiles, un buffer por chunk visible.
+    for (auto& actor : m_tilemapActors) {
+        auto tilemap = actor->getComponent<Tilemap>();
+        if (!tilemap.isNull()) {
+            tilemap->draw(*m_window);
+        }
+    }
+
+    // Pase estático: buffers horneados en update().
+    m_staticBatch.render(*m_window);
+
+    // Pase dinámico: la simulación ya hizo el culling. Cada forma de la instantánea
+    // emite un comando; la cola los ordena por capa, profundidad, textura y mezcla.
+    // La construcción de vértices se reparte entre hilos y solo el envío final toca SFML.
+    m_renderQueue.clear();
+    for (size_t i = 0; i < snapshot.shapes.size(); ++i) {
+        const RenderProxy& shape = snapshot.shapes[i];
+        m_renderQueue.push(shape.layer, shape.zOrder, shape.texture, shape.blendMode,
+                           static_cast<uint32_t>(i));
+    }
+    m_renderQueue.sort();
+
+    if (m_benchmark.scalingRequested) {
+        m_benchmark.measureScaling(m_batcher, m_renderQueue, snapshot.shapes);
+        m_benchmark.scalingRequested = false;
+    }
+
+    m_batcher.build(m_renderQueue, snapshot.shapes);
+    m_batcher.submit(*m_window);
+
+    // Partículas: un solo arreglo de quads con todos los emisores.
+    m_window->draw(snapshot.particles.data(), snapshot.particles.size(), sf::Quads);
+}
+
 /**
  * @brief Libera los recursos de la aplicación.
  * Limpia la ventana y elimina los punteros dinámicos.
@@ -123,21 +542,6 @@ void BaseApp::cleanup() {
     }
 }
 
-/**
- * @brief Inicializa los waypoints utilizados para el movimiento de los actores.
- */
-void BaseApp::initializeWaypoints() {
-    points[0] = Vector2(720.0f, 350.0f);
-    points[1] = Vector2(720.0f, 260.0f);
-    points[2] = Vector2(125.0f, 50.0f);
-    points[3] = Vector2(70.0f, 120.0f);
-    points[4] = Vector2(70.0f, 450.0f);
-    points[5] = Vector2(400.0f, 350.0f);
-    points[6] = Vector2(550.0f, 500.0f);
-    points[7] = Vector2(650.0f, 550.0f);
-    points[8] = Vector2(720.0f, 450.0f);
-}
-
 /**
  * @brief Inicializa los actores principales (Track, Circle, Triangle).
  *
@@ -146,9 +550,11 @@ void BaseApp::initializeWaypoints() {
  * @return `true` si todos los actores se inicializan correctamente.
  */
 bool BaseApp::initializeActors(ResourceManager& resourceManager, NotificationService& notifier) {
-    // Track
-    if (!initializeActor("Track", ShapeType::RECTANGLE, Vector2(11.0f, 12.0f),
-        "Circuit", resourceManager, notifier)) {
+    // Track: mapa de tiles si existe; si no, la imagen completa del circuito.
+    if (!initializeTilemap("Track", "Tracks/Circuit", "Tracks/CircuitTiles", 32,
+        resourceManager, notifier) &&
+        !initializeActor("Track", ShapeType::RECTANGLE, Vector2(11.0f, 12.0f),
+        "Circuit", resourceManager, notifier, true)) {
         return false;
     }
 
@@ -168,6 +574,17 @@ bool BaseApp::initializeActors(ResourceManager& resourceManager, NotificationSer
         m_actors.push_back(Triangle);
     }
 
+    // Particles
+    auto particles = EngineUtilities::MakeShared<Actor>("Particles");
+    if (!particles.isNull()) {
+        particles->getComponent<Transform>()->setTransform(Vector2(400.0f, 300.0f),
+            Vector2(0.0f, 0.0f),
+            Vector2(1.0f, 1.0f));
+        particles->addComponent(EngineUtilities::MakeShared<ParticleEmitter>(20000));
+        m_actors.push_back(particles);
+        m_emitterActors.push_back(particles);
+    }
+
     return true;
 }
 
@@ -180,12 +597,14 @@ bool BaseApp::initializeActors(ResourceManager& resourceManager, NotificationSer
  * @param textureId ID de la textura en el ResourceManager.
  * @param resourceManager Administrador de recursos para cargar texturas.
  * @param notifier Servicio de notificaciones para registrar errores.
+ * @param isStatic Indica si el actor nunca se mueve (su geometría se hornea).
  * @return `true` si el actor se configura correctamente.
  */
 bool BaseApp::initializeActor(const std::string& name, ShapeType shapeType,
     const Vector2& scale, const std::string& textureId,
     ResourceManager& resourceManager,
-    NotificationService& notifier) {
+    NotificationService& notifier,
+    bool isStatic) {
     auto actor = EngineUtilities::MakeShared<Actor>(name);
     if (actor.isNull()) {
         notifier.addMessage(ConsolErrorType::ERROR,
@@ -198,18 +617,60 @@ bool BaseApp::initializeActor(const std::string& name, ShapeType shapeType,
         Vector2(0.0f, 0.0f),
         scale);
 
-    if (!resourceManager.loadTexture(textureId, "png")) {
-        notifier.addMessage(ConsolErrorType::ERROR,
-            "Error al cargar la textura: " + textureId);
+    // Las texturas pequeñas se empaquetan en el atlas para compartir página con otras
+    // formas; las que no caben en una página se cargan como textura independiente.
+    auto shape = actor->getComponent<ShapeFactory>();
+    if (resourceManager.loadTextureToAtlas(textureId, "png")) {
+        shape->setAtlasTexture(resourceManager.getAtlas(), textureId);
+    }
+    else {
+        if (!resourceManager.loadTexture(textureId, "png")) {
+            notifier.addMessage(ConsolErrorType::ERROR,
+                "Error al cargar la textura: " + textureId);
+            return false;
+        }
+
+        auto texture = resourceManager.getTexture(textureId);
+        if (texture) {
+            shape->setTexture(&texture->getTexture());
+        }
+    }
+
+    actor->setStatic(isStatic);
+    m_actors.push_back(actor);
+    return true;
+}
+
+/**
+ * @brief Crea un actor con un mapa de tiles cargado desde archivo.
+ *
+ * @param name Nombre del actor.
+ * @param mapFile Archivo de la capa de tiles (sin la extensión ".tmap").
+ * @param tilesetId ID de la textura del tileset, que se empaqueta en el atlas.
+ * @param tilePixels Tamaño en píxeles de cada celda del tileset.
+ * @param resourceManager Administrador de recursos para cargar el tileset.
+ * @param notifier Servicio de notificaciones para registrar errores.
+ * @return `true` si el mapa se cargó.
+ */
+bool BaseApp::initializeTilemap(const std::string& name, const std::string& mapFile,
+    const std::string& tilesetId, unsigned int tilePixels,
+    ResourceManager& resourceManager,
+    NotificationService& notifier) {
+    auto tilemap = EngineUtilities::MakeShared<Tilemap>();
+    if (tilemap.isNull() || !tilemap->loadFromFile(mapFile + ".tmap")) {
         return false;
     }
 
-    auto texture = resourceManager.getTexture(textureId);
-    if (texture) {
-        actor->getComponent<ShapeFactory>()->getShape()->setTexture(&texture->getTexture());
+    if (!resourceManager.loadTextureToAtlas(tilesetId, "png") ||
+        !tilemap->setTileset(resourceManager.getAtlas(), tilesetId, tilePixels)) {
+        notifier.addMessage(ConsolErrorType::WARNING,
+            "No se encontro el tileset " + tilesetId + ", se usan colores de depuracion.");
     }
 
+    auto actor = EngineUtilities::MakeShared<Actor>(name);
+    actor->addComponent(tilemap);
     m_actors.push_back(actor);
+    m_tilemapActors.push_back(actor);
     return true;
 }
 
@@ -225,13 +686,13 @@ void BaseApp::updateMovement(float deltaTime, EngineUtilities::TSharedPointer<Ac
     auto transform = circle->getComponent<Transform>();
     if (transform.isNull()) return;
 
-    Vector2 targetPos = points[m_currentPoint];
+    Vector2 targetPos = kWaypoints[m_currentPoint];
     transform->Seek(targetPos, 200.0f, deltaTime, 10.0f);
 
     Vector2 currentPos = transform->getPosition();
     float distanceToTarget = (targetPos - currentPos).magnitude();
 
     if (distanceToTarget < 10.0f) {
-        m_currentPoint = (m_currentPoint + 1) % 9; // Circular traversal
+        m_currentPoint = (m_currentPoint + 1) % kWaypointCount; // Circular traversal
     }
 }
@@ -0,0 +1,623 @@
+#include "BenchmarkScene.h"
+#include "Services/JobSystem.h"
+#include "MathEngine.h"
+#include "MathBatch.h"
+#include "Random.h"
+#include <cstdlib>
+#include <chrono>
+#include <cmath>
+#include <random>
+
+namespace {
+  // Tiempo promedio por llamada, en nanosegundos, sobre las mismas entradas.
+  template<typename Function>
+  float timePerCall(Function function, const std::vector<float>& inputs, int repeats) {
+    volatile float sink = 0.0f;
+    float accumulator = 0.0f;
+    const auto begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r) {
+      for (float x : inputs) {
+        accumulator += function(x);
+      }
+    }
+    const auto end = std::chrono::steady_clock::now();
+    sink = accumulator;
+    (void)sink;
+    return static_cast<float>(std::chrono::duration<double, std::nano>(end - begin).count() /
+                              (static_cast<double>(repeats) * inputs.size()));
+  }
+
+  // Cuaternión (w, x, y, z) sin SIMD para la referencia escalar.
+  struct ScalarQuaternion {
+    float w, x, y, z;
+  };
+
+  ScalarQuaternion multiplyScalar(const ScalarQuaternion& a, const ScalarQuaternion& b) {
+    return { a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z,
+             a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+             a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+             a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w };
+  }
+
+  // slerp de libro en float con std::acos y std::sin, como referencia de tiempo.
+  Quaternion slerpStd(const Quaternion& a, Quaternion b, float t) {
+    float cosine = a.w * b.w + a.x * b.x + a.y * b.y + a.z * b.z;
+    if (cosine < 0.0f) {
+      b = b * -1.0f;
+      cosine = -cosine;
+    }
+    if (cosine > Quaternion::kSlerpLinearThreshold) {
+      return (a * (1.0f - t) + b * t).normalize();
+    }
+    const float theta = std::acos(cosine);
+    const float sinTheta = std::sin(theta);
+    return a * (std::sin((1.0f - t) * theta) / sinTheta) + b * (std::sin(t * theta) / sinTheta);
+  }
+}
+
+void BenchmarkScene::spawn(std::vector<EngineUtilities::TSharedPointer<Actor>>& actors,
+                           size_t count,
+                           const sf::FloatRect& area) {
+  sf::Clock clock;
+  m_area = area;
+  std::mt19937 generator(1234);
+  std::uniform_real_distribution<float> randomX(area.left, area.left + area.width);
+  std::uniform_real_distribution<float> randomY(area.top, area.top + area.height);
+  std::uniform_real_distribution<float> randomSpeed(-150.0f, 150.0f);
+  std::uniform_int_distribution<int> randomColor(64, 255);
+
+  actors.reserve(actors.size() + count);
+  m_transforms.reserve(m_transforms.size() + count);
+  m_velocities.reserve(m_velocities.size() + count);
+
+  for (size_t i = 0; i < count; ++i) {
+    auto actor = EngineUtilities::MakeShared<Actor>("Bench");
+    auto shape = actor->getComponent<ShapeFactory>();
+    auto transform = actor->getComponent<Transform>();
+    shape->createShape(ShapeType::CIRCLE);
+    shape->setFillColor(sf::Color(randomColor(generator), randomColor(generator), randomColor(generator)));
+    transform->setTransform(Vector2(randomX(generator), randomY(generator)),
+                            Vector2(0.0f, 0.0f),
+                            Vector2(0.25f, 0.25f));
+
+    m_transforms.push_back(transform.get());
+    m_velocities.push_back(Vector2(randomSpeed(generator), randomSpeed(generator)));
+    actors.push_back(actor);
+  }
+
+  m_spawnMs = clock.getElapsedTime().asSeconds() * 1000.0f;
+  m_spawnCount = count;
+}
+
+void BenchmarkScene::update(float deltaTime) {
+  const float right = m_area.left + m_area.width;
+  const float bottom = m_area.top + m_area.height;
+
+  for (size_t i = 0; i < m_transforms.size(); ++i) {
+    Vector2 position = m_transforms[i]->getPosition() + m_velocities[i] * deltaTime;
+    Vector2& velocity = m_velocities[i];
+    if (position.x < m_area.left || position.x > right) {
+      velocity.x = -velocity.x;
+    }
+    if (position.y < m_area.top || position.y > bottom) {
+      velocity.y = -velocity.y;
+    }
+    m_transforms[i]->setPosition(position);
+  }
+}
+
+void BenchmarkScene::measureScaling(RenderBatcher& batcher,
+                                    const RenderQueue& queue,
+                                    const std::vector<RenderProxy>& items) {
+  constexpr int kRepetitions = 10;
+  JobSystem& jobs = JobSystem::getInstance();
+  const size_t originalThreads = jobs.getThreadCount();
+  const size_t maxThreads = std::max<unsigned int>(std::thread::hardware_concurrency(), 1);
+
+  m_scalingResults.clear();
+  for (size_t threads = 1; threads <= maxThreads; ++threads) {
+    jobs.setThreadCount(threads);
+    batcher.build(queue, items); // Calentamiento: reserva la memoria de los chunks.
+
+    float totalMs = 0.0f;
+    for (int i = 0; i < kRepetitions; ++i) {
+      batcher.build(queue, items);
+      totalMs += batcher.getStats().buildMs;
+    }
+
+    ScalingSample sample;
+    sample.threads = threads;
+    sample.buildMs = totalMs / kRepetitions;
+    m_scalingResults.push_back(sample);
+  }
+
+  jobs.setThreadCount(originalThreads);
+}
+
+void BenchmarkScene::measureParticles(size_t count) {
+  constexpr int kRepetitions = 20;
+  constexpr float kStep = 1.0f / 60.0f;
+
+  // Vida larga para que ninguna partícula muera durante la medición.
+  ParticleEmitter emitter(count);
+  emitter.setLifetime(1000.0f, 1000.0f);
+  emitter.emit(count);
+
+  auto measure = [&](auto&& step) {
+    step(); // Calentamiento.
+    sf::Clock clock;
+    for (int i = 0; i < kRepetitions; ++i) {
+      step();
+    }
+    return clock.getElapsedTime().asSeconds() * 1000.0f / kRepetitions;
+  };
+
+  m_particleResults.particles = emitter.getCount();
+  m_particleResults.threads = JobSystem::getInstance().getThreadCount();
+  m_particleResults.scalarMs = measure([&] { emitter.simulateScalar(kStep); });
+  m_particleResults.simdMs = measure([&] { emitter.simulate(kStep, false); });
+  m_particleResults.parallelMs = measure([&] { emitter.simulate(kStep, true); });
+}
+
+void BenchmarkScene::measureTilemap(unsigned int size, const sf::FloatRect& view) {
+  constexpr float kTileSize = 16.0f;
+  constexpr int kEdits = 256;
+
+  m_tilemapResults = TilemapResults();
+  m_tilemapResults.size = size;
+
+  Tilemap tilemap;
+  tilemap.create(size, size, kTileSize);
+  m_tilemapResults.chunks = tilemap.getChunkCount();
+
+  // Patrón de 8 tiles con huecos, para que haya tiles vacíos como en un mapa real.
+  sf::Clock clock;
+  for (unsigned int y = 0; y < size; ++y) {
+    for (unsigned int x = 0; x < size; ++x) {
+      tilemap.setTile(x, y, static_cast<uint16_t>((x / 7 + y / 5) % 9));
+    }
+  }
+  m_tilemapResults.fillMs = clock.getElapsedTime().asSeconds() * 1000.0f;
+
+  // Vista centrada en el mapa con el tamaño de la vista de referencia escalado.
+  const sf::Vector2f center(size * kTileSize * 0.5f, size * kTileSize * 0.5f);
+  auto zoomedView = [&](float zoom) {
+    const sf::Vector2f extent(view.width * zoom, view.height * zoom);
+    return sf::FloatRect(center - extent * 0.5f, extent);
+  };
+
+  for (float zoom : { 1.0f, 2.0f, 4.0f }) {
+    TilemapSample sample;
+    sample.zoom = zoom;
+    const sf::FloatRect area = zoomedView(zoom);
+
+    clock.restart();
+    tilemap.prepare(area);
+    sample.buildMs = clock.getElapsedTime().asSeconds() * 1000.0f;
+    sample.visibleChunks = tilemap.getVisibleChunkCount();
+    sample.vertices = tilemap.getVisibleVertexCount();
+
+    clock.restart();
+    tilemap.prepare(area);
+    sample.cullMs = clock.getElapsedTime().asSeconds() * 1000.0f;
+    m_tilemapResults.samples.push_back(sample);
+  }
+
+  // Ediciones dentro de la vista de zoom 1: solo sus chunks se reconstruyen.
+  const sf::FloatRect area = zoomedView(1.0f);
+  std::mt19937 generator(99);
+  std::uniform_real_distribution<float> randomX(area.left, area.left + area.width);
+  std::uniform_real_distribution<float> randomY(area.top, area.top + area.height);
+  for (int i = 0; i < kEdits; ++i) {
+    const unsigned int x = static_cast<unsigned int>(randomX(generator) / kTileSize);
+    const unsigned int y = static_cast<unsigned int>(randomY(generator) / kTileSize);
+    tilemap.setTile(x, y, static_cast<uint16_t>(1 + i % 8));
+  }
+  clock.restart();
+  tilemap.prepare(area);
+  m_tilemapResults.editMs = clock.getElapsedTime().asSeconds() * 1000.0f;
+  m_tilemapResults.editedChunks = tilemap.getRebuiltChunkCount();
+}
+
+void BenchmarkScene::measureLevelOfDetail(size_t count) {
+  constexpr int kJitterCycles = 10;
+  // Lados de sf::CircleShape por defecto: 30 lados, 28 triángulos.
+  constexpr size_t kFixedVerticesPerCircle = (30 - 2) * 3;
+
+  m_lodResults = LevelOfDetailResults();
+  m_lodResults.shapes = count;
+
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<float> randomScale(0.1f, 4.0f);
+  std::vector<ShapeFactory> shapes;
+  shapes.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    shapes.emplace_back(ShapeType::CIRCLE);
+    ShapeFactory& shape = shapes.back();
+    shape.createShape(ShapeType::CIRCLE);
+    const float scale = randomScale(generator);
+    shape.setScale(Vector2(scale, scale));
+  }
+
+  std::vector<sf::Vertex> vertices;
+  sf::Clock clock;
+  for (float zoom : { 0.25f, 1.0f, 4.0f, 16.0f }) {
+    LevelOfDetailSample sample;
+    sample.zoom = zoom;
+    sample.fixedVertices = count * kFixedVerticesPerCircle;
+
+    clock.restart();
+    for (ShapeFactory& shape : shapes) {
+      sample.switches += shape.updateLevelOfDetail(zoom) ? 1 : 0;
+    }
+    sample.selectMs = clock.getElapsedTime().asSeconds() * 1000.0f;
+
+    vertices.clear();
+    clock.restart();
+    for (const ShapeFactory& shape : shapes) {
+      shape.appendVertices(vertices);
+    }
+    sample.buildMs = clock.getElapsedTime().asSeconds() * 1000.0f;
+    sample.vertices = vertices.size();
+
+    // Oscilación pequeña del zoom: sin histéresis los círculos cerca de un umbral
+    // cambiarían de nivel en cada paso.
+    for (int cycle = 0; cycle < kJitterCycles; ++cycle) {
+      for (float factor : { 1.05f, 1.0f / 1.05f }) {
+        for (ShapeFactory& shape : shapes) {
+          sample.jitterSwitches += shape.updateLevelOfDetail(zoom * factor) ? 1 : 0;
+        }
+      }
+    }
+    for (ShapeFactory& shape : shapes) {
+      shape.updateLevelOfDetail(zoom);
+    }
+    m_lodResults.samples.push_back(sample);
+  }
+}
+
+void BenchmarkScene::measureMath() {
+  constexpr int kTimingInputs = 1 << 16;
+  constexpr int kTimingRepeats = 32;
+
+  m_mathResults.clear();
+  std::mt19937 generator(11);
+  std::vector<float> inputs(kTimingInputs);
+
+  // Cronometra ambas versiones con las mismas entradas uniformes en [low, high].
+  auto measure = [&](const char* name, const char* domain, auto function, auto stdFunction,
+                     float low, float high) {
+    MathSample sample;
+    sample.name = name;
+    sample.domain = domain;
+
+    std::uniform_real_distribution<float> random(low, high);
+    for (float& x : inputs) {
+      x = random(generator);
+    }
+    sample.engineNs = timePerCall(function, inputs, kTimingRepeats);
+    sample.stdNs = timePerCall(stdFunction, inputs, kTimingRepeats);
+    m_mathResults.push_back(sample);
+  };
+
+  measure("sqrt", "[1e-30, 1e30]", [](float x) { return MathEngine::sqrt(x); },
+          [](float x) { return std::sqrt(x); }, 1.0e-30f, 1.0e30f);
+  measure("rsqrt", "[1e-3, 1e3]", [](float x) { return MathEngine::rsqrt(x); },
+          [](float x) { return 1.0f / std::sqrt(x); }, 1.0e-3f, 1.0e3f);
+  measure("sin", "[-32, 32]", [](float x) { return MathEngine::sin(x); },
+          [](float x) { return std::sin(x); }, -32.0f, 32.0f);
+  measure("sin", "[-1e6, 1e6]", [](float x) { return MathEngine::sin(x); },
+          [](float x) { return std::sin(x); },
+          -MathEngine::TRIG_ACCURATE_RANGE, MathEngine::TRIG_ACCURATE_RANGE);
+  measure("cos", "[-32, 32]", [](float x) { return MathEngine::cos(x); },
+          [](float x) { return std::cos(x); }, -32.0f, 32.0f);
+  measure("cos", "[-1e6, 1e6]", [](float x) { return MathEngine::cos(x); },
+          [](float x) { return std::cos(x); },
+          -MathEngine::TRIG_ACCURATE_RANGE, MathEngine::TRIG_ACCURATE_RANGE);
+  measure("sincos", "[-32, 32]", [](float x) { float s, c; MathEngine::sincos(x, s, c); return s + c; },
+          [](float x) { return std::sin(x) + std::cos(x); }, -32.0f, 32.0f);
+  measure("tan", "[-1.5, 1.5]", [](float x) { return MathEngine::tan(x); },
+          [](float x) { return std::tan(x); }, -1.5f, 1.5f);
+  measure("atan", "[-100, 100]", [](float x) { return MathEngine::atan(x); },
+          [](float x) { return std::atan(x); }, -100.0f, 100.0f);
+  // atan2 con y = x y x = 1 - x.
+  measure("atan2", "[-100, 100]", [](float x) { return MathEngine::atan2(x, 1.0f - x); },
+          [](float x) { return std::atan2(x, 1.0f - x); }, -100.0f, 100.0f);
+}
+
+void BenchmarkScene::measureRotation(size_t count) {
+  m_rotationResults = RotationResults();
+  m_rotationResults.vectors = count;
+  m_rotationResults.instructionSet = SIMD::getInstructionSetName();
+
+  std::mt19937 generator(5);
+  std::uniform_real_distribution<float> random(-100.0f, 100.0f);
+  std::vector<Vector4> input(count);
+  for (Vector4& v : input) {
+    v = Vector4(random(generator), random(generator), random(generator), 1.0f);
+  }
+  std::vector<Vector4> scalar(count);
+  std::vector<Vector4> simd(count);
+  const Quaternion rotation(1.1f, Vector3(0.48f, 0.6f, 0.64f));
+
+  sf::Clock clock;
+  const ScalarQuaternion q = { rotation.w, rotation.x, rotation.y, rotation.z };
+  const float magSquared = q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z;
+  const ScalarQuaternion inverse = { q.w / magSquared, -q.x / magSquared, -q.y / magSquared, -q.z / magSquared };
+  for (size_t i = 0; i < count; ++i) {
+    const ScalarQuaternion r = multiplyScalar(multiplyScalar(q, { 0.0f, input[i].x, input[i].y, input[i].z }), inverse);
+    scalar[i] = Vector4(r.x, r.y, r.z, input[i].w);
+  }
+  m_rotationResults.scalarMs = clock.getElapsedTime().asSeconds() * 1000.0f;
+
+  clock.restart();
+  rotation.rotate(input.data(), simd.data(), count);
+  m_rotationResults.simdMs = clock.getElapsedTime().asSeconds() * 1000.0f;
+}
+
+void BenchmarkScene::measureQuaternion(size_t count) {
+  m_quaternionResults = QuaternionResults();
+  m_quaternionResults.vectors = count;
+
+  std::mt19937 generator(11);
+  std::uniform_real_distribution<float> random(-100.0f, 100.0f);
+  std::normal_distribution<float> gaussian(0.0f, 1.0f);
+  std::uniform_real_distribution<float> randomT(0.0f, 1.0f);
+  auto randomRotation = [&]() {
+    return Quaternion(gaussian(generator), gaussian(generator), gaussian(generator), gaussian(generator)).normalize();
+  };
+
+  std::vector<Vector4> input(count);
+  for (Vector4& v : input) {
+    v = Vector4(random(generator), random(generator), random(generator), 1.0f);
+  }
+  std::vector<Vector4> rotated(count);
+  std::vector<Vector4> rotatedUnit(count);
+  const Quaternion rotation(1.1f, Vector3(0.48f, 0.6f, 0.64f));
+
+  sf::Clock clock;
+  rotation.rotate(input.data(), rotated.data(), count);
+  m_quaternionResults.rotateMs = clock.getElapsedTime().asSeconds() * 1000.0f;
+  clock.restart();
+  rotation.rotateUnit(input.data(), rotatedUnit.data(), count);
+  m_quaternionResults.rotateUnitMs = clock.getElapsedTime().asSeconds() * 1000.0f;
+
+  // Interpolación: pares aleatorios de cuaterniones unitarios con t por elemento.
+  std::vector<Quaternion> from(count), to(count), slerped(count), nlerped(count), stdSlerped(count);
+  std::vector<float> t(count);
+  for (size_t i = 0; i < count; ++i) {
+    from[i] = randomRotation();
+    to[i] = randomRotation();
+    t[i] = randomT(generator);
+  }
+  // La mitad de los pares casi coinciden para cubrir el caso de ángulos pequeños.
+  for (size_t i = 0; i < count; i += 2) {
+    to[i] = (from[i] + Quaternion(gaussian(generator), gaussian(generator), gaussian(generator),
+                                  gaussian(generator)) * 1.0e-3f).normalize();
+  }
+
+  clock.restart();
+  for (size_t i = 0; i < count; ++i) {
+    stdSlerped[i] = slerpStd(from[i], to[i], t[i]);
+  }
+  m_quaternionResults.stdSlerpMs = clock.getElapsedTime().asSeconds() * 1000.0f;
+
+  const MathBatch::ConstQuaternionSpan fromSpan(from.data(), count);
+  const MathBatch::ConstQuaternionSpan toSpan(to.data(), count);
+  clock.restart();
+  MathBatch::slerpBatch(fromSpan, toSpan, t.data(), { slerped.data(), count });
+  m_quaternionResults.slerpBatchMs = clock.getElapsedTime().asSeconds() * 1000.0f;
+  clock.restart();
+  MathBatch::nlerpBatch(fromSpan, toSpan, t.data(), { nlerped.data(), count });
+  m_quaternionResults.nlerpBatchMs = clock.getElapsedTime().asSeconds() * 1000.0f;
+}
+
+void BenchmarkScene::measureRandom(size_t count) {
+  m_randomResults = RandomResults();
+  m_randomResults.numbers = count;
+  m_randomResults.instructionSet = SIMD::getInstructionSetName();
+
+  std::vector<float> x(count), y(count);
+  sf::Clock clock;
+  auto record = [&](const char* name) {
+    RandomSample sample;
+    sample.name = name;
+    sample.ms = clock.getElapsedTime().asSeconds() * 1000.0f;
+    sample.numbersPerNs = sample.ms > 0.0f ? static_cast<float>(count) / (sample.ms * 1.0e6f) : 0.0f;
+    m_randomResults.samples.push_back(sample);
+  };
+
+  clock.restart();
+  for (size_t i = 0; i < count; ++i) {
+    x[i] = static_cast<float>(std::rand()) / (static_cast<float>(RAND_MAX) + 1.0f);
+  }
+  record("rand()");
+
+  std::mt19937 generator(3);
+  std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+  clock.restart();
+  for (size_t i = 0; i < count; ++i) {
+    x[i] = uniform(generator);
+  }
+  record("std::mt19937");
+
+  Random random(3);
+  clock.restart();
+  for (size_t i = 0; i < count; ++i) {
+    x[i] = random.nextFloat();
+  }
+  record("Random::nextFloat");
+
+  clock.restart();
+  random.fillRange(x.data(), count, -10.0f, 10.0f);
+  record("Random::fillRange");
+
+  clock.restart();
+  random.fillUniform(x.data(), count);
+  record("Random::fillUniform");
+
+  clock.restart();
+  random.fillUnitVectors({ x.data(), y.data(), count });
+  record("fillUnitVectors");
+}
+
+void BenchmarkScene::measureBatch(size_t count) {
+  constexpr int kRepeats = 20;
+  constexpr float kDeltaTime = 1.0f / 60.0f;
+
+  m_batchResults = BatchResults();
+  m_batchResults.agents = count;
+  const MathBatch::InstructionSet supported = MathBatch::getSupportedInstructionSet();
+  m_batchResults.supported = MathBatch::getInstructionSetName(supported);
+
+  std::mt19937 generator(9);
+  std::uniform_real_distribution<float> randomPosition(-1000.0f, 1000.0f);
+  std::uniform_real_distribution<float> randomSpeed(50.0f, 250.0f);
+  std::uniform_real_distribution<float> randomAngle(-3.14f, 3.14f);
+  std::vector<float> x(count), y(count), targetX(count), targetY(count);
+  std::vector<float> speeds(count), angles(count), lengths(count);
+  for (size_t i = 0; i < count; ++i) {
+    x[i] = randomPosition(generator);
+    y[i] = randomPosition(generator);
+    targetX[i] = randomPosition(generator);
+    targetY[i] = randomPosition(generator);
+    speeds[i] = randomSpeed(generator);
+    angles[i] = randomAngle(generator);
+  }
+
+  // Referencia: un Transform por agente, como lo mueve el código de juego.
+  std::vector<Transform> transforms(count);
+  for (size_t i = 0; i < count; ++i) {
+    transforms[i].setPosition(Vector2(x[i], y[i]));
+  }
+  sf::Clock clock;
+  for (int r = 0; r < kRepeats; ++r) {
+    for (size_t i = 0; i < count; ++i) {
+      transforms[i].Seek(Vector2(targetX[i], targetY[i]), speeds[i], kDeltaTime, 1.0f);
+    }
+  }
+  m_batchResults.transformSeekMs = clock.getElapsedTime().asSeconds() * 1000.0f / kRepeats;
+
+  const MathBatch::Vector2Span positions = { x.data(), y.data(), count };
+  const MathBatch::ConstVector2Span targets(targetX.data(), targetY.data(), count);
+  auto timeKernel = [&](auto kernel) {
+    clock.restart();
+    for (int r = 0; r < kRepeats; ++r) {
+      kernel();
+    }
+    return clock.getElapsedTime().asSeconds() * 1000.0f / kRepeats;
+  };
+  auto measure = [&](const char* name, auto kernel) {
+    BatchSample sample;
+    sample.name = name;
+    MathBatch::setInstructionSet(MathBatch::InstructionSet::Scalar);
+    sample.scalarMs = timeKernel(kernel);
+    MathBatch::setInstructionSet(MathBatch::InstructionSet::SSE2);
+    sample.sse2Ms = timeKernel(kernel);
+    if (supported == MathBatch::InstructionSet::AVX2) {
+      MathBatch::setInstructionSet(MathBatch::InstructionSet::AVX2);
+      sample.avx2Ms = timeKernel(kernel);
+    }
+    m_batchResults.samples.push_back(sample);
+  };
+
+  measure("seekBatch", [&]() {
+    MathBatch::seekBatch(positions, targets, speeds.data(), kDeltaTime, 1.0f);
+  });
+  measure("translateBatch", [&]() {
+    MathBatch::translateBatch(positions, targets, kDeltaTime);
+  });
+  measure("rotateScaleBatch", [&]() {
+    MathBatch::rotateScaleBatch(positions, angles.data(), 1.0f, 1.0f);
+  });
+  measure("lengthBatch", [&]() {
+    MathBatch::lengthBatch(positions, lengths.data());
+  });
+  measure("normalizeBatch", [&]() {
+    MathBatch::normalizeBatch(positions);
+  });
+  MathBatch::setInstructionSet(supported);
+}
+
+void BenchmarkScene::measureGeometry(size_t count) {
+  constexpr size_t kRounds = 16;
+  constexpr float kWorld = 1000.0f;
+
+  m_geometryResults = GeometryResults();
+  m_geometryResults.elements = count;
+  m_geometryResults.rounds = kRounds;
+  const MathBatch::InstructionSet supported = MathBatch::getSupportedInstructionSet();
+  m_geometryResults.supported = MathBatch::getInstructionSetName(supported);
+
+  GeometrySample overlap, raycast, polygonSample;
+  overlap.name = "overlapAABBBatch";
+  raycast.name = "raycastCirclesBatch";
+  polygonSample.name = "pointsInPolygonBatch";
+
+  // Ejecuta kernel con cada conjunto de instrucciones soportado.
+  sf::Clock clock;
+  auto run = [&](GeometrySample& sample, auto kernel) {
+    const MathBatch::InstructionSet sets[] = { MathBatch::InstructionSet::Scalar,
+                                               MathBatch::InstructionSet::SSE2,
+                                               MathBatch::InstructionSet::AVX2 };
+    float* times[] = { &sample.scalarMs, &sample.sse2Ms, &sample.avx2Ms };
+    for (int set = 0; set < 3; ++set) {
+      if (static_cast<int>(sets[set]) > static_cast<int>(supported)) {
+        break;
+      }
+      MathBatch::setInstructionSet(sets[set]);
+      clock.restart();
+      kernel();
+      *times[set] += clock.getElapsedTime().asSeconds() * 1000.0f / kRounds;
+    }
+  };
+
+  Random random(17);
+  std::vector<float> minX(count), minY(count), maxX(count), maxY(count), radius(count), distances(count);
+  std::vector<uint8_t> flags(count);
+  std::vector<Vector2> polygon;
+  for (size_t round = 0; round < kRounds; ++round) {
+    random.fillRange(minX.data(), count, -kWorld, kWorld);
+    random.fillRange(minY.data(), count, -kWorld, kWorld);
+    random.fillRange(maxX.data(), count, 0.0f, 50.0f);
+    random.fillRange(maxY.data(), count, 0.0f, 50.0f);
+    random.fillRange(radius.data(), count, 1.0f, 40.0f);
+    for (size_t i = 0; i < count; ++i) {
+      maxX[i] += minX[i];
+      maxY[i] += minY[i];
+    }
+
+    // Una caja contra todas.
+    const AABB box = AABB::fromCenter(Vector2(random.range(-kWorld, kWorld), random.range(-kWorld, kWorld)),
+                                      Vector2(random.range(10.0f, 200.0f), random.range(10.0f, 200.0f)));
+    const MathBatch::ConstAABBSpan boxes = { minX.data(), minY.data(), maxX.data(), maxY.data(), count };
+    run(overlap, [&]() { MathBatch::overlapAABBBatch(box, boxes, flags.data()); });
+
+    // Un rayo contra los círculos con centro en las esquinas mínimas de las cajas.
+    const Ray ray(Vector2(random.range(-kWorld, kWorld), random.range(-kWorld, kWorld)), random.unitVector());
+    const MathBatch::ConstCircleSpan circles = { minX.data(), minY.data(), radius.data(), count };
+    run(raycast, [&]() { MathBatch::raycastCirclesBatch(ray, circles, distances.data()); });
+
+    // Estrella cóncava de 3 a 32 vértices contra los centros de las cajas.
+    const size_t vertexCount = 3 + random.nextInt(30);
+    const Vector2 center(random.range(-kWorld, kWorld) * 0.5f, random.range(-kWorld, kWorld) * 0.5f);
+    polygon.resize(vertexCount);
+    for (size_t v = 0; v < vertexCount; ++v) {
+      const float angle = MathEngine::TWO_PI * static_cast<float>(v) / static_cast<float>(vertexCount);
+      polygon[v] = center + Vector2(MathEngine::cos(angle), MathEngine::sin(angle)) * random.range(100.0f, kWorld);
+    }
+    for (size_t i = 0; i < count; ++i) {
+      minX[i] = (minX[i] + maxX[i]) * 0.5f;
+      minY[i] = (minY[i] + maxY[i]) * 0.5f;
+    }
+    const MathBatch::ConstVector2Span points(minX.data(), minY.data(), count);
+    run(polygonSample, [&]() {
+      MathBatch::pointsInPolygonBatch(polygon.data(), vertexCount, points, flags.data());
+    });
+  }
+  MathBatch::setInstructionSet(supported);
+
+  m_geometryResults.samples.push_back(overlap);
+  m_geometryResults.samples.push_back(raycast);
+  m_geometryResults.samples.push_back(polygonSample);
+}
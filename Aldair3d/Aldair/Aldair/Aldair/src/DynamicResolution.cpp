@@ -0,0 +1,65 @@
+#include "DynamicResolution.h"
+
+DynamicResolution::DynamicResolution(float targetMs, float minScale, float maxScale)
+  : m_targetMs(targetMs), m_minScale(minScale), m_maxScale(maxScale), m_scale(maxScale) {
+}
+
+/**
+ * @brief Acumula el tiempo de frame y decide si la escala sube o baja.
+ * Se usa un promedio móvil para que un solo frame lento no dispare un cambio.
+ */
+bool DynamicResolution::update(float frameMs) {
+  m_history[m_historyOffset] = frameMs;
+  m_historyOffset = (m_historyOffset + 1) % m_history.size();
+
+  m_averageMs = m_averageMs > 0.0f ? m_averageMs + 0.1f * (frameMs - m_averageMs) : frameMs;
+  if (!m_enabled) {
+    return false;
+  }
+
+  if (m_averageMs > m_targetMs * kOverBudget) {
+    m_underBudgetFrames = 0;
+    if (++m_overBudgetFrames >= kFramesToDecrease) {
+      return applyScale(m_scale - kScaleStep);
+    }
+  }
+  else if (m_averageMs < m_targetMs * kUnderBudget) {
+    m_overBudgetFrames = 0;
+    if (++m_underBudgetFrames >= kFramesToIncrease) {
+      return applyScale(m_scale + kScaleStep);
+    }
+  }
+  else {
+    // Dentro de la banda muerta: la escala se mantiene.
+    m_overBudgetFrames = 0;
+    m_underBudgetFrames = 0;
+  }
+  return false;
+}
+
+void DynamicResolution::setScaleRange(float minScale, float maxScale) {
+  m_minScale = std::max(0.1f, std::min(minScale, maxScale));
+  m_maxScale = std::max(m_minScale, maxScale);
+  m_scale = std::max(m_minScale, std::min(m_scale, m_maxScale));
+}
+
+void DynamicResolution::setEnabled(bool enabled) {
+  m_enabled = enabled;
+  if (!m_enabled) {
+    applyScale(m_maxScale);
+  }
+}
+
+bool DynamicResolution::applyScale(float scale) {
+  m_overBudgetFrames = 0;
+  m_underBudgetFrames = 0;
+
+  // Se redondea al paso para que la escena tenga pocos tamaños posibles.
+  scale = std::round(scale / kScaleStep) * kScaleStep;
+  scale = std::max(m_minScale, std::min(scale, m_maxScale));
+  if (scale == m_scale) {
+    return false;
+  }
+  m_scale = scale;
+  return true;
+}
@@ -0,0 +1,183 @@
+#include "FrameCapture.h"
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+
+bool FrameCapture::start() {
+  stop();
+
+  std::error_code error;
+  std::filesystem::create_directories(m_settings.directory, error);
+  if (error) {
+    return false;
+  }
+
+  m_directory = m_settings.directory;
+  m_prefix = m_settings.prefix;
+  m_readbacks = std::vector<Readback>(std::max<size_t>(m_settings.readbackDelay, 1));
+  m_nextReadback = 0;
+  m_nextFrame = 0;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats = CaptureStats();
+    m_queue.clear();
+    m_stopping = false;
+  }
+
+  const size_t threads = std::max<size_t>(m_settings.encoderThreads, 1);
+  for (size_t i = 0; i < threads; ++i) {
+    m_workers.emplace_back([this]() { workerLoop(); });
+  }
+  m_recording = true;
+  return true;
+}
+
+void FrameCapture::stop() {
+  if (!m_recording) {
+    return;
+  }
+
+  // Los frames que siguen en el anillo se leen en orden, del más antiguo al más nuevo.
+  for (size_t i = 0; i < m_readbacks.size(); ++i) {
+    Readback& readback = m_readbacks[(m_nextReadback + i) % m_readbacks.size()];
+    if (readback.pending) {
+      readOut(readback);
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stopping = true;
+  }
+  m_hasWork.notify_all();
+  for (std::thread& worker : m_workers) {
+    worker.join();
+  }
+  m_workers.clear();
+  m_readbacks.clear();
+  m_recording = false;
+}
+
+void FrameCapture::captureTexture(const sf::Texture& source, const sf::IntRect& area) {
+  if (!m_recording) {
+    return;
+  }
+  Readback& readback = nextReadback(source.getSize());
+  readback.texture.update(source);
+  readback.area = area;
+}
+
+void FrameCapture::captureWindow(const sf::RenderWindow& window) {
+  if (!m_recording) {
+    return;
+  }
+  Readback& readback = nextReadback(window.getSize());
+  readback.texture.update(window);
+  readback.area = sf::IntRect(0, 0, window.getSize().x, window.getSize().y);
+}
+
+CaptureStats FrameCapture::getStats() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  CaptureStats stats = m_stats;
+  stats.queued = m_queue.size();
+  return stats;
+}
+
+FrameCapture::Readback& FrameCapture::nextReadback(const sf::Vector2u& size) {
+  Readback& readback = m_readbacks[m_nextReadback];
+  m_nextReadback = (m_nextReadback + 1) % m_readbacks.size();
+
+  // La textura tiene el frame de hace readbackDelay capturas: ya terminó en la GPU.
+  if (readback.pending) {
+    readOut(readback);
+  }
+  if (readback.texture.getSize() != size) {
+    readback.texture.create(size.x, size.y);
+  }
+
+  readback.frame = m_nextFrame++;
+  readback.pending = true;
+  std::lock_guard<std::mutex> lock(m_mutex);
+  ++m_stats.captured;
+  return readback;
+}
+
+/**
+ * @brief Lee el frame a memoria y lo encola.
+ * Con DropFrames la cola llena se revisa antes de leer, así un frame descartado no
+ * cuesta la lectura. Con Backpressure se espera a que un hilo libere espacio.
+ */
+void FrameCapture::readOut(Readback& readback) {
+  readback.pending = false;
+  const size_t capacity = std::max<size_t>(m_settings.queueCapacity, 1);
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_queue.size() >= capacity) {
+      if (m_settings.overflow == CaptureOverflow::DropFrames) {
+        ++m_stats.dropped;
+        return;
+      }
+      const auto waitStart = std::chrono::steady_clock::now();
+      m_hasRoom.wait(lock, [&]() { return m_queue.size() < capacity; });
+      m_stats.backpressureMs += std::chrono::duration<float, std::milli>(
+        std::chrono::steady_clock::now() - waitStart).count();
+    }
+  }
+
+  sf::Clock clock;
+  EncodeJob job;
+  job.image = readback.texture.copyToImage();
+  job.area = readback.area;
+  job.frame = readback.frame;
+  const float readbackMs = clock.getElapsedTime().asSeconds() * 1000.0f;
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.readbackMs = m_stats.readbackMs > 0.0f
+      ? m_stats.readbackMs + 0.05f * (readbackMs - m_stats.readbackMs) : readbackMs;
+    m_queue.push_back(std::move(job));
+  }
+  m_hasWork.notify_one();
+}
+
+void FrameCapture::workerLoop() {
+  for (;;) {
+    EncodeJob job;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_hasWork.wait(lock, [this]() { return m_stopping || !m_queue.empty(); });
+      if (m_queue.empty()) {
+        return;
+      }
+      job = std::move(m_queue.front());
+      m_queue.pop_front();
+    }
+    m_hasRoom.notify_one();
+
+    sf::Clock clock;
+    const sf::Vector2u size = job.image.getSize();
+    sf::Image output;
+    if (job.area == sf::IntRect(0, 0, size.x, size.y)) {
+      output = std::move(job.image);
+    }
+    else {
+      output.create(job.area.width, job.area.height);
+      output.copy(job.image, 0, 0, job.area);
+    }
+
+    char name[32];
+    std::snprintf(name, sizeof(name), "_%06llu.png", static_cast<unsigned long long>(job.frame));
+    const bool saved = output.saveToFile(m_directory + "/" + m_prefix + name);
+    const float encodeMs = clock.getElapsedTime().asSeconds() * 1000.0f;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (saved) {
+      ++m_stats.written;
+    }
+    else {
+      ++m_stats.failed;
+    }
+    m_stats.encodeMs = m_stats.encodeMs > 0.0f
+      ? m_stats.encodeMs + 0.05f * (encodeMs - m_stats.encodeMs) : encodeMs;
+  }
+}
@@ -116,15 +116,15 @@ void GUI::hierarchy(std::vector<EngineUtilities::TSharedPointer<Actor>>& actors)
 
     // Botones para crear actores
     if (ImGui::Button("Create Circle")) {
-        createActor(ShapeType::CIRCLE, "Circle", 100.0f, 100.0f);
+        createActor(actors, ShapeType::CIRCLE, "Circle", 100.0f, 100.0f);
     }
 
     if (ImGui::Button("Create Rectangle")) {
-        createActor(ShapeType::RECTANGLE, "Rectangle", 200.0f, 150.0f);
+        createActor(actors, ShapeType::RECTANGLE, "Rectangle", 200.0f, 150.0f);
     }
 
     if (ImGui::Button("Create Triangle")) {
-        createActor(ShapeType::TRIANGLE, "Triangle", 150.0f, 200.0f);
+        createActor(actors, ShapeType::TRIANGLE, "Triangle", 150.0f, 200.0f);
     }
 
     ImGui::End();
@@ -151,23 +151,379 @@ void GUI::inspector() {
         selectedActor->setName(std::string(objectName));
     }
 
+    // Los actores estáticos se hornean en buffers de GPU.
+    bool isStatic = selectedActor->isStatic();
+    if (ImGui::Checkbox("Static", &isStatic)) {
+        selectedActor->setStatic(isStatic);
+    }
+
+    // Capa y orden de dibujo dentro de la capa.
+    int layer = selectedActor->getLayer();
+    if (ImGui::SliderInt("Layer", &layer, 0, 255)) {
+        selectedActor->setLayer(static_cast<uint8_t>(layer));
+    }
+    int zOrder = selectedActor->getZOrder();
+    if (ImGui::DragInt("Z Order", &zOrder, 1.0f, -32768, 32767)) {
+        selectedActor->setZOrder(static_cast<int16_t>(zOrder));
+    }
+
     // Modificar atributos de transformación (posición, rotación, escala)
     auto transform = selectedActor->getComponent<Transform>();
     if (!transform.isNull()) {
-        vec2Control("Position", transform->getPosData());
-        vec2Control("Rotation", transform->getRotData());
-        vec2Control("Scale", transform->getSclData());
+        bool changed = vec2Control("Position", transform->getPosData());
+        changed |= vec2Control("Rotation", transform->getRotData());
+        changed |= vec2Control("Scale", transform->getSclData());
+
+        // La geometría horneada de un actor estático debe reconstruirse.
+        if (changed && selectedActor->isStatic()) {
+            selectedActor->markDirty();
+        }
+    }
+
+    // Parámetros del emisor de partículas, si el actor tiene uno.
+    auto emitter = selectedActor->getComponent<ParticleEmitter>();
+    if (!emitter.isNull()) {
+        ImGui::Separator();
+        ImGui::Text("Particulas: %zu / %zu", emitter->getCount(), emitter->getCapacity());
+        float rate = emitter->getEmissionRate();
+        if (ImGui::DragFloat("Emission Rate", &rate, 10.0f, 0.0f, 1000000.0f)) {
+            emitter->setEmissionRate(rate);
+        }
+        float lifetime[2] = { emitter->getMinLifetime(), emitter->getMaxLifetime() };
+        if (ImGui::DragFloat2("Lifetime", lifetime, 0.05f, 0.01f, 60.0f)) {
+            emitter->setLifetime(lifetime[0], lifetime[1]);
+        }
+        float speed = emitter->getSpeed();
+        if (ImGui::DragFloat("Speed", &speed, 1.0f, 0.0f, 2000.0f)) {
+            emitter->setSpeed(speed);
+        }
+        float gravity = emitter->getGravity();
+        if (ImGui::DragFloat("Gravity", &gravity, 1.0f, -2000.0f, 2000.0f)) {
+            emitter->setGravity(gravity);
+        }
+        float size = emitter->getParticleSize();
+        if (ImGui::DragFloat("Size", &size, 0.1f, 0.5f, 64.0f)) {
+            emitter->setParticleSize(size);
+        }
+        sf::Color color = emitter->getColor();
+        float rgba[4] = { color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f };
+        if (ImGui::ColorEdit4("Color", rgba)) {
+            emitter->setColor(sf::Color(static_cast<sf::Uint8>(rgba[0] * 255.0f), static_cast<sf::Uint8>(rgba[1] * 255.0f),
+                                        static_cast<sf::Uint8>(rgba[2] * 255.0f), static_cast<sf::Uint8>(rgba[3] * 255.0f)));
+        }
+    }
+
+    ImGui::End();
+}
+
+// ----------------------------------------------------
+// ** STATS **
+// ----------------------------------------------------
+
+// Muestra las estadísticas de render del frame.
+void GUI::stats(const RenderStats& stats, size_t visibleActors, size_t totalActors,
+                const FrameTimes& frameTimes, DynamicResolution& resolution,
+                SimulationStats& simulation) {
+    // En modo juego no hay dockspace: el panel se fija como overlay semitransparente.
+    ImGuiWindowFlags flags = ImGuiWindowFlags_None;
+    if (frameTimes.gameMode) {
+        flags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize |
+                ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoFocusOnAppearing |
+                ImGuiWindowFlags_NoNav | ImGuiWindowFlags_NoMove;
+        ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f));
+        ImGui::SetNextWindowBgAlpha(0.5f);
+    }
+
+    ImGui::Begin("Stats", nullptr, flags);
+    ImGui::Text("Modo: %s (F1 para alternar)", frameTimes.gameMode ? "juego" : "editor");
+    ImGui::Text("Frame editor: %.2f ms  juego: %.2f ms", frameTimes.editorMs, frameTimes.gameMs);
+    if (frameTimes.editorMs > 0.0f && frameTimes.gameMs > 0.0f) {
+        ImGui::Text("Diferencia: %.2f ms (%.0f%%)", frameTimes.editorMs - frameTimes.gameMs,
+                    100.0f * (frameTimes.editorMs - frameTimes.gameMs) / frameTimes.editorMs);
+    }
+    ImGui::Text("Escena: %s", frameTimes.sceneReused ? "reutilizada" : "redibujada");
+
+    // Resolución dinámica: escala actual e historial de tiempos de frame.
+    ImGui::Separator();
+    ImGui::Text("Escala de resolucion: %.2f (%.2f ms promedio)", resolution.getScale(),
+                resolution.getAverageMs());
+    ImGui::PlotLines("##FrameTimes", resolution.getHistory(),
+                     static_cast<int>(resolution.getHistorySize()),
+                     static_cast<int>(resolution.getHistoryOffset()),
+                     "Frame (ms)", 0.0f, resolution.getTargetMs() * 2.0f, ImVec2(0.0f, 60.0f));
+    if (!frameTimes.gameMode) {
+        bool enabled = resolution.isEnabled();
+        if (ImGui::Checkbox("Resolucion dinamica", &enabled)) {
+            resolution.setEnabled(enabled);
+        }
+        float targetMs = resolution.getTargetMs();
+        if (ImGui::SliderFloat("Objetivo (ms)", &targetMs, 4.0f, 50.0f, "%.1f")) {
+            resolution.setTargetMs(targetMs);
+        }
+        float range[2] = { resolution.getMinScale(), resolution.getMaxScale() };
+        if (ImGui::SliderFloat2("Escala min/max", range, 0.25f, 1.0f, "%.2f")) {
+            resolution.setScaleRange(range[0], range[1]);
+        }
+    }
+
+    // Simulación desacoplada: frecuencia, antigüedad de la instantánea y esperas.
+    ImGui::Separator();
+    ImGui::Text("Simulacion: %s, %.0f Hz, paso %.2f ms",
+                simulation.threaded ? "hilo propio" : "hilo principal", simulation.rateHz, simulation.stepMs);
+    ImGui::Text("Instantanea: %.2f ms de antiguedad, %llu pasos desde el frame anterior",
+                simulation.snapshotAgeMs, static_cast<unsigned long long>(simulation.stepsPerFrame));
+    ImGui::Text("Espera por el mundo: simulacion %.3f ms, render %.3f ms",
+                simulation.simulationWaitMs, simulation.renderWaitMs);
+    if (!frameTimes.gameMode) {
+        ImGui::Checkbox("Simulacion en hilo propio", &simulation.threaded);
     }
 
+    ImGui::Separator();
+    ImGui::Text("Actores visibles: %zu / %zu", visibleActors, totalActors);
+    ImGui::Text("Comandos: %zu", stats.commands);
+    ImGui::Text("Draw calls: %zu", stats.drawCalls);
+    ImGui::Text("Cambios de estado: %zu (ahorrados: %zu)", stats.stateChanges, stats.stateChangesSaved);
+    ImGui::Text("Vertices dinamicos: %zu  estaticos: %zu", stats.vertices, stats.staticVertices);
+    ImGui::Text("Cambios de nivel de detalle: %zu", stats.lodSwitches);
+    ImGui::Text("Build: %.2f ms (%zu hilos)  Submit: %.2f ms", stats.buildMs, stats.threads, stats.submitMs);
     ImGui::End();
 }
 
+// ----------------------------------------------------
+// ** BENCHMARK **
+// ----------------------------------------------------
+
+// Muestra los controles de la escena de prueba y los resultados de escalamiento.
+void GUI::benchmark(BenchmarkScene& scene) {
+    ImGui::Begin("Benchmark");
+    ImGui::Text("Formas de prueba: %zu", scene.getShapeCount());
+
+    if (ImGui::Button("Spawn 100k shapes")) {
+        scene.spawnRequested = true;
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Measure scaling")) {
+        scene.scalingRequested = true;
+    }
+    if (scene.getSpawnCount() > 0) {
+        ImGui::Text("Ultimo spawn: %zu formas en %.1f ms", scene.getSpawnCount(), scene.getSpawnMs());
+    }
+    ImGui::Text("ShapeFactory: %zu bytes por forma, %zu prototipos compartidos",
+                sizeof(ShapeFactory), ShapePrototypeCache::getInstance().getPrototypeCount());
+    if (ImGui::Button("Particles 1M (headless)")) {
+        scene.particlesRequested = true;
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Tilemap 4096x4096")) {
+        scene.tilemapRequested = true;
+    }
+    if (ImGui::Button("Circle LOD 100k")) {
+        scene.lodRequested = true;
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Math timing")) {
+        scene.mathRequested = true;
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Rotate 10M vectors")) {
+        scene.rotationRequested = true;
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Batch math 50k")) {
+        scene.batchRequested = true;
+    }
+    if (ImGui::Button("Quaternion 1M")) {
+        scene.quaternionRequested = true;
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Random 10M")) {
+        scene.randomRequested = true;
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Geometry 100k")) {
+        scene.geometryRequested = true;
+    }
+
+    const auto& batch = scene.getBatchResults();
+    if (batch.agents > 0) {
+        ImGui::Separator();
+        ImGui::Text("MathBatch: %zu agentes (procesador: %s)", batch.agents, batch.supported);
+        ImGui::Text("Transform::Seek por agente: %.3f ms", batch.transformSeekMs);
+        for (const auto& sample : batch.samples) {
+            ImGui::Text("%-16s escalar %.3f ms  SSE2 %.3f ms  AVX2 %.3f ms",
+                        sample.name, sample.scalarMs, sample.sse2Ms, sample.avx2Ms);
+        }
+    }
+
+    const auto& geometry = scene.getGeometryResults();
+    if (geometry.elements > 0) {
+        ImGui::Separator();
+        ImGui::Text("Geometria: %zu elementos x %zu rondas (procesador: %s)",
+                    geometry.elements, geometry.rounds, geometry.supported);
+        for (const auto& sample : geometry.samples) {
+            ImGui::Text("%-20s escalar %.3f ms  SSE2 %.3f ms  AVX2 %.3f ms",
+                        sample.name, sample.scalarMs, sample.sse2Ms, sample.avx2Ms);
+        }
+    }
+
+    const auto& random = scene.getRandomResults();
+    if (random.numbers > 0) {
+        ImGui::Separator();
+        ImGui::Text("Numeros aleatorios: %zu por generador (%s)", random.numbers, random.instructionSet);
+        for (const auto& sample : random.samples) {
+            ImGui::Text("%-20s %8.2f ms  %6.3f numeros/ns", sample.name, sample.ms, sample.numbersPerNs);
+        }
+    }
+
+    const auto& quaternion = scene.getQuaternionResults();
+    if (quaternion.vectors > 0) {
+        ImGui::Separator();
+        ImGui::Text("Cuaterniones unitarios: %zu vectores y pares", quaternion.vectors);
+        ImGui::Text("rotate %7.2f ms  rotateUnit %7.2f ms", quaternion.rotateMs, quaternion.rotateUnitMs);
+        ImGui::Text("slerp std %7.2f ms  slerpBatch %7.2f ms (x%.2f)  nlerpBatch %7.2f ms",
+                    quaternion.stdSlerpMs, quaternion.slerpBatchMs,
+                    quaternion.slerpBatchMs > 0.0f ? quaternion.stdSlerpMs / quaternion.slerpBatchMs : 0.0f,
+                    quaternion.nlerpBatchMs);
+    }
+
+    const auto& rotation = scene.getRotationResults();
+    if (rotation.vectors > 0) {
+        ImGui::Separator();
+        ImGui::Text("Rotacion de %zu vectores (%s)", rotation.vectors, rotation.instructionSet);
+        ImGui::Text("Escalar: %7.2f ms  SIMD: %7.2f ms (x%.2f)",
+                    rotation.scalarMs, rotation.simdMs,
+                    rotation.simdMs > 0.0f ? rotation.scalarMs / rotation.simdMs : 0.0f);
+    }
+
+    const auto& math = scene.getMathResults();
+    if (!math.empty()) {
+        ImGui::Separator();
+        ImGui::Text("MathEngine contra std (ns por llamada; precision: Aldair3dBench --check)");
+        for (const auto& sample : math) {
+            ImGui::Text("%-6s %-14s %6.2f ns  std %6.2f ns (x%.2f)", sample.name, sample.domain,
+                        sample.engineNs, sample.stdNs,
+                        sample.engineNs > 0.0f ? sample.stdNs / sample.engineNs : 0.0f);
+        }
+    }
+
+    const auto& lod = scene.getLevelOfDetailResults();
+    if (lod.shapes > 0) {
+        ImGui::Separator();
+        ImGui::Text("Nivel de detalle: %zu circulos", lod.shapes);
+        for (const auto& sample : lod.samples) {
+            ImGui::Text("Zoom x%.2f: %zu vertices (fijo %zu), eleccion %.2f ms, build %.2f ms",
+                        sample.zoom, sample.vertices, sample.fixedVertices, sample.selectMs, sample.buildMs);
+            ImGui::Text("    %zu cambios de nivel, %zu al oscilar el zoom", sample.switches, sample.jitterSwitches);
+        }
+    }
+
+    const auto& tilemap = scene.getTilemapResults();
+    if (tilemap.size > 0) {
+        ImGui::Separator();
+        ImGui::Text("Tilemap %ux%u: %zu chunks, llenado %.1f ms", tilemap.size, tilemap.size,
+                    tilemap.chunks, tilemap.fillMs);
+        for (const auto& sample : tilemap.samples) {
+            ImGui::Text("Zoom x%.0f: %zu chunks, %zu vertices, build %.2f ms, culling %.3f ms",
+                        sample.zoom, sample.visibleChunks, sample.vertices, sample.buildMs, sample.cullMs);
+        }
+        ImGui::Text("Edicion: %zu chunks reconstruidos en %.2f ms", tilemap.editedChunks, tilemap.editMs);
+    }
+
+    const auto& particles = scene.getParticleResults();
+    if (particles.particles > 0) {
+        ImGui::Separator();
+        ImGui::Text("Particulas: %zu (kernel %s)", particles.particles, ParticleEmitter::getKernelName());
+        ImGui::Text("Escalar, 1 nucleo: %7.3f ms", particles.scalarMs);
+        ImGui::Text("SIMD, 1 nucleo:    %7.3f ms (x%.2f)", particles.simdMs,
+                    particles.simdMs > 0.0f ? particles.scalarMs / particles.simdMs : 0.0f);
+        ImGui::Text("SIMD, %zu hilos:    %7.3f ms (x%.2f)", particles.threads, particles.parallelMs,
+                    particles.parallelMs > 0.0f ? particles.scalarMs / particles.parallelMs : 0.0f);
+    }
+
+    const auto& results = scene.getScalingResults();
+    if (!results.empty()) {
+        ImGui::Separator();
+        const float baseMs = results.front().buildMs;
+        for (const auto& sample : results) {
+            float speedup = sample.buildMs > 0.0f ? baseMs / sample.buildMs : 0.0f;
+            ImGui::Text("%2zu hilos: %7.3f ms  (x%.2f)", sample.threads, sample.buildMs, speedup);
+        }
+    }
+    ImGui::End();
+}
+
+// ----------------------------------------------------
+// ** CAPTURA **
+// ----------------------------------------------------
+
+void GUI::capture(FrameCapture& capture) {
+    ImGui::Begin("Captura");
+    const bool recording = capture.isRecording();
+
+    if (!recording) {
+        CaptureSettings settings = capture.getSettings();
+        char directory[256];
+        std::snprintf(directory, sizeof(directory), "%s", settings.directory.c_str());
+        bool changed = false;
+        if (ImGui::InputText("Carpeta", directory, sizeof(directory))) {
+            settings.directory = directory;
+            changed = true;
+        }
+        int threads = static_cast<int>(settings.encoderThreads);
+        if (ImGui::SliderInt("Hilos de codificacion", &threads, 1, 8)) {
+            settings.encoderThreads = static_cast<size_t>(threads);
+            changed = true;
+        }
+        int capacity = static_cast<int>(settings.queueCapacity);
+        if (ImGui::SliderInt("Tamano de la cola", &capacity, 1, 64)) {
+            settings.queueCapacity = static_cast<size_t>(capacity);
+            changed = true;
+        }
+        int delay = static_cast<int>(settings.readbackDelay);
+        if (ImGui::SliderInt("Retraso de lectura", &delay, 1, 4)) {
+            settings.readbackDelay = static_cast<size_t>(delay);
+            changed = true;
+        }
+        bool backpressure = settings.overflow == CaptureOverflow::Backpressure;
+        if (ImGui::Checkbox("Esperar en lugar de descartar", &backpressure)) {
+            settings.overflow = backpressure ? CaptureOverflow::Backpressure : CaptureOverflow::DropFrames;
+            changed = true;
+        }
+        if (changed) {
+            capture.setSettings(settings);
+        }
+    }
+
+    if (ImGui::Button(recording ? "Detener (F2)" : "Grabar (F2)")) {
+        m_captureToggle = true;
+    }
+
+    const CaptureStats stats = capture.getStats();
+    if (stats.captured > 0) {
+        ImGui::Separator();
+        ImGui::Text("Capturados: %llu  escritos: %llu  descartados: %llu  fallidos: %llu",
+                    static_cast<unsigned long long>(stats.captured), static_cast<unsigned long long>(stats.written),
+                    static_cast<unsigned long long>(stats.dropped), static_cast<unsigned long long>(stats.failed));
+        ImGui::Text("En cola: %zu / %zu", stats.queued, capture.getSettings().queueCapacity);
+        ImGui::Text("Lectura: %.2f ms  PNG: %.1f ms  espera total: %.1f ms",
+                    stats.readbackMs, stats.encodeMs, stats.backpressureMs);
+    }
+    ImGui::End();
+}
+
+bool GUI::consumeCaptureToggle() {
+    bool toggle = m_captureToggle;
+    m_captureToggle = false;
+    return toggle;
+}
+
 // ----------------------------------------------------
 // ** FUNCIONES AUXILIARES **
 // ----------------------------------------------------
 
 // Crea un nuevo actor con una forma específica y lo agrega a la lista de actores.
-void GUI::createActor(ShapeType shapeType, const std::string& name, float x, float y) {
+void GUI::createActor(std::vector<EngineUtilities::TSharedPointer<Actor>>& actors,
+                      ShapeType shapeType, const std::string& name, float x, float y) {
     auto actor = EngineUtilities::MakeShared<Actor>(name);
     if (!actor.isNull()) {
         actor->getComponent<ShapeFactory>()->createShape(shapeType);
@@ -179,7 +535,7 @@ void GUI::createActor(ShapeType shapeType, const std::string& name, float x, flo
 }
 
 // Control de valores 2D (posición, rotación, escala) con drag floats.
-void GUI::vec2Control(const std::string& label, float* values, float resetValue, float columnWidth) {
+bool GUI::vec2Control(const std::string& label, float* values, float resetValue, float columnWidth) {
     ImGui::PushID(label.c_str());
 
     ImGui::Columns(2);
@@ -216,5 +572,6 @@ void GUI::vec2Control(const std::string& label, float* values, float resetValue,
     }
 
     ImGui::PopID();
+    return hasValueChanged;
 }
 
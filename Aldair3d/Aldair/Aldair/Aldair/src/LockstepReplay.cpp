@@ -0,0 +1,75 @@
+#include "LockstepReplay.h"
+#include "Services/RandomService.h"
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <fstream>
+
+namespace {
+  // Agentes y semilla de la repetición de la prueba.
+  constexpr size_t kReplayAgents = 1024;
+  constexpr uint64_t kReplaySeed = 20240521u;
+
+  // Lee un hash hexadecimal por línea; false si el archivo no existe.
+  bool loadHashes(const std::string& path, std::vector<uint64_t>& hashes) {
+    std::ifstream file(path);
+    if (!file) {
+      return false;
+    }
+    hashes.clear();
+    std::string line;
+    while (std::getline(file, line)) {
+      if (!line.empty()) {
+        hashes.push_back(std::stoull(line, nullptr, 16));
+      }
+    }
+    return true;
+  }
+
+  bool saveHashes(const std::string& path, const std::vector<uint64_t>& hashes) {
+    std::FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) {
+      return false;
+    }
+    for (uint64_t hash : hashes) {
+      std::fprintf(file, "%016" PRIx64 "\n", hash);
+    }
+    return std::fclose(file) == 0;
+  }
+}
+
+int
+runReplayCheck(const std::string& path, unsigned int frames, bool fixedPoint) {
+  const char* scalar = fixedPoint ? "Fixed32" : "float";
+  RandomService& random = RandomService::getInstance();
+  random.setSeed(kReplaySeed);
+  const std::vector<uint64_t> hashes = fixedPoint
+    ? LockstepReplay<Fixed32>(kReplayAgents, random.createStream()).run(frames)
+    : LockstepReplay<float>(kReplayAgents, random.createStream()).run(frames);
+
+  std::vector<uint64_t> reference;
+  if (!loadHashes(path, reference)) {
+    if (!saveHashes(path, hashes)) {
+      std::printf("Replay (%s): no se pudo escribir %s\n", scalar, path.c_str());
+      return 1;
+    }
+    std::printf("Replay (%s): referencia de %u frames grabada en %s\n", scalar, frames, path.c_str());
+    return 0;
+  }
+
+  const size_t compared = std::min(reference.size(), hashes.size());
+  for (size_t frame = 0; frame < compared; ++frame) {
+    if (reference[frame] != hashes[frame]) {
+      std::printf("Replay (%s): diverge en el frame %zu (referencia %016" PRIx64 ", actual %016" PRIx64 ")\n",
+                  scalar, frame, reference[frame], hashes[frame]);
+      return 1;
+    }
+  }
+  if (reference.size() != hashes.size()) {
+    std::printf("Replay (%s): %zu frames iguales, pero la referencia tiene %zu frames y esta ejecucion %zu\n",
+                scalar, compared, reference.size(), hashes.size());
+    return 1;
+  }
+  std::printf("Replay (%s): %zu frames identicos a %s\n", scalar, compared, path.c_str());
+  return 0;
+}
@@ -0,0 +1,278 @@
+#include "SIMD.h"
+#include "MathBatchKernels.h"
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace {
+#if defined(ALDAIR_SIMD_SSE)
+  // Carriles de SSE2: cuatro floats por registro.
+  struct
+  SseLanes {
+    using Float = __m128;
+    static constexpr size_t kWidth = 4;
+
+    static Float load(const float* p) { return _mm_loadu_ps(p); }
+    static void store(float* p, Float v) { _mm_storeu_ps(p, v); }
+    static Float set1(float v) { return _mm_set1_ps(v); }
+    static Float add(Float a, Float b) { return _mm_add_ps(a, b); }
+    static Float sub(Float a, Float b) { return _mm_sub_ps(a, b); }
+    static Float mul(Float a, Float b) { return _mm_mul_ps(a, b); }
+    static Float div(Float a, Float b) { return _mm_div_ps(a, b); }
+    static Float fmadd(Float a, Float b, Float c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    static Float sqrt(Float a) { return _mm_sqrt_ps(a); }
+    static Float rsqrt(Float a) { return SIMD::rsqrt(a); }
+    static Float max(Float a, Float b) { return _mm_max_ps(a, b); }
+    static Float greater(Float a, Float b) { return _mm_cmpgt_ps(a, b); }
+    static Float lessEqual(Float a, Float b) { return _mm_cmple_ps(a, b); }
+    static unsigned int mask(Float a) { return static_cast<unsigned int>(_mm_movemask_ps(a)); }
+    static Float bitAnd(Float a, Float b) { return _mm_and_ps(a, b); }
+    static Float bitOr(Float a, Float b) { return _mm_or_ps(a, b); }
+    static Float bitXor(Float a, Float b) { return _mm_xor_ps(a, b); }
+    static Float select(Float mask, Float a, Float b) {
+      return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+
+    // Máscaras del cuadrante k: intercambio de sin y cos y signos de cada uno.
+    static void quadrantMasks(Float k, Float& swap, Float& sinSign, Float& cosSign) {
+      const __m128i quadrant = _mm_cvttps_epi32(k);
+      const __m128i one = _mm_set1_epi32(1);
+      const __m128i two = _mm_set1_epi32(2);
+      swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, one), one));
+      sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, two), 30));
+      cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, one), two), 30));
+    }
+  };
+#endif
+
+  KernelTable
+  makeScalarTable() {
+    KernelTable table;
+    table.seek = [](const SeekParams& p) { seekScalar(p, 0); };
+    table.translate = [](const TranslateParams& p) { translateScalar(p, 0); };
+    table.integrate = [](const IntegrateParams& p) { integrateScalar(p, 0); };
+    table.rotateScale = [](const RotateScaleParams& p) { rotateScaleScalar(p, 0); };
+    table.length = [](const LengthParams& p) { lengthScalar(p, 0); };
+    table.normalize = [](const NormalizeParams& p) { normalizeScalar(p, 0); };
+    table.overlapAABB = [](const OverlapAABBParams& p) { return overlapAABBScalar(p, 0); };
+    table.raycastCircles = [](const RaycastCirclesParams& p) { return raycastCirclesScalar(p, 0, kNoHit); };
+    table.pointsInPolygon = [](const PolygonParams& p) { return pointsInPolygonScalar(p, 0); };
+    return table;
+  }
+
+  const KernelTable&
+  getKernels(InstructionSet instructionSet) {
+    static const KernelTable scalar = makeScalarTable();
+#if defined(ALDAIR_SIMD_SSE)
+    static const KernelTable sse = makeKernelTable<SseLanes>();
+#endif
+    switch (instructionSet) {
+    case InstructionSet::AVX2:
+      if (const KernelTable* avx2 = getAvx2Kernels()) {
+        return *avx2;
+      }
+      // Sin kernels AVX2 se usa SSE2.
+      [[fallthrough]];
+#if defined(ALDAIR_SIMD_SSE)
+    case InstructionSet::SSE2:
+      return sse;
+#endif
+    default:
+      return scalar;
+    }
+  }
+
+  // Consulta CPUID: AVX2 y FMA, y que el sistema guarde los registros de 256 bits.
+  bool
+  detectAvx2() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+      return false;
+    }
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    const bool fma = (info[2] & (1 << 12)) != 0;
+    if (!osxsave || !avx || !fma || (_xgetbv(0) & 0x6) != 0x6) {
+      return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#else
+    return false;
+#endif
+  }
+
+  InstructionSet
+  detectInstructionSet() {
+    if (detectAvx2() && getAvx2Kernels()) {
+      return InstructionSet::AVX2;
+    }
+#if defined(ALDAIR_SIMD_SSE)
+    return InstructionSet::SSE2;
+#else
+    return InstructionSet::Scalar;
+#endif
+  }
+
+  // Conjunto activo; se decide en el primer uso.
+  std::atomic<const KernelTable*> g_kernels{ nullptr };
+  std::atomic<InstructionSet> g_instructionSet{ InstructionSet::Scalar };
+
+  const KernelTable&
+  kernels() {
+    const KernelTable* table = g_kernels.load(std::memory_order_acquire);
+    if (!table) {
+      g_instructionSet.store(getSupportedInstructionSet(), std::memory_order_relaxed);
+      table = &getKernels(g_instructionSet.load(std::memory_order_relaxed));
+      g_kernels.store(table, std::memory_order_release);
+    }
+    return *table;
+  }
+}
+
+namespace MathBatch {
+  void
+  seekBatch(Vector2Span positions, ConstVector2Span targets,
+            BatchScalars speeds, float deltaTime, float range) {
+    const SeekParams params = { positions.x, positions.y, targets.x, targets.y, 0.0f, 0.0f,
+                                speeds, deltaTime, range, std::min(positions.count, targets.count) };
+    kernels().seek(params);
+  }
+
+  void
+  seekBatch(Vector2Span positions, const Vector2& target,
+            BatchScalars speeds, float deltaTime, float range) {
+    const SeekParams params = { positions.x, positions.y, nullptr, nullptr, target.x, target.y,
+                                speeds, deltaTime, range, positions.count };
+    kernels().seek(params);
+  }
+
+  void
+  translateBatch(Vector2Span positions, ConstVector2Span offsets, float factor) {
+    const TranslateParams params = { positions.x, positions.y, offsets.x, offsets.y, 0.0f, 0.0f,
+                                     factor, std::min(positions.count, offsets.count) };
+    kernels().translate(params);
+  }
+
+  void
+  translateBatch(Vector2Span positions, const Vector2& offset) {
+    const TranslateParams params = { positions.x, positions.y, nullptr, nullptr, offset.x, offset.y,
+                                     1.0f, positions.count };
+    kernels().translate(params);
+  }
+
+  void
+  integrateBatch(Vector2Span positions, Vector2Span velocities, const Vector2& acceleration,
+                 float deltaTime, float* timers) {
+    const IntegrateParams params = { positions.x, positions.y, velocities.x, velocities.y, timers,
+                                     acceleration.x * deltaTime, acceleration.y * deltaTime, deltaTime,
+                                     std::min(positions.count, velocities.count) };
+    kernels().integrate(params);
+  }
+
+  void
+  rotateScaleBatch(Vector2Span points, BatchScalars angles,
+                   BatchScalars scaleX, BatchScalars scaleY) {
+    const RotateScaleParams params = { points.x, points.y, angles, scaleX, scaleY, points.count };
+    kernels().rotateScale(params);
+  }
+
+  void
+  lengthBatch(ConstVector2Span vectors, float* lengths) {
+    const LengthParams params = { vectors.x, vectors.y, lengths, vectors.count };
+    kernels().length(params);
+  }
+
+  void
+  normalizeBatch(Vector2Span vectors) {
+    const NormalizeParams params = { vectors.x, vectors.y, vectors.count };
+    kernels().normalize(params);
+  }
+
+  void
+  nlerpBatch(ConstQuaternionSpan from, ConstQuaternionSpan to, BatchScalars t, QuaternionSpan out) {
+    const size_t count = std::min({ from.count, to.count, out.count });
+    for (size_t i = 0; i < count; ++i) {
+      out.data[i] = Quaternion::nlerp(from.data[i], to.data[i], t.values ? t.values[i] : t.value);
+    }
+  }
+
+  void
+  slerpBatch(ConstQuaternionSpan from, ConstQuaternionSpan to, BatchScalars t, QuaternionSpan out) {
+    const size_t count = std::min({ from.count, to.count, out.count });
+    for (size_t i = 0; i < count; ++i) {
+      out.data[i] = Quaternion::slerp(from.data[i], to.data[i], t.values ? t.values[i] : t.value);
+    }
+  }
+
+  size_t
+  overlapAABBBatch(const AABB& box, ConstAABBSpan boxes, uint8_t* hits) {
+    const OverlapAABBParams params = { box, boxes, hits };
+    return kernels().overlapAABB(params);
+  }
+
+  size_t
+  raycastCirclesBatch(const Ray& ray, ConstCircleSpan circles, float* distances) {
+    const RaycastCirclesParams params = { ray, circles, distances };
+    return kernels().raycastCircles(params);
+  }
+
+  size_t
+  pointsInPolygonBatch(const Vector2* polygon, size_t vertexCount,
+                       ConstVector2Span points, uint8_t* inside) {
+    // Aristas (polygon[j], polygon[i]) en el mismo orden que Geometry::containsPoint.
+    std::vector<float> edges(4 * vertexCount);
+    float* edgeX = edges.data();
+    float* edgeY0 = edgeX + vertexCount;
+    float* edgeY1 = edgeY0 + vertexCount;
+    float* slope = edgeY1 + vertexCount;
+    for (size_t i = 0, j = vertexCount - 1; i < vertexCount; j = i++) {
+      edgeX[i] = polygon[j].x;
+      edgeY0[i] = polygon[j].y;
+      edgeY1[i] = polygon[i].y;
+      slope[i] = (polygon[i].x - polygon[j].x) / (polygon[i].y - polygon[j].y);
+    }
+    const PolygonParams params = { edgeX, edgeY0, edgeY1, slope, vertexCount, points, inside };
+    return kernels().pointsInPolygon(params);
+  }
+
+  InstructionSet
+  getSupportedInstructionSet() {
+    static const InstructionSet supported = detectInstructionSet();
+    return supported;
+  }
+
+  InstructionSet
+  getInstructionSet() {
+    kernels();
+    return g_instructionSet.load(std::memory_order_relaxed);
+  }
+
+  void
+  setInstructionSet(InstructionSet instructionSet) {
+    const InstructionSet supported = getSupportedInstructionSet();
+    if (static_cast<int>(instructionSet) > static_cast<int>(supported)) {
+      instructionSet = supported;
+    }
+    g_instructionSet.store(instructionSet, std::memory_order_relaxed);
+    g_kernels.store(&getKernels(instructionSet), std::memory_order_release);
+  }
+
+  const char*
+  getInstructionSetName(InstructionSet instructionSet) {
+    switch (instructionSet) {
+    case InstructionSet::AVX2: return "AVX2";
+    case InstructionSet::SSE2: return "SSE2";
+    default: return "Escalar";
+    }
+  }
+}
@@ -0,0 +1,69 @@
+// Kernels AVX2 de MathBatch. Solo se llaman después de confirmar con CPUID que el
+// procesador soporta AVX2 y FMA, así que esta unidad no necesita /arch:AVX2.
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define MATHBATCH_TARGET __attribute__((target("avx2,fma")))
+#endif
+#define MATHBATCH_HAS_AVX2
+#endif
+
+#include "MathBatchKernels.h"
+
+#if defined(MATHBATCH_HAS_AVX2)
+namespace {
+  // Carriles de AVX2: ocho floats por registro, con FMA.
+  struct
+  Avx2Lanes {
+    using Float = __m256;
+    static constexpr size_t kWidth = 8;
+
+    MATHBATCH_TARGET static Float load(const float* p) { return _mm256_loadu_ps(p); }
+    MATHBATCH_TARGET static void store(float* p, Float v) { _mm256_storeu_ps(p, v); }
+    MATHBATCH_TARGET static Float set1(float v) { return _mm256_set1_ps(v); }
+    MATHBATCH_TARGET static Float add(Float a, Float b) { return _mm256_add_ps(a, b); }
+    MATHBATCH_TARGET static Float sub(Float a, Float b) { return _mm256_sub_ps(a, b); }
+    MATHBATCH_TARGET static Float mul(Float a, Float b) { return _mm256_mul_ps(a, b); }
+    MATHBATCH_TARGET static Float div(Float a, Float b) { return _mm256_div_ps(a, b); }
+    MATHBATCH_TARGET static Float fmadd(Float a, Float b, Float c) { return _mm256_fmadd_ps(a, b, c); }
+    MATHBATCH_TARGET static Float sqrt(Float a) { return _mm256_sqrt_ps(a); }
+    MATHBATCH_TARGET static Float max(Float a, Float b) { return _mm256_max_ps(a, b); }
+    MATHBATCH_TARGET static Float greater(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    MATHBATCH_TARGET static Float lessEqual(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    MATHBATCH_TARGET static unsigned int mask(Float a) { return static_cast<unsigned int>(_mm256_movemask_ps(a)); }
+    MATHBATCH_TARGET static Float bitAnd(Float a, Float b) { return _mm256_and_ps(a, b); }
+    MATHBATCH_TARGET static Float bitOr(Float a, Float b) { return _mm256_or_ps(a, b); }
+    MATHBATCH_TARGET static Float bitXor(Float a, Float b) { return _mm256_xor_ps(a, b); }
+    MATHBATCH_TARGET static Float select(Float mask, Float a, Float b) { return _mm256_blendv_ps(b, a, mask); }
+
+    // Estimación de rsqrtps y un paso de Newton-Raphson.
+    MATHBATCH_TARGET static Float rsqrt(Float a) {
+      const Float estimate = _mm256_rsqrt_ps(a);
+      const Float halfA = _mm256_mul_ps(_mm256_set1_ps(0.5f), a);
+      return _mm256_mul_ps(estimate, _mm256_fnmadd_ps(halfA, _mm256_mul_ps(estimate, estimate),
+                                                      _mm256_set1_ps(1.5f)));
+    }
+
+    // Máscaras del cuadrante k: intercambio de sin y cos y signos de cada uno.
+    MATHBATCH_TARGET static void quadrantMasks(Float k, Float& swap, Float& sinSign, Float& cosSign) {
+      const __m256i quadrant = _mm256_cvttps_epi32(k);
+      const __m256i one = _mm256_set1_epi32(1);
+      const __m256i two = _mm256_set1_epi32(2);
+      swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(quadrant, one), one));
+      sinSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(quadrant, two), 30));
+      cosSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(quadrant, one), two), 30));
+    }
+  };
+}
+
+const MathBatch::detail::KernelTable*
+MathBatch::detail::getAvx2Kernels() {
+  static const KernelTable table = makeKernelTable<Avx2Lanes>();
+  return &table;
+}
+#else
+const MathBatch::detail::KernelTable*
+MathBatch::detail::getAvx2Kernels() {
+  return nullptr;
+}
+#endif
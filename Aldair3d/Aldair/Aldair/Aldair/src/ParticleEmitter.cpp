@@ -0,0 +1,156 @@
+#include "ParticleEmitter.h"
+#include "MathBatch.h"
+#include "Services/JobSystem.h"
+#include "Services/RandomService.h"
+
+namespace {
+  // Bloque mínimo por hilo; por debajo de esto el reparto cuesta más de lo que ahorra.
+  constexpr size_t kParallelBatch = 16384;
+}
+
+ParticleEmitter::ParticleEmitter(size_t capacity)
+  : Component(ComponentType::PARTICLES), m_capacity(capacity),
+    m_random(RandomService::getInstance().createStream()) {
+  m_positionX.resize(capacity);
+  m_positionY.resize(capacity);
+  m_velocityX.resize(capacity);
+  m_velocityY.resize(capacity);
+  m_life.resize(capacity);
+  m_invMaxLife.resize(capacity);
+  m_colors.resize(capacity);
+}
+
+// Emite las partículas que correspondan a la tasa y simula las vivas.
+void ParticleEmitter::update(float deltaTime) {
+  m_emissionAccumulator += m_emissionRate * deltaTime;
+  const size_t toEmit = static_cast<size_t>(m_emissionAccumulator);
+  m_emissionAccumulator -= static_cast<float>(toEmit);
+  emit(toEmit);
+
+  simulate(deltaTime, true);
+}
+
+void ParticleEmitter::simulate(float deltaTime, bool parallel) {
+  if (m_count == 0) {
+    return;
+  }
+
+  // Cada bloque llama a MathBatch, que elige en tiempo de ejecución los kernels AVX2,
+  // SSE2 o escalares.
+  const Vector2 acceleration(0.0f, m_gravity);
+  auto integrate = [&](size_t begin, size_t end) {
+    const size_t count = end - begin;
+    MathBatch::integrateBatch({ m_positionX.data() + begin, m_positionY.data() + begin, count },
+                              { m_velocityX.data() + begin, m_velocityY.data() + begin, count },
+                              acceleration, deltaTime, m_life.data() + begin);
+  };
+
+  if (parallel) {
+    JobSystem::getInstance().parallelFor(m_count, kParallelBatch,
+      [&](size_t begin, size_t end, size_t) { integrate(begin, end); });
+  }
+  else {
+    integrate(0, m_count);
+  }
+
+  compact();
+}
+
+void ParticleEmitter::simulateScalar(float deltaTime) {
+  const float gravityStep = m_gravity * deltaTime;
+  for (size_t i = 0; i < m_count; ++i) {
+    m_velocityY[i] += gravityStep;
+    m_positionX[i] += m_velocityX[i] * deltaTime;
+    m_positionY[i] += m_velocityY[i] * deltaTime;
+    m_life[i] -= deltaTime;
+  }
+  compact();
+}
+
+void ParticleEmitter::emit(size_t count) {
+  count = std::min(count, m_capacity - m_count);
+  if (count == 0) {
+    return;
+  }
+
+  // Direcciones, vidas y rapideces en bloque; la rapidez usa m_invMaxLife como espacio temporal.
+  const size_t first = m_count;
+  m_random.fillUnitVectors({ m_velocityX.data() + first, m_velocityY.data() + first, count });
+  m_random.fillRange(m_life.data() + first, count, m_minLifetime, m_maxLifetime);
+  m_random.fillRange(m_invMaxLife.data() + first, count, 0.2f * m_speed, m_speed);
+
+  for (size_t i = first; i < first + count; ++i) {
+    const float speed = m_invMaxLife[i];
+    m_positionX[i] = m_origin.x;
+    m_positionY[i] = m_origin.y;
+    m_velocityX[i] *= speed;
+    m_velocityY[i] *= speed;
+    m_invMaxLife[i] = 1.0f / m_life[i];
+    m_colors[i] = m_color;
+  }
+  m_count += count;
+}
+
+void ParticleEmitter::setLifetime(float minLife, float maxLife) {
+  m_minLifetime = std::max(0.01f, std::min(minLife, maxLife));
+  m_maxLifetime = std::max(m_minLifetime, maxLife);
+}
+
+/**
+ * @brief Compacta la reserva quitando las partículas muertas.
+ * La última partícula viva ocupa el hueco, así que el orden no se conserva pero no
+ * se mueve más de un elemento por cada partícula eliminada.
+ */
+void ParticleEmitter::compact() {
+  size_t i = 0;
+  while (i < m_count) {
+    if (m_life[i] > 0.0f) {
+      ++i;
+      continue;
+    }
+    const size_t last = --m_count;
+    m_positionX[i] = m_positionX[last];
+    m_positionY[i] = m_positionY[last];
+    m_velocityX[i] = m_velocityX[last];
+    m_velocityY[i] = m_velocityY[last];
+    m_life[i] = m_life[last];
+    m_invMaxLife[i] = m_invMaxLife[last];
+    m_colors[i] = m_colors[last];
+  }
+}
+
+/**
+ * @brief La generación de vértices se reparte entre hilos; cada partícula escribe sus
+ * cuatro vértices en una posición fija, así que no hay sincronización.
+ */
+void ParticleEmitter::appendVertices(std::vector<sf::Vertex>& out) const {
+  if (m_count == 0) {
+    return;
+  }
+
+  const size_t first = out.size();
+  out.resize(first + m_count * 4);
+  sf::Vertex* vertices = out.data() + first;
+  const float half = m_particleSize * 0.5f;
+
+  JobSystem::getInstance().parallelFor(m_count, kParallelBatch,
+    [&](size_t begin, size_t end, size_t) {
+      for (size_t i = begin; i < end; ++i) {
+        sf::Color color = m_colors[i];
+        const float fade = std::min(1.0f, m_life[i] * m_invMaxLife[i]);
+        color.a = static_cast<sf::Uint8>(color.a * fade);
+
+        const float x = m_positionX[i];
+        const float y = m_positionY[i];
+        sf::Vertex* quad = vertices + i * 4;
+        quad[0] = sf::Vertex(sf::Vector2f(x - half, y - half), color);
+        quad[1] = sf::Vertex(sf::Vector2f(x + half, y - half), color);
+        quad[2] = sf::Vertex(sf::Vector2f(x + half, y + half), color);
+        quad[3] = sf::Vertex(sf::Vector2f(x - half, y + half), color);
+      }
+    });
+}
+
+const char* ParticleEmitter::getKernelName() {
+  return MathBatch::getInstructionSetName(MathBatch::getInstructionSet());
+}
@@ -0,0 +1,206 @@
+#include "Random.h"
+#include "SIMD.h"
+#include <algorithm>
+
+namespace {
+  // Polinomios de salto de xoshiro256**: 2^128 y 2^192 pasos.
+  constexpr uint64_t kJump[4] = { 0x180ec6d33cfd0abaull, 0xd5a61266f0c9392cull,
+                                  0xa9582618e03fc9aaull, 0x39abdc4529b1661cull };
+  constexpr uint64_t kLongJump[4] = { 0x76e15d3efefdcbbfull, 0xc5004e441c522fb3ull,
+                                      0x77710069854ee241ull, 0x39109bb02acbe635ull };
+
+  constexpr uint64_t
+  rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+  // Un paso de xoshiro256** sobre un estado de 4 palabras.
+  uint64_t
+  step(uint64_t& s0, uint64_t& s1, uint64_t& s2, uint64_t& s3) {
+    const uint64_t result = rotl(s1 * 5, 7) * 9;
+    const uint64_t t = s1 << 17;
+    s2 ^= s0;
+    s3 ^= s1;
+    s1 ^= s2;
+    s0 ^= s3;
+    s2 ^= t;
+    s3 = rotl(s3, 45);
+    return result;
+  }
+
+  // splitmix64: expande una semilla de 64 bits en palabras de estado bien mezcladas.
+  uint64_t
+  splitMix64(uint64_t& x) {
+    uint64_t z = (x += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+  }
+
+#if defined(ALDAIR_SIMD_AVX2)
+  // Paso de xoshiro256** en cuatro flujos; *5 y *9 con corrimientos y sumas.
+  inline __m256i
+  stepLanes(__m256i& s0, __m256i& s1, __m256i& s2, __m256i& s3) {
+    const __m256i times5 = _mm256_add_epi64(_mm256_slli_epi64(s1, 2), s1);
+    const __m256i rotated = _mm256_or_si256(_mm256_slli_epi64(times5, 7), _mm256_srli_epi64(times5, 57));
+    const __m256i result = _mm256_add_epi64(_mm256_slli_epi64(rotated, 3), rotated);
+    const __m256i t = _mm256_slli_epi64(s1, 17);
+    s2 = _mm256_xor_si256(s2, s0);
+    s3 = _mm256_xor_si256(s3, s1);
+    s1 = _mm256_xor_si256(s1, s2);
+    s0 = _mm256_xor_si256(s0, s3);
+    s2 = _mm256_xor_si256(s2, t);
+    s3 = _mm256_or_si256(_mm256_slli_epi64(s3, 45), _mm256_srli_epi64(s3, 19));
+    return result;
+  }
+#elif defined(ALDAIR_SIMD_SSE)
+  // Paso de xoshiro256** en dos flujos; *5 y *9 con corrimientos y sumas.
+  inline __m128i
+  stepLanes(__m128i& s0, __m128i& s1, __m128i& s2, __m128i& s3) {
+    const __m128i times5 = _mm_add_epi64(_mm_slli_epi64(s1, 2), s1);
+    const __m128i rotated = _mm_or_si128(_mm_slli_epi64(times5, 7), _mm_srli_epi64(times5, 57));
+    const __m128i result = _mm_add_epi64(_mm_slli_epi64(rotated, 3), rotated);
+    const __m128i t = _mm_slli_epi64(s1, 17);
+    s2 = _mm_xor_si128(s2, s0);
+    s3 = _mm_xor_si128(s3, s1);
+    s1 = _mm_xor_si128(s1, s2);
+    s0 = _mm_xor_si128(s0, s3);
+    s2 = _mm_xor_si128(s2, t);
+    s3 = _mm_or_si128(_mm_slli_epi64(s3, 45), _mm_srli_epi64(s3, 19));
+    return result;
+  }
+#endif
+}
+
+Random::Random(uint64_t seed) {
+  for (uint64_t& word : m_state) {
+    word = splitMix64(seed);
+  }
+  resetLanes();
+}
+
+void
+Random::jump(uint64_t state[4], const uint64_t polynomial[4]) {
+  uint64_t result[4] = { 0, 0, 0, 0 };
+  for (int i = 0; i < 4; ++i) {
+    for (int bit = 0; bit < 64; ++bit) {
+      if (polynomial[i] & (uint64_t(1) << bit)) {
+        for (int w = 0; w < 4; ++w) {
+          result[w] ^= state[w];
+        }
+      }
+      step(state[0], state[1], state[2], state[3]);
+    }
+  }
+  std::copy(result, result + 4, state);
+}
+
+void
+Random::resetLanes() {
+  uint64_t state[4] = { m_state[0], m_state[1], m_state[2], m_state[3] };
+  for (size_t lane = 0; lane < kLanes; ++lane) {
+    jump(state, kJump);
+    for (int w = 0; w < 4; ++w) {
+      m_lanes[w][lane] = state[w];
+    }
+  }
+}
+
+Random
+Random::split() {
+  Random stream(*this);
+  jump(m_state, kLongJump);
+  resetLanes();
+  return stream;
+}
+
+void
+Random::fillBlocks(float* out, size_t blocks, float offset, float scale) {
+  size_t b = 0;
+#if defined(ALDAIR_SIMD_AVX2)
+  __m256i s0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(m_lanes[0]));
+  __m256i s1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(m_lanes[1]));
+  __m256i s2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(m_lanes[2]));
+  __m256i s3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(m_lanes[3]));
+  const __m256 unit = _mm256_set1_ps(kFloatUnit);
+  const __m256 offsets = _mm256_set1_ps(offset);
+  const __m256 scales = _mm256_set1_ps(scale);
+  for (; b < blocks; ++b) {
+    // Cada flujo da dos mitades de 32 bits; de cada una se toman los 24 bits altos.
+    const __m256i bits = _mm256_srli_epi32(stepLanes(s0, s1, s2, s3), 8);
+    const __m256 u = _mm256_mul_ps(_mm256_cvtepi32_ps(bits), unit);
+    _mm256_storeu_ps(out + b * kBlockSize, _mm256_add_ps(offsets, _mm256_mul_ps(scales, u)));
+  }
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(m_lanes[0]), s0);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(m_lanes[1]), s1);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(m_lanes[2]), s2);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(m_lanes[3]), s3);
+#elif defined(ALDAIR_SIMD_SSE)
+  // Flujos 0-1 en los registros a y 2-3 en los registros b.
+  __m128i a0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(m_lanes[0]));
+  __m128i a1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(m_lanes[1]));
+  __m128i a2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(m_lanes[2]));
+  __m128i a3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(m_lanes[3]));
+  __m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(m_lanes[0] + 2));
+  __m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(m_lanes[1] + 2));
+  __m128i b2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(m_lanes[2] + 2));
+  __m128i b3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(m_lanes[3] + 2));
+  const __m128 unit = _mm_set1_ps(kFloatUnit);
+  const __m128 offsets = _mm_set1_ps(offset);
+  const __m128 scales = _mm_set1_ps(scale);
+  for (; b < blocks; ++b) {
+    const __m128i bitsA = _mm_srli_epi32(stepLanes(a0, a1, a2, a3), 8);
+    const __m128i bitsB = _mm_srli_epi32(stepLanes(b0, b1, b2, b3), 8);
+    const __m128 uA = _mm_mul_ps(_mm_cvtepi32_ps(bitsA), unit);
+    const __m128 uB = _mm_mul_ps(_mm_cvtepi32_ps(bitsB), unit);
+    _mm_storeu_ps(out + b * kBlockSize, _mm_add_ps(offsets, _mm_mul_ps(scales, uA)));
+    _mm_storeu_ps(out + b * kBlockSize + 4, _mm_add_ps(offsets, _mm_mul_ps(scales, uB)));
+  }
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(m_lanes[0]), a0);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(m_lanes[1]), a1);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(m_lanes[2]), a2);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(m_lanes[3]), a3);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(m_lanes[0] + 2), b0);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(m_lanes[1] + 2), b1);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(m_lanes[2] + 2), b2);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(m_lanes[3] + 2), b3);
+#endif
+  for (; b < blocks; ++b) {
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+      const uint64_t bits = step(m_lanes[0][lane], m_lanes[1][lane], m_lanes[2][lane], m_lanes[3][lane]);
+      const float low = static_cast<float>(static_cast<uint32_t>(bits) >> 8) * kFloatUnit;
+      const float high = static_cast<float>(static_cast<uint32_t>(bits >> 32) >> 8) * kFloatUnit;
+      out[b * kBlockSize + 2 * lane] = offset + scale * low;
+      out[b * kBlockSize + 2 * lane + 1] = offset + scale * high;
+    }
+  }
+}
+
+void
+Random::fillUniform(float* out, size_t count) {
+  fillRange(out, count, 0.0f, 1.0f);
+}
+
+void
+Random::fillRange(float* out, size_t count, float min, float max) {
+  const size_t blocks = count / kBlockSize;
+  fillBlocks(out, blocks, min, max - min);
+  const size_t rest = count - blocks * kBlockSize;
+  if (rest > 0) {
+    float tail[kBlockSize];
+    fillBlocks(tail, 1, min, max - min);
+    std::copy(tail, tail + rest, out + blocks * kBlockSize);
+  }
+}
+
+void
+Random::fillUnitVectors(MathBatch::Vector2Span out) {
+  // Se convierte por tramos para que los ángulos quepan en la pila.
+  constexpr size_t kChunk = 256;
+  float angles[kChunk];
+  for (size_t i = 0; i < out.count; i += kChunk) {
+    const size_t n = std::min(kChunk, out.count - i);
+    fillRange(angles, n, -MathEngine::PI, MathEngine::PI);
+    std::fill(out.x + i, out.x + i + n, 1.0f);
+    std::fill(out.y + i, out.y + i + n, 0.0f);
+    MathBatch::rotateScaleBatch({ out.x + i, out.y + i, n }, angles, 1.0f, 1.0f);
+  }
+}
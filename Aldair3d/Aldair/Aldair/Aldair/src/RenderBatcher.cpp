@@ -0,0 +1,83 @@
+#include "RenderBatcher.h"
+#include "Window.h"
+#include "Services/JobSystem.h"
+
+// Número mínimo de comandos por bloque; en escenas pequeñas no vale la pena repartir.
+static constexpr size_t kMinCommandsPerChunk = 512;
+
+void RenderBatcher::build(const RenderQueue& queue,
+                          const std::vector<RenderProxy>& items) {
+  sf::Clock clock;
+  JobSystem& jobs = JobSystem::getInstance();
+
+  m_chunks.resize(jobs.getThreadCount());
+  for (Chunk& chunk : m_chunks) {
+    chunk.vertices.clear();
+    chunk.batches.clear();
+  }
+
+  const std::vector<RenderCommand>& commands = queue.getCommands();
+  jobs.parallelFor(commands.size(), kMinCommandsPerChunk,
+    [&](size_t begin, size_t end, size_t slot) {
+      buildRange(queue, items, begin, end, m_chunks[slot]);
+    });
+
+  m_stats = RenderStats();
+  m_stats.commands = commands.size();
+  size_t activeChunks = 0;
+  for (const Chunk& chunk : m_chunks) {
+    m_stats.drawCalls += chunk.batches.size();
+    m_stats.vertices += chunk.vertices.size();
+    activeChunks += chunk.batches.empty() ? 0 : 1;
+  }
+  m_stats.threads = std::max<size_t>(activeChunks, 1);
+  m_stats.stateChanges = m_stats.drawCalls;
+  m_stats.stateChangesSaved = queue.getUnsortedStateChanges() > m_stats.drawCalls
+                            ? queue.getUnsortedStateChanges() - m_stats.drawCalls : 0;
+  m_stats.buildMs = clock.getElapsedTime().asSeconds() * 1000.0f;
+}
+
+void RenderBatcher::buildRange(const RenderQueue& queue,
+                               const std::vector<RenderProxy>& items,
+                               size_t begin,
+                               size_t end,
+                               Chunk& chunk) const {
+  const std::vector<RenderCommand>& commands = queue.getCommands();
+  uint32_t currentState = 0xFFFFFFFF;
+
+  for (size_t i = begin; i < end; ++i) {
+    const RenderCommand& command = commands[i];
+    const RenderProxy& shape = items[command.index];
+    if (!shape.prototype) {
+      continue;
+    }
+
+    // Un estado distinto al del lote actual abre un lote nuevo.
+    const uint32_t state = RenderQueue::stateFromKey(command.key);
+    if (state != currentState) {
+      Batch batch;
+      batch.texture = queue.getTexture(RenderQueue::textureIdFromKey(command.key));
+      batch.blendMode = queue.getBlendMode(RenderQueue::blendIdFromKey(command.key));
+      batch.firstVertex = chunk.vertices.size();
+      chunk.batches.push_back(batch);
+      currentState = state;
+    }
+
+    shape.appendVertices(chunk.vertices);
+    chunk.batches.back().vertexCount = chunk.vertices.size() - chunk.batches.back().firstVertex;
+  }
+}
+
+// Los chunks se recorren en orden de ranura, que conserva el orden de la cola.
+void RenderBatcher::submit(Window& window) {
+  sf::Clock clock;
+  for (const Chunk& chunk : m_chunks) {
+    for (const Batch& batch : chunk.batches) {
+      sf::RenderStates states;
+      states.texture = batch.texture;
+      states.blendMode = batch.blendMode;
+      window.draw(chunk.vertices.data() + batch.firstVertex, batch.vertexCount, sf::Triangles, states);
+    }
+  }
+  m_stats.submitMs = clock.getElapsedTime().asSeconds() * 1000.0f;
+}
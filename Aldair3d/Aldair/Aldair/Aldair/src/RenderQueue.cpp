@@ -0,0 +1,122 @@
+#include "RenderQueue.h"
+
+void RenderQueue::clear() {
+  m_commands.clear();
+  m_textureIds.clear();
+  m_textures.clear();
+  m_blendModes = getBuiltinBlendModes();
+  m_unsortedStateChanges = 0;
+  m_lastState = 0xFFFFFFFF;
+}
+
+void RenderQueue::push(uint8_t layer,
+                       int16_t depth,
+                       const sf::Texture* texture,
+                       const sf::BlendMode& blendMode,
+                       uint32_t index) {
+  // El sesgo convierte la profundidad con signo en un valor que ordena como sin signo.
+  const uint64_t biasedDepth = static_cast<uint16_t>(static_cast<int32_t>(depth) + 32768);
+
+  RenderCommand command;
+  command.key = (static_cast<uint64_t>(layer) << kLayerShift) |
+                (biasedDepth << kDepthShift) |
+                (static_cast<uint64_t>(getTextureId(texture)) << kTextureShift) |
+                (static_cast<uint64_t>(getBlendId(blendMode)) << kBlendShift);
+  command.index = index;
+
+  const uint32_t state = stateFromKey(command.key);
+  if (state != m_lastState) {
+    ++m_unsortedStateChanges;
+    m_lastState = state;
+  }
+
+  m_commands.push_back(command);
+}
+
+/**
+ * @brief Radix sort LSD de 8 bits por pasada.
+ * Las pasadas en las que todos los comandos comparten el mismo byte se omiten,
+ * lo que es común en las capas y profundidades (casi siempre pocas distintas).
+ */
+void RenderQueue::sort() {
+  const size_t count = m_commands.size();
+  if (count < 2) {
+    return;
+  }
+
+  m_scratch.resize(count);
+  RenderCommand* source = m_commands.data();
+  RenderCommand* destination = m_scratch.data();
+
+  for (int shift = 0; shift < 64; shift += 8) {
+    size_t histogram[256] = {};
+    for (size_t i = 0; i < count; ++i) {
+      ++histogram[(source[i].key >> shift) & 0xFF];
+    }
+
+    // Todos caen en el mismo bucket: la pasada no cambiaría nada.
+    if (histogram[(source[0].key >> shift) & 0xFF] == count) {
+      continue;
+    }
+
+    size_t offset = 0;
+    for (size_t& bucket : histogram) {
+      size_t bucketCount = bucket;
+      bucket = offset;
+      offset += bucketCount;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+      destination[histogram[(source[i].key >> shift) & 0xFF]++] = source[i];
+    }
+    std::swap(source, destination);
+  }
+
+  if (source != m_commands.data()) {
+    std::copy(source, source + count, m_commands.data());
+  }
+}
+
+const sf::Texture* RenderQueue::getTexture(uint16_t textureId) const {
+  return textureId < m_textures.size() ? m_textures[textureId] : nullptr;
+}
+
+const sf::BlendMode& RenderQueue::getBlendMode(uint8_t blendId) const {
+  return blendId < m_blendModes.size() ? m_blendModes[blendId] : m_blendModes[0];
+}
+
+uint16_t RenderQueue::getTextureId(const sf::Texture* texture) {
+  if (!texture) {
+    return 0;
+  }
+  auto it = m_textureIds.find(texture);
+  if (it != m_textureIds.end()) {
+    return it->second;
+  }
+
+  if (m_textures.empty()) {
+    m_textures.push_back(nullptr); // Id 0 reservado para "sin textura".
+  }
+  // Un id más se saldría de los 16 bits y se confundiría con "sin textura".
+  if (m_textures.size() >= kMaxTextureIds) {
+    ERROR("RenderQueue", "getTextureId", "CHECK MORE THAN 65535 TEXTURES IN ONE FRAME");
+  }
+  uint16_t id = static_cast<uint16_t>(m_textures.size());
+  m_textures.push_back(texture);
+  m_textureIds[texture] = id;
+  return id;
+}
+
+uint8_t RenderQueue::getBlendId(const sf::BlendMode& blendMode) {
+  for (size_t id = 0; id < m_blendModes.size(); ++id) {
+    if (m_blendModes[id] == blendMode) {
+      return static_cast<uint8_t>(id);
+    }
+  }
+
+  if (m_blendModes.size() >= kMaxBlendIds) {
+    ERROR("RenderQueue", "getBlendId", "CHECK MORE THAN 16 BLEND MODES IN ONE FRAME");
+  }
+  m_blendModes.push_back(blendMode);
+  return static_cast<uint8_t>(m_blendModes.size() - 1);
+}
@@ -0,0 +1,76 @@
+#include "RenderTargetPool.h"
+
+RenderTargetPool::RenderTargetPool(unsigned int step)
+  : m_step(step > 0 ? step : 1) {
+}
+
+sf::RenderTexture* RenderTargetPool::acquire(unsigned int width, unsigned int height,
+                                             const RenderTargetFormat& format) {
+  if (width == 0 || height == 0) {
+    return nullptr;
+  }
+
+  const unsigned int bucketWidth = bucketSize(width);
+  const unsigned int bucketHeight = bucketSize(height);
+
+  // El destino libre más pequeño que contenga el tamaño pedido.
+  Entry* best = nullptr;
+  unsigned long long bestArea = 0;
+  for (Entry& entry : m_entries) {
+    if (entry.inUse || !(entry.format == format)) {
+      continue;
+    }
+    const sf::Vector2u size = entry.target->getSize();
+    if (size.x < bucketWidth || size.y < bucketHeight ||
+        size.x > bucketWidth * 2 || size.y > bucketHeight * 2) {
+      continue;
+    }
+    const unsigned long long area = static_cast<unsigned long long>(size.x) * size.y;
+    if (!best || area < bestArea) {
+      best = &entry;
+      bestArea = area;
+    }
+  }
+
+  if (best) {
+    best->inUse = true;
+    return best->target.get();
+  }
+
+  Entry entry;
+  entry.target = std::make_unique<sf::RenderTexture>();
+  entry.format = format;
+  entry.inUse = true;
+
+  sf::ContextSettings settings;
+  settings.depthBits = format.depthBits;
+  settings.antialiasingLevel = format.antialiasing;
+  settings.sRgbCapable = format.sRgb;
+  if (!entry.target->create(bucketWidth, bucketHeight, settings)) {
+    ERROR("RenderTargetPool", "acquire", "CHECK RENDERTEXTURE CREATION");
+    return nullptr;
+  }
+
+  ++m_allocations;
+  m_entries.push_back(std::move(entry));
+  return m_entries.back().target.get();
+}
+
+void RenderTargetPool::release(sf::RenderTexture* target) {
+  for (Entry& entry : m_entries) {
+    if (entry.target.get() == target) {
+      entry.inUse = false;
+      return;
+    }
+  }
+}
+
+void RenderTargetPool::trim() {
+  m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(),
+                                 [](const Entry& entry) { return !entry.inUse; }),
+                  m_entries.end());
+}
+
+unsigned int RenderTargetPool::bucketSize(unsigned int size) const {
+  return ((size + m_step - 1) / m_step) * m_step;
+}
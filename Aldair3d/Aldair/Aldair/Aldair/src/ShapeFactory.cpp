@@ -1,27 +1,25 @@
 ﻿#include "ShapeFactory.h"
 
 /**
- * @brief Crea una figura según el tipo especificado.
+ * @brief Asigna a la figura la geometría del tipo especificado.
+ * La geometría no se crea por instancia: se toma de la caché de prototipos, así que
+ * todas las figuras del mismo tipo comparten sus puntos y su triangulación.
  *
  * @param shapeType El tipo de figura a crear:
  * - CIRCLE: Crea un círculo.
  * - RECTANGLE: Crea un rectángulo.
  * - TRIANGLE: Crea un triángulo (utilizando un círculo con 3 lados).
  *
- * @return Un puntero a la figura creada o nullptr si el tipo no es válido.
+ * @return El prototipo asignado o nullptr si el tipo no es válido.
  */
-sf::Shape* ShapeFactory::createShape(ShapeType shapeType) {
+const ShapePrototype* ShapeFactory::createShape(ShapeType shapeType) {
     m_ShapeType = shapeType;
+    m_prototype = nullptr;
+    m_lodLevel = ShapePrototypeCache::kDefaultCircleLevel;
 
-    // Eliminar la figura actual si existe antes de crear una nueva.
-    if (m_shape) {
-        delete m_shape;
-    }
+    markTransformChanged();
 
     switch (shapeType) {
-    case NONE:
-        return nullptr;
-
     case CIRCLE:
         return createCircle();
 
@@ -36,59 +34,244 @@ sf::Shape* ShapeFactory::createShape(ShapeType shapeType) {
     }
 }
 
-// Crea un círculo de radio 10.
-sf::Shape* ShapeFactory::createCircle() {
-    sf::CircleShape* circle = new sf::CircleShape(10.0f);
-    m_shape = circle;
-    return circle;
+// Asigna el prototipo de un círculo de radio 10 con el nivel de detalle actual.
+const ShapePrototype* ShapeFactory::createCircle() {
+    m_prototype = ShapePrototypeCache::getInstance().getCircleLevel(ShapeType::CIRCLE, kCircleRadius, m_lodLevel);
+    return m_prototype;
 }
 
-// Crea un rectángulo de tamaño 100x50.
-sf::Shape* ShapeFactory::createRectangle() {
-    sf::RectangleShape* rectangle = new sf::RectangleShape(sf::Vector2f(100.0f, 50.0f));
-    m_shape = rectangle;
-    return rectangle;
+// Asigna el prototipo de un rectángulo de tamaño 100x50.
+const ShapePrototype* ShapeFactory::createRectangle() {
+    m_prototype = ShapePrototypeCache::getInstance().getRectangle(sf::Vector2f(100.0f, 50.0f));
+    return m_prototype;
 }
 
-// Crea un triángulo utilizando un círculo con 3 lados y radio 50.
-sf::Shape* ShapeFactory::createTriangle() {
-    sf::CircleShape* triangle = new sf::CircleShape(50.0f, 3);  // 3 lados
-    m_shape = triangle;
-    return triangle;
+// Asigna el prototipo de un triángulo: un círculo con 3 lados y radio 50.
+const ShapePrototype* ShapeFactory::createTriangle() {
+    m_prototype = ShapePrototypeCache::getInstance().getCircle(ShapeType::TRIANGLE, kTriangleRadius, 3);
+    return m_prototype;
 }
 
 // Define la posición de la figura en coordenadas (x, y).
 void ShapeFactory::setPosition(float x, float y) {
-    if (m_shape) {
-        m_shape->setPosition(x, y);
+    if (m_position.x != x || m_position.y != y) {
+        m_position = Vector2(x, y);
+        composeMatrix();
     }
 }
 
 // Define la posición de la figura usando un vector del tipo Vector2.
 void ShapeFactory::setPosition(const Vector2& position) {
-    if (m_shape) {
-        m_shape->setPosition(position.x, position.y);
-    }
+    setPosition(position.x, position.y);
 }
 
 // Establece la rotación de la figura en grados.
 void ShapeFactory::setRotation(float angle) {
-    if (m_shape) {
-        m_shape->setRotation(angle);
+    // SFML guarda el ángulo normalizado a [0, 360).
+    float normalized = std::fmod(angle, 360.0f);
+    if (normalized < 0.0f) {
+        normalized += 360.0f;
+    }
+    if (m_rotation != normalized) {
+        m_rotation = normalized;
+        MathEngine::sincos(normalized * (MathEngine::PI / 180.0f), m_sine, m_cosine);
+        composeMatrix();
     }
 }
 
 // Establece la escala de la figura usando un vector del tipo Vector2.
 void ShapeFactory::setScale(const Vector2& scl) {
-    if (m_shape) {
-        m_shape->setScale(scl.x, scl.y);
+    if (m_scale.x != scl.x || m_scale.y != scl.y) {
+        m_scale = scl;
+        composeMatrix();
+    }
+}
+
+// Reemplaza la matriz completa; no hace nada si no cambió.
+void ShapeFactory::setMatrix(const Matrix3x3& matrix) {
+    if (m_matrix != matrix) {
+        m_matrix = matrix;
+        markTransformChanged();
+    }
+}
+
+// Vuelve a componer la matriz sin recalcular el seno y el coseno.
+void ShapeFactory::composeMatrix() {
+    m_matrix = Matrix3x3::fromTRS(m_position, m_sine, m_cosine, m_scale);
+    markTransformChanged();
+}
+
+// Obtiene el AABB en coordenadas de mundo, recalculándolo solo si la forma cambió.
+const sf::FloatRect& ShapeFactory::getGlobalBounds() const {
+    getBounds();
+    return m_globalBounds;
+}
+
+// Obtiene el AABB en caché; se calcula transformando los límites locales con la matriz.
+const AABB& ShapeFactory::getBounds() const {
+    if (m_boundsDirty) {
+        m_bounds = AABB();
+        m_globalBounds = sf::FloatRect();
+        if (m_prototype) {
+            m_bounds = getLocalBounds().transform(m_matrix);
+            const Vector2 size = m_bounds.max - m_bounds.min;
+            m_globalBounds = sf::FloatRect(m_bounds.min.x, m_bounds.min.y, size.x, size.y);
+        }
+        m_boundsDirty = false;
     }
+    return m_bounds;
+}
+
+// Límites locales del prototipo.
+AABB ShapeFactory::getLocalBounds() const {
+    if (!m_prototype) {
+        return AABB();
+    }
+    const sf::FloatRect& local = m_prototype->localBounds;
+    return AABB(Vector2(local.left, local.top), Vector2(local.left + local.width, local.top + local.height));
+}
+
+// Caja orientada: los límites locales con la rotación y escala de la matriz.
+OBB ShapeFactory::getOrientedBounds() const {
+    if (!m_prototype) {
+        return OBB();
+    }
+    return OBB::fromMatrix(m_matrix, getLocalBounds());
+}
+
+// Círculo que contiene la forma en coordenadas de mundo.
+Circle ShapeFactory::getBoundingCircle() const {
+    if (!m_prototype) {
+        return Circle();
+    }
+    if (m_ShapeType == CIRCLE || m_ShapeType == TRIANGLE) {
+        // Los prototipos de círculo tienen su centro en (radio, radio).
+        const float radius = m_ShapeType == CIRCLE ? kCircleRadius : kTriangleRadius;
+        const float scaleX = Vector2(m_matrix.m[0][0], m_matrix.m[1][0]).magnitude();
+        const float scaleY = Vector2(m_matrix.m[0][1], m_matrix.m[1][1]).magnitude();
+        return Circle(m_matrix.transformPoint(Vector2(radius, radius)), radius * std::max(scaleX, scaleY));
+    }
+    const OBB box = getOrientedBounds();
+    return Circle(box.center, box.halfExtents.magnitude());
+}
+
+// Indica si el AABB cambió desde la última consulta y limpia el aviso.
+bool ShapeFactory::consumeBoundsChange() {
+    bool changed = m_boundsChanged;
+    m_boundsChanged = false;
+    return changed;
+}
+
+// Indica si la apariencia cambió desde la última consulta y limpia el aviso.
+bool ShapeFactory::consumeVisualChange() {
+    bool changed = m_visualChanged;
+    m_visualChanged = false;
+    return changed;
+}
+
+// Invalida el AABB en caché después de modificar la forma o su transformación.
+void ShapeFactory::markTransformChanged() {
+    m_boundsDirty = true;
+    m_boundsChanged = true;
+    m_visualChanged = true;
 }
 
 // Cambia el color de relleno de la figura.
 void ShapeFactory::setFillColor(const sf::Color& color) {
-    if (m_shape) {
-        m_shape->setFillColor(color);
+    if (m_fillColor != color) {
+        m_fillColor = color;
+        m_visualChanged = true;
+    }
+}
+
+// Cambia el modo de mezcla con el que se dibuja la figura.
+void ShapeFactory::setBlendMode(const sf::BlendMode& blendMode) {
+    if (m_blendMode != blendMode) {
+        m_blendMode = blendMode;
+        m_visualChanged = true;
+    }
+}
+
+// Asigna una textura completa a la figura y olvida cualquier región del atlas.
+void ShapeFactory::setTexture(const sf::Texture* texture) {
+    m_atlas = nullptr;
+    m_atlasKey.clear();
+    m_texture = texture;
+    m_textureRect = texture ? sf::IntRect(0, 0, texture->getSize().x, texture->getSize().y)
+                            : sf::IntRect();
+    m_visualChanged = true;
+}
+
+// Asigna la página del atlas que contiene la textura y recorta su región.
+bool ShapeFactory::setAtlasTexture(const TextureAtlas& atlas, const std::string& name) {
+    AtlasRegion region = atlas.getRegion(name);
+    if (!region.isValid()) {
+        return false;
+    }
+
+    m_atlas = &atlas;
+    m_atlasKey = name;
+    m_atlasVersion = atlas.getVersion();
+    m_texture = atlas.getPageTexture(region.page);
+    m_textureRect = region.rect;
+    m_visualChanged = true;
+    return true;
+}
+
+// Remapea el rectángulo de textura cuando el atlas movió sus regiones.
+bool ShapeFactory::refreshAtlasRegion() {
+    if (!m_atlas || m_atlas->getVersion() == m_atlasVersion) {
+        return false;
     }
+    if (!setAtlasTexture(*m_atlas, m_atlasKey)) {
+        // La textura ya no está en el atlas.
+        setTexture(nullptr);
+    }
+    return true;
+}
+
+// Transforma la triangulación del prototipo a espacio de mundo.
+void ShapeFactory::appendVertices(std::vector<sf::Vertex>& vertices) const {
+    if (m_prototype) {
+        m_prototype->appendVertices(m_matrix, m_fillColor, m_textureRect, vertices);
+    }
+}
+
+/**
+ * @brief Elige el nivel de detalle del círculo según su radio proyectado.
+ * El triángulo es un polígono regular exacto de 3 lados y el rectángulo no tiene
+ * curvas, así que solo los círculos cambian de nivel.
+ */
+bool ShapeFactory::updateLevelOfDetail(float pixelsPerUnit) {
+    if (m_ShapeType != ShapeType::CIRCLE || !m_prototype) {
+        return false;
+    }
+
+    // La escala se toma de la longitud de las columnas de la matriz, que también es
+    // válida cuando la transformación llegó compuesta con setMatrix.
+    const float scaleX = std::sqrt(m_matrix.m[0][0] * m_matrix.m[0][0] + m_matrix.m[1][0] * m_matrix.m[1][0]);
+    const float scaleY = std::sqrt(m_matrix.m[0][1] * m_matrix.m[0][1] + m_matrix.m[1][1] * m_matrix.m[1][1]);
+    const float projectedRadius = kCircleRadius * std::max(scaleX, scaleY) * pixelsPerUnit;
+    ShapePrototypeCache& cache = ShapePrototypeCache::getInstance();
+    const unsigned int level = cache.selectCircleLevel(projectedRadius, m_lodLevel);
+    if (level == m_lodLevel) {
+        return false;
+    }
+
+    m_lodLevel = level;
+    createCircle();
+    markTransformChanged();
+    return true;
 }
 
+// Dibuja la figura en la ventana con su textura.
+void ShapeFactory::draw(Window& window) const {
+    // Memoria reutilizada entre llamadas; el dibujo ocurre solo en el hilo principal.
+    static std::vector<sf::Vertex> vertices;
+    vertices.clear();
+    appendVertices(vertices);
+
+    sf::RenderStates states(m_blendMode);
+    states.texture = m_texture;
+    window.draw(vertices.data(), vertices.size(), sf::Triangles, states);
+}
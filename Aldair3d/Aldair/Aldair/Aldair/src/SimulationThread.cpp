@@ -0,0 +1,54 @@
+#include "SimulationThread.h"
+
+void SimulationThread::start(StepFunction step, float rateHz) {
+  stop();
+  m_step = std::move(step);
+  m_period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+    std::chrono::duration<float>(1.0f / std::max(rateHz, 1.0f)));
+  m_stepMs = 0.0f;
+  m_rateHz = 0.0f;
+  m_running = true;
+  m_thread = std::thread([this]() { loop(); });
+}
+
+void SimulationThread::stop() {
+  m_running = false;
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+}
+
+void SimulationThread::loop() {
+  using Clock = std::chrono::steady_clock;
+  Clock::time_point previous = Clock::now();
+  Clock::time_point next = previous;
+
+  while (m_running) {
+    const Clock::time_point begin = Clock::now();
+    const float elapsed = std::chrono::duration<float>(begin - previous).count();
+    previous = begin;
+
+    m_step(std::min(elapsed, kMaxStepSeconds));
+
+    const float stepMs = std::chrono::duration<float, std::milli>(Clock::now() - begin).count();
+    const float averageMs = m_stepMs.load(std::memory_order_relaxed);
+    m_stepMs.store(averageMs > 0.0f ? averageMs + 0.05f * (stepMs - averageMs) : stepMs,
+                   std::memory_order_relaxed);
+    if (elapsed > 0.0f) {
+      const float averageHz = m_rateHz.load(std::memory_order_relaxed);
+      const float rate = 1.0f / elapsed;
+      m_rateHz.store(averageHz > 0.0f ? averageHz + 0.05f * (rate - averageHz) : rate,
+                     std::memory_order_relaxed);
+    }
+
+    // Un paso atrasado no se recupera: el siguiente tick se cuenta desde ahora.
+    next += m_period;
+    const Clock::time_point now = Clock::now();
+    if (next > now) {
+      std::this_thread::sleep_until(next);
+    }
+    else {
+      next = now;
+    }
+  }
+}
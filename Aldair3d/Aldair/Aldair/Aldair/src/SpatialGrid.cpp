@@ -0,0 +1,178 @@
+#include "SpatialGrid.h"
+
+namespace {
+  bool
+  isFinite(const sf::FloatRect& rect) {
+    return std::isfinite(rect.left) && std::isfinite(rect.top) &&
+           std::isfinite(rect.width) && std::isfinite(rect.height);
+  }
+}
+
+void SpatialGrid::update(uint32_t id, const sf::FloatRect& bounds) {
+  if (!isFinite(bounds)) {
+    remove(id);
+    return;
+  }
+  if (id >= m_entries.size()) {
+    m_entries.resize(id + 1);
+  }
+
+  Entry& entry = m_entries[id];
+  CellRange range = computeRange(bounds);
+
+  if (!entry.active) {
+    entry.active = true;
+    ++m_count;
+    insertCells(id, range);
+  }
+  else if (!(entry.cells == range)) {
+    // Solo se tocan las celdas cuando el elemento cruza a otras.
+    removeCells(id, entry.cells);
+    insertCells(id, range);
+  }
+
+  entry.bounds = bounds;
+  entry.cells = range;
+}
+
+void SpatialGrid::remove(uint32_t id) {
+  if (!contains(id)) {
+    return;
+  }
+  Entry& entry = m_entries[id];
+  removeCells(id, entry.cells);
+  entry.active = false;
+  --m_count;
+}
+
+void SpatialGrid::clear() {
+  m_entries.clear();
+  m_cells.clear();
+  m_oversized.clear();
+  m_count = 0;
+}
+
+/**
+ * @brief Recorre las celdas del área y prueba el AABB exacto de cada candidato.
+ * Un elemento que toca varias celdas se reporta una sola vez gracias a la marca
+ * de consulta por id. Si el área cubre más celdas que las ocupadas, recorre las
+ * ocupadas en lugar de buscar cada celda del área.
+ */
+void SpatialGrid::query(const sf::FloatRect& area, std::vector<uint32_t>& result) const {
+  result.clear();
+  if (m_count == 0 || !isFinite(area)) {
+    return;
+  }
+
+  if (m_queryMarks.size() < m_entries.size()) {
+    m_queryMarks.resize(m_entries.size(), 0);
+  }
+  if (++m_queryStamp == 0) {
+    // El contador dio la vuelta; se reinician las marcas.
+    std::fill(m_queryMarks.begin(), m_queryMarks.end(), 0);
+    m_queryStamp = 1;
+  }
+
+  for (uint32_t id : m_oversized) {
+    testCandidate(id, area, result);
+  }
+
+  CellRange range = computeRange(area);
+  if (range.getCellCount() > static_cast<int64_t>(m_cells.size())) {
+    for (const auto& cell : m_cells) {
+      for (uint32_t id : cell.second) {
+        testCandidate(id, area, result);
+      }
+    }
+  }
+  else {
+    for (int y = range.minY; y <= range.maxY; ++y) {
+      for (int x = range.minX; x <= range.maxX; ++x) {
+        auto cell = m_cells.find(cellKey(x, y));
+        if (cell == m_cells.end()) {
+          continue;
+        }
+        for (uint32_t id : cell->second) {
+          testCandidate(id, area, result);
+        }
+      }
+    }
+  }
+
+  std::sort(result.begin(), result.end());
+}
+
+void SpatialGrid::testCandidate(uint32_t id, const sf::FloatRect& area, std::vector<uint32_t>& result) const {
+  if (m_queryMarks[id] == m_queryStamp) {
+    return;
+  }
+  m_queryMarks[id] = m_queryStamp;
+  if (m_entries[id].bounds.intersects(area)) {
+    result.push_back(id);
+  }
+}
+
+bool SpatialGrid::contains(uint32_t id) const {
+  return id < m_entries.size() && m_entries[id].active;
+}
+
+SpatialGrid::CellRange SpatialGrid::computeRange(const sf::FloatRect& bounds) const {
+  CellRange range;
+  range.minX = toCell(bounds.left);
+  range.minY = toCell(bounds.top);
+  range.maxX = toCell(bounds.left + bounds.width);
+  range.maxY = toCell(bounds.top + bounds.height);
+  return range;
+}
+
+// Se limita antes de convertir: convertir a int un valor fuera de rango es indefinido.
+int SpatialGrid::toCell(float coordinate) const {
+  const double cell = std::floor(static_cast<double>(coordinate) / m_cellSize);
+  if (!(cell > -kMaxCell)) {
+    return -kMaxCell;
+  }
+  if (!(cell < kMaxCell)) {
+    return kMaxCell;
+  }
+  return static_cast<int>(cell);
+}
+
+void SpatialGrid::insertCells(uint32_t id, const CellRange& range) {
+  if (range.getCellCount() > kMaxEntryCells) {
+    m_oversized.push_back(id);
+    return;
+  }
+  for (int y = range.minY; y <= range.maxY; ++y) {
+    for (int x = range.minX; x <= range.maxX; ++x) {
+      m_cells[cellKey(x, y)].push_back(id);
+    }
+  }
+}
+
+void SpatialGrid::removeCells(uint32_t id, const CellRange& range) {
+  if (range.getCellCount() > kMaxEntryCells) {
+    auto it = std::find(m_oversized.begin(), m_oversized.end(), id);
+    if (it != m_oversized.end()) {
+      *it = m_oversized.back();
+      m_oversized.pop_back();
+    }
+    return;
+  }
+  for (int y = range.minY; y <= range.maxY; ++y) {
+    for (int x = range.minX; x <= range.maxX; ++x) {
+      auto cell = m_cells.find(cellKey(x, y));
+      if (cell == m_cells.end()) {
+        continue;
+      }
+      auto& ids = cell->second;
+      auto it = std::find(ids.begin(), ids.end(), id);
+      if (it != ids.end()) {
+        *it = ids.back();
+        ids.pop_back();
+      }
+      if (ids.empty()) {
+        m_cells.erase(cell);
+      }
+    }
+  }
+}
@@ -0,0 +1,94 @@
+#include "StaticBatch.h"
+#include "Window.h"
+
+// Calcula el AABB de una lista de vértices.
+static sf::FloatRect computeBounds(const std::vector<sf::Vertex>& vertices) {
+    if (vertices.empty()) {
+        return sf::FloatRect();
+    }
+    sf::Vector2f min = vertices[0].position;
+    sf::Vector2f max = min;
+    for (const sf::Vertex& vertex : vertices) {
+        min.x = std::min(min.x, vertex.position.x);
+        min.y = std::min(min.y, vertex.position.y);
+        max.x = std::max(max.x, vertex.position.x);
+        max.y = std::max(max.y, vertex.position.y);
+    }
+    return sf::FloatRect(min, max - min);
+}
+
+/**
+ * @brief Hornea la geometría de los actores estáticos agrupada por textura.
+ * Los grupos quedan en el orden del primer actor que usa cada textura, así que el
+ * orden de dibujo entre lotes es estable y sigue el orden de envío de los actores.
+ * Si el controlador no soporta buffers de vértices, los vértices se conservan en
+ * memoria y se dibujan de todos modos en una llamada por textura.
+ */
+void StaticBatch::build(std::vector<EngineUtilities::TSharedPointer<Actor>>& actors) {
+    std::vector<std::pair<const sf::Texture*, std::vector<sf::Vertex>>> groups;
+    std::unordered_map<const sf::Texture*, size_t> groupIndex;
+
+    for (auto& actor : actors) {
+        if (actor.isNull() || !actor->isStatic()) {
+            continue;
+        }
+        auto shape = actor->getComponent<ShapeFactory>();
+        if (shape.isNull() || !shape->hasGeometry()) {
+            continue;
+        }
+        auto inserted = groupIndex.emplace(shape->getTexture(), groups.size());
+        if (inserted.second) {
+            groups.emplace_back(shape->getTexture(), std::vector<sf::Vertex>());
+        }
+        shape->appendVertices(groups[inserted.first->second].second);
+    }
+
+    const bool useBuffers = sf::VertexBuffer::isAvailable();
+    m_batches.clear();
+    m_batches.resize(groups.size());
+
+    size_t index = 0;
+    for (auto& group : groups) {
+        Batch& batch = m_batches[index++];
+        batch.texture = group.first;
+        batch.bounds = computeBounds(group.second);
+        if (useBuffers) {
+            if (!batch.buffer.create(group.second.size()) ||
+                !batch.buffer.update(group.second.data())) {
+                // Si falla la subida se conserva la copia en memoria.
+                batch.vertices = std::move(group.second);
+            }
+        }
+        else {
+            batch.vertices = std::move(group.second);
+        }
+    }
+
+    m_dirty = false;
+}
+
+// Dibuja cada grupo visible con su textura.
+void StaticBatch::render(Window& window) const {
+    const sf::FloatRect view = window.getViewBounds();
+    for (const Batch& batch : m_batches) {
+        if (!batch.bounds.intersects(view)) {
+            continue;
+        }
+        sf::RenderStates states;
+        states.texture = batch.texture;
+        if (batch.vertices.empty()) {
+            window.draw(batch.buffer, states);
+        }
+        else {
+            window.draw(batch.vertices.data(), batch.vertices.size(), sf::Triangles, states);
+        }
+    }
+}
+
+size_t StaticBatch::getVertexCount() const {
+    size_t count = 0;
+    for (const Batch& batch : m_batches) {
+        count += batch.vertices.empty() ? batch.buffer.getVertexCount() : batch.vertices.size();
+    }
+    return count;
+}
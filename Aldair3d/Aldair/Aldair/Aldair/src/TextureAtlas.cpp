@@ -0,0 +1,221 @@
+// stb_rect_pack se compila de forma estatica en esta unidad para no chocar con la
+// implementacion que ImGui ya incluye en imgui_draw.cpp.
+#define STBRP_STATIC
+#define STB_RECT_PACK_IMPLEMENTATION
+#include "imstb_rectpack.h"
+#undef STB_RECT_PACK_IMPLEMENTATION
+
+#include "TextureAtlas.h"
+#include "Services/NotificationSystem.h"
+
+TextureAtlas::TextureAtlas(unsigned int pageSize, unsigned int padding)
+  : m_pageSize(pageSize), m_padding(padding) {
+}
+
+/**
+ * @brief Inserta una imagen en la primera página con espacio disponible.
+ * Si ninguna página tiene espacio se crea una nueva. La imagen se sube directamente
+ * a la subregión de la textura de la página, sin volver a subir la página completa.
+ */
+bool TextureAtlas::insert(const std::string& name, const sf::Image& image) {
+  if (contains(name)) {
+    return true;
+  }
+
+  const sf::Vector2u size = image.getSize();
+  if (size.x == 0 || size.y == 0 ||
+      size.x + m_padding > m_pageSize || size.y + m_padding > m_pageSize) {
+    return false;
+  }
+
+  AtlasRegion region;
+  for (size_t i = 0; i < m_pages.size() && !region.isValid(); ++i) {
+    if (packInto(*m_pages[i], size.x, size.y, region.rect)) {
+      region.page = static_cast<int>(i);
+    }
+  }
+
+  if (!region.isValid()) {
+    Page& page = createPage();
+    if (!packInto(page, size.x, size.y, region.rect)) {
+      return false;
+    }
+    region.page = static_cast<int>(m_pages.size() - 1);
+  }
+
+  m_pages[region.page]->texture.update(image, region.rect.left, region.rect.top);
+  m_entries[name] = region;
+  return true;
+}
+
+// Elimina la entrada. El hueco queda ocupado hasta la siguiente desfragmentación.
+void TextureAtlas::remove(const std::string& name) {
+  m_entries.erase(name);
+}
+
+bool TextureAtlas::contains(const std::string& name) const {
+  return m_entries.find(name) != m_entries.end();
+}
+
+AtlasRegion TextureAtlas::getRegion(const std::string& name) const {
+  auto it = m_entries.find(name);
+  if (it != m_entries.end()) {
+    return it->second;
+  }
+  return AtlasRegion();
+}
+
+const sf::Texture* TextureAtlas::getPageTexture(int page) const {
+  if (page < 0 || page >= static_cast<int>(m_pages.size())) {
+    return nullptr;
+  }
+  return &m_pages[page]->texture;
+}
+
+/**
+ * @brief Reempaqueta todas las entradas vivas.
+ * Descarga las páginas actuales a memoria, empaqueta todas las entradas de una sola
+ * vez (ordenadas por altura, que es lo que mejor funciona con el skyline de stb) y
+ * copia los píxeles a las páginas nuevas. Las páginas y regiones nuevas se arman
+ * aparte y solo reemplazan a las actuales si todas las entradas cupieron.
+ */
+bool TextureAtlas::defragment() {
+  if (m_entries.empty()) {
+    m_pages.clear();
+    ++m_version;
+    return true;
+  }
+
+  // Copia de los píxeles actuales antes de reemplazar las páginas.
+  std::vector<sf::Image> oldPages;
+  oldPages.reserve(m_pages.size());
+  for (const auto& page : m_pages) {
+    oldPages.push_back(page->texture.copyToImage());
+  }
+
+  std::vector<std::pair<std::string, AtlasRegion>> entries(m_entries.begin(), m_entries.end());
+  std::sort(entries.begin(), entries.end(),
+    [](const auto& a, const auto& b) { return a.second.rect.height > b.second.rect.height; });
+
+  std::vector<stbrp_rect> pending(entries.size());
+  for (size_t i = 0; i < entries.size(); ++i) {
+    pending[i].id = static_cast<int>(i);
+    pending[i].w = entries[i].second.rect.width + m_padding;
+    pending[i].h = entries[i].second.rect.height + m_padding;
+    pending[i].was_packed = 0;
+  }
+
+  // Empaqueta todo lo posible en cada página nueva hasta colocar todas las entradas.
+  std::vector<std::unique_ptr<Page>> pages;
+  std::vector<sf::Image> pageImages;
+  std::unordered_map<std::string, AtlasRegion> regions;
+  regions.reserve(entries.size());
+  while (!pending.empty()) {
+    std::unique_ptr<Page> page = makePage(false);
+    const int pageIndex = static_cast<int>(pages.size());
+    stbrp_pack_rects(&page->context, pending.data(), static_cast<int>(pending.size()));
+
+    sf::Image pageImage;
+    pageImage.create(m_pageSize, m_pageSize, sf::Color::Transparent);
+
+    std::vector<stbrp_rect> remaining;
+    for (const stbrp_rect& packed : pending) {
+      if (!packed.was_packed) {
+        remaining.push_back(packed);
+        continue;
+      }
+      const AtlasRegion& oldRegion = entries[packed.id].second;
+      AtlasRegion newRegion;
+      newRegion.page = pageIndex;
+      newRegion.rect = sf::IntRect(packed.x, packed.y, oldRegion.rect.width, oldRegion.rect.height);
+
+      pageImage.copy(oldPages[oldRegion.page], packed.x, packed.y, oldRegion.rect);
+      page->packedArea += packed.w * packed.h;
+      regions[entries[packed.id].first] = newRegion;
+    }
+
+    // Sin progreso significa que una entrada no cabe ni en una página vacía. No se usa
+    // ERROR (termina el proceso): el atlas anterior sigue siendo válido.
+    if (remaining.size() == pending.size()) {
+      NotificationService::getInstance().addMessage(ConsolErrorType::ERROR,
+        "TextureAtlas::defragment: una entrada no cabe en una pagina vacia; se conserva el atlas anterior");
+      return false;
+    }
+
+    pages.push_back(std::move(page));
+    pageImages.push_back(std::move(pageImage));
+    pending.swap(remaining);
+  }
+
+  // Todas las entradas cupieron: se suben las páginas y se reemplaza el atlas.
+  for (size_t i = 0; i < pages.size(); ++i) {
+    pages[i]->texture.update(pageImages[i]);
+  }
+  m_pages.swap(pages);
+  m_entries.swap(regions);
+  ++m_version;
+  return true;
+}
+
+bool TextureAtlas::defragmentIfNeeded(float threshold) {
+  if (getFragmentation() > threshold) {
+    return defragment();
+  }
+  return false;
+}
+
+float TextureAtlas::getFragmentation() const {
+  unsigned int packedArea = 0;
+  for (const auto& page : m_pages) {
+    packedArea += page->packedArea;
+  }
+  if (packedArea == 0) {
+    return 0.0f;
+  }
+
+  // El área empaquetada incluye el padding, así que se compara contra el área viva con padding.
+  unsigned int liveArea = 0;
+  for (const auto& entry : m_entries) {
+    liveArea += (entry.second.rect.width + m_padding) * (entry.second.rect.height + m_padding);
+  }
+  return 1.0f - static_cast<float>(liveArea) / static_cast<float>(packedArea);
+}
+
+std::unique_ptr<TextureAtlas::Page> TextureAtlas::makePage(bool clear) {
+  auto page = std::make_unique<Page>();
+  if (!page->texture.create(m_pageSize, m_pageSize)) {
+    ERROR("TextureAtlas", "makePage", "CHECK PAGE TEXTURE CREATION");
+  }
+  else if (clear) {
+    const std::vector<sf::Uint8> transparent(static_cast<size_t>(m_pageSize) * m_pageSize * 4, 0);
+    page->texture.update(transparent.data());
+  }
+
+  // Un nodo por columna garantiza el mejor resultado de stb_rect_pack.
+  page->nodes.resize(m_pageSize);
+  stbrp_init_target(&page->context, m_pageSize, m_pageSize,
+                    page->nodes.data(), static_cast<int>(page->nodes.size()));
+  return page;
+}
+
+TextureAtlas::Page& TextureAtlas::createPage() {
+  m_pages.push_back(makePage(true));
+  return *m_pages.back();
+}
+
+bool TextureAtlas::packInto(Page& page, int width, int height, sf::IntRect& outRect) {
+  stbrp_rect rect;
+  rect.id = 0;
+  rect.w = width + m_padding;
+  rect.h = height + m_padding;
+  rect.was_packed = 0;
+
+  stbrp_pack_rects(&page.context, &rect, 1);
+  if (!rect.was_packed) {
+    return false;
+  }
+
+  page.packedArea += rect.w * rect.h;
+  outRect = sf::IntRect(rect.x, rect.y, width, height);
+  return true;
+}
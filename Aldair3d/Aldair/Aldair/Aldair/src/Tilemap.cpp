@@ -0,0 +1,290 @@
+#include "Tilemap.h"
+#include "Services/NotificationSystem.h"
+
+namespace {
+  // Color de depuración para dibujar el mapa cuando todavía no tiene tileset.
+  sf::Color
+  debugTileColor(uint16_t id) {
+    const uint32_t hash = static_cast<uint32_t>(id) * 2654435761u;
+    return sf::Color(96 + (hash >> 24) % 160, 96 + (hash >> 16) % 160, 96 + (hash >> 8) % 160);
+  }
+}
+
+Tilemap::Tilemap(unsigned int chunkSize)
+  : Component(ComponentType::TILEMAP), m_chunkSize(chunkSize > 0 ? chunkSize : 1) {
+}
+
+void Tilemap::create(unsigned int width, unsigned int height, float tileSize) {
+  m_width = width;
+  m_height = height;
+  m_tileSize = tileSize;
+  m_chunksX = (width + m_chunkSize - 1) / m_chunkSize;
+  m_chunksY = (height + m_chunkSize - 1) / m_chunkSize;
+
+  m_chunks.clear();
+  m_chunks.resize(static_cast<size_t>(m_chunksX) * m_chunksY);
+  for (Chunk& chunk : m_chunks) {
+    chunk.tiles.assign(static_cast<size_t>(m_chunkSize) * m_chunkSize, 0);
+  }
+  m_visibleChunks.clear();
+  m_changed = true;
+}
+
+/**
+ * @brief Lee la cabecera y los IDs de la capa.
+ * Los comentarios se descartan línea por línea y las comas se tratan como espacios,
+ * de modo que acepta tanto listas separadas por comas como matrices con espacios.
+ */
+bool Tilemap::loadFromFile(const std::string& fileName) {
+  std::ifstream file(fileName);
+  if (!file.is_open()) {
+    return false;
+  }
+
+  std::stringstream content;
+  std::string line;
+  while (std::getline(file, line)) {
+    if (!line.empty() && line[0] == '#') {
+      continue;
+    }
+    std::replace(line.begin(), line.end(), ',', ' ');
+    content << line << '\n';
+  }
+
+  unsigned int width = 0;
+  unsigned int height = 0;
+  float tileSize = 0.0f;
+  if (!(content >> width >> height >> tileSize) || width == 0 || height == 0 || tileSize <= 0.0f) {
+    NotificationService::getInstance().addMessage(ConsolErrorType::ERROR,
+      "Cabecera invalida en el mapa de tiles " + fileName);
+    return false;
+  }
+
+  create(width, height, tileSize);
+  for (unsigned int y = 0; y < height; ++y) {
+    for (unsigned int x = 0; x < width; ++x) {
+      unsigned int id = 0;
+      if (!(content >> id)) {
+        NotificationService::getInstance().addMessage(ConsolErrorType::ERROR,
+          "Faltan tiles en el mapa " + fileName);
+        return false;
+      }
+      setTile(x, y, static_cast<uint16_t>(id));
+    }
+  }
+  return true;
+}
+
+void Tilemap::setTileset(const sf::Texture* texture, const sf::IntRect& region, unsigned int tilePixels) {
+  m_atlas = nullptr;
+  m_tileset = texture;
+  m_tilesetRegion = region;
+  m_tilePixels = tilePixels > 0 ? tilePixels : 1;
+  markAllDirty();
+}
+
+bool Tilemap::setTileset(const TextureAtlas& atlas, const std::string& name, unsigned int tilePixels) {
+  AtlasRegion region = atlas.getRegion(name);
+  if (!region.isValid()) {
+    return false;
+  }
+  setTileset(atlas.getPageTexture(region.page), region.rect, tilePixels);
+  m_atlas = &atlas;
+  m_atlasKey = name;
+  m_atlasVersion = atlas.getVersion();
+  return true;
+}
+
+void Tilemap::refreshAtlasRegion() {
+  if (!m_atlas || m_atlas->getVersion() == m_atlasVersion) {
+    return;
+  }
+  if (!setTileset(*m_atlas, m_atlasKey, m_tilePixels)) {
+    // El tileset ya no está en el atlas: se dibujan los colores de depuración.
+    setTileset(nullptr, sf::IntRect(), m_tilePixels);
+  }
+}
+
+void Tilemap::setTile(unsigned int x, unsigned int y, uint16_t id) {
+  if (x >= m_width || y >= m_height) {
+    return;
+  }
+  Chunk& chunk = m_chunks[static_cast<size_t>(y / m_chunkSize) * m_chunksX + x / m_chunkSize];
+  uint16_t& tile = chunk.tiles[static_cast<size_t>(y % m_chunkSize) * m_chunkSize + x % m_chunkSize];
+  if (tile != id) {
+    tile = id;
+    chunk.dirty = true;
+    m_changed = true;
+  }
+}
+
+uint16_t Tilemap::getTile(unsigned int x, unsigned int y) const {
+  if (x >= m_width || y >= m_height) {
+    return 0;
+  }
+  const Chunk& chunk = m_chunks[static_cast<size_t>(y / m_chunkSize) * m_chunksX + x / m_chunkSize];
+  return chunk.tiles[static_cast<size_t>(y % m_chunkSize) * m_chunkSize + x % m_chunkSize];
+}
+
+void Tilemap::setPosition(const sf::Vector2f& position) {
+  if (m_position != position) {
+    m_position = position;
+    m_changed = true;
+  }
+}
+
+/**
+ * @brief Selecciona los chunks que intersectan la vista.
+ * El rango de chunks se calcula directamente de la vista, así que el costo depende
+ * de los chunks visibles y no del tamaño del mapa.
+ */
+void Tilemap::prepare(const sf::FloatRect& view) {
+  refreshAtlasRegion();
+  m_visibleChunks.clear();
+  m_rebuiltChunks = 0;
+  if (m_chunks.empty()) {
+    return;
+  }
+
+  const float chunkWorld = m_chunkSize * m_tileSize;
+  const float left = (view.left - m_position.x) / chunkWorld;
+  const float top = (view.top - m_position.y) / chunkWorld;
+  const float right = (view.left + view.width - m_position.x) / chunkWorld;
+  const float bottom = (view.top + view.height - m_position.y) / chunkWorld;
+  if (right < 0.0f || bottom < 0.0f || left >= m_chunksX || top >= m_chunksY) {
+    return;
+  }
+
+  const unsigned int beginX = static_cast<unsigned int>(std::max(0.0f, std::floor(left)));
+  const unsigned int beginY = static_cast<unsigned int>(std::max(0.0f, std::floor(top)));
+  const unsigned int endX = std::min(m_chunksX, static_cast<unsigned int>(std::floor(right)) + 1);
+  const unsigned int endY = std::min(m_chunksY, static_cast<unsigned int>(std::floor(bottom)) + 1);
+
+  for (unsigned int chunkY = beginY; chunkY < endY; ++chunkY) {
+    for (unsigned int chunkX = beginX; chunkX < endX; ++chunkX) {
+      const size_t index = static_cast<size_t>(chunkY) * m_chunksX + chunkX;
+      Chunk& chunk = m_chunks[index];
+      if (chunk.dirty) {
+        buildChunk(chunkX, chunkY, chunk);
+        ++m_rebuiltChunks;
+      }
+      if (chunk.vertexCount > 0) {
+        m_visibleChunks.push_back(index);
+      }
+    }
+  }
+}
+
+// Dibuja los chunks visibles, uno por llamada, con el tileset y la posición del mapa.
+void Tilemap::draw(Window& window) {
+  prepare(window.getViewBounds());
+
+  sf::RenderStates states;
+  states.texture = m_tileset;
+  states.transform.translate(m_position);
+  for (size_t index : m_visibleChunks) {
+    const Chunk& chunk = m_chunks[index];
+    if (chunk.vertices.empty()) {
+      window.draw(chunk.buffer, states);
+    }
+    else {
+      window.draw(chunk.vertices.data(), chunk.vertices.size(), sf::Triangles, states);
+    }
+  }
+}
+
+bool Tilemap::consumeChange() {
+  bool changed = m_changed;
+  m_changed = false;
+  return changed;
+}
+
+size_t Tilemap::getVisibleVertexCount() const {
+  size_t count = 0;
+  for (size_t index : m_visibleChunks) {
+    count += m_chunks[index].vertexCount;
+  }
+  return count;
+}
+
+/**
+ * @brief Genera dos triángulos por tile no vacío, en coordenadas locales del mapa.
+ * Si el controlador no soporta buffers de vértices, los vértices se conservan en
+ * memoria como en StaticBatch.
+ */
+void Tilemap::buildChunk(unsigned int chunkX, unsigned int chunkY, Chunk& chunk) {
+  m_scratch.clear();
+
+  const unsigned int columns = m_tileset ? std::max(1, m_tilesetRegion.width / static_cast<int>(m_tilePixels)) : 1;
+  const float tilePixels = static_cast<float>(m_tilePixels);
+
+  for (unsigned int localY = 0; localY < m_chunkSize; ++localY) {
+    const unsigned int y = chunkY * m_chunkSize + localY;
+    if (y >= m_height) {
+      break;
+    }
+    for (unsigned int localX = 0; localX < m_chunkSize; ++localX) {
+      const unsigned int x = chunkX * m_chunkSize + localX;
+      if (x >= m_width) {
+        break;
+      }
+      const uint16_t id = chunk.tiles[static_cast<size_t>(localY) * m_chunkSize + localX];
+      if (id == 0) {
+        continue;
+      }
+
+      const float left = x * m_tileSize;
+      const float top = y * m_tileSize;
+      const float right = left + m_tileSize;
+      const float bottom = top + m_tileSize;
+
+      sf::Color color = sf::Color::White;
+      float u0 = 0.0f, v0 = 0.0f, u1 = 0.0f, v1 = 0.0f;
+      if (m_tileset) {
+        const unsigned int cell = id - 1u;
+        u0 = m_tilesetRegion.left + (cell % columns) * tilePixels;
+        v0 = m_tilesetRegion.top + (cell / columns) * tilePixels;
+        u1 = u0 + tilePixels;
+        v1 = v0 + tilePixels;
+      }
+      else {
+        color = debugTileColor(id);
+      }
+
+      const sf::Vertex topLeft(sf::Vector2f(left, top), color, sf::Vector2f(u0, v0));
+      const sf::Vertex topRight(sf::Vector2f(right, top), color, sf::Vector2f(u1, v0));
+      const sf::Vertex bottomRight(sf::Vector2f(right, bottom), color, sf::Vector2f(u1, v1));
+      const sf::Vertex bottomLeft(sf::Vector2f(left, bottom), color, sf::Vector2f(u0, v1));
+      m_scratch.push_back(topLeft);
+      m_scratch.push_back(topRight);
+      m_scratch.push_back(bottomRight);
+      m_scratch.push_back(topLeft);
+      m_scratch.push_back(bottomRight);
+      m_scratch.push_back(bottomLeft);
+    }
+  }
+
+  chunk.vertexCount = m_scratch.size();
+  chunk.vertices.clear();
+  chunk.dirty = false;
+  if (m_scratch.empty()) {
+    return;
+  }
+
+  if (sf::VertexBuffer::isAvailable()) {
+    if (chunk.buffer.getVertexCount() == m_scratch.size() || chunk.buffer.create(m_scratch.size())) {
+      if (chunk.buffer.update(m_scratch.data())) {
+        return;
+      }
+    }
+  }
+  // Sin buffers de vértices (o si falla la subida) se conserva la copia en memoria.
+  chunk.vertices = m_scratch;
+}
+
+void Tilemap::markAllDirty() {
+  for (Chunk& chunk : m_chunks) {
+    chunk.dirty = true;
+  }
+  m_changed = true;
+}
@@ -1,4 +1,5 @@
 ﻿#include "Window.h"
+#include "FrameCapture.h"
 
 /**
  * Constructor de la clase Window.
@@ -21,10 +22,8 @@ Window::Window(int width, int height, const std::string& title) {
     // Inicializar ImGui con SFML.
     ImGui::SFML::Init(*m_window);
 
-    // Crear RenderTexture con las mismas dimensiones que la ventana.
-    if (!m_renderTexture.create(width, height)) {
-        ERROR("Window", "RenderTexture", "CHECK CREATION");
-    }
+    // Obtener una RenderTexture con las mismas dimensiones que la ventana.
+    resizeScene(width, height);
 }
 
 /**
@@ -55,20 +54,35 @@ void Window::handleEvents() {
             m_view.setSize(static_cast<float>(width), static_cast<float>(height));
             m_window->setView(m_view);
 
-            // Actualizar RenderTexture si la ventana cambia de tamaño.
-            if (!m_renderTexture.create(width, height)) {
-                ERROR("Window", "RenderTexture", "CHECK RESIZE CREATION");
-            }
+            // Arrastrar el borde emite muchos eventos seguidos: la RenderTexture solo se
+            // ajusta en update() cuando el tamaño deja de cambiar.
+            m_pendingSize = sf::Vector2u(width, height);
+            m_resizePending = true;
+            m_resizeClock.restart();
             break;
         }
+        case sf::Event::KeyPressed:
+            // F1 alterna entre el editor y el modo juego.
+            if (event.key.code == sf::Keyboard::F1) {
+                setGameMode(!m_gameMode);
+            }
+            // F2 inicia o detiene la grabación de frames.
+            else if (event.key.code == sf::Keyboard::F2) {
+                m_captureToggle = true;
+            }
+            break;
+        default:
+            break;
         }
     }
 }
 
 /**
- * Limpia el contenido de la ventana y el RenderTexture.
+ * Limpia el contenido de la ventana y, si se pide, el RenderTexture.
+ *
+ * @param clearScene `false` para reutilizar la escena ya dibujada en el RenderTexture.
  */
-void Window::clear() {
+void Window::clear(bool clearScene) {
     if (m_window) {
         m_window->clear();
     }
@@ -76,8 +90,9 @@ void Window::clear() {
         ERROR("Window", "clear", "CHECK FOR WINDOW POINTER DATA");
     }
 
-    if (m_renderTexture.getSize().x > 0 && m_renderTexture.getSize().y > 0) {
-        m_renderTexture.clear();
+    if (clearScene && m_renderTexture &&
+        m_renderTexture->getSize().x > 0 && m_renderTexture->getSize().y > 0) {
+        m_renderTexture->clear();
     }
 }
 
@@ -103,16 +118,154 @@ bool Window::isOpen() const {
 }
 
 /**
- * Dibuja un objeto en la RenderTexture.
+ * Dibuja un objeto en el destino activo (RenderTexture o ventana en modo juego).
  *
  * @param drawable Referencia al objeto SFML a dibujar.
  */
 void Window::draw(const sf::Drawable& drawable) {
-    if (m_renderTexture.getSize().x > 0 && m_renderTexture.getSize().y > 0) {
-        m_renderTexture.draw(drawable);
+    if (sf::RenderTarget* target = getRenderTarget()) {
+        target->draw(drawable);
+    }
+}
+
+/**
+ * Dibuja un objeto en el destino activo usando estados de render.
+ *
+ * @param drawable Referencia al objeto SFML a dibujar.
+ * @param states Estados de render (textura, transformación, mezcla).
+ */
+void Window::draw(const sf::Drawable& drawable, const sf::RenderStates& states) {
+    if (sf::RenderTarget* target = getRenderTarget()) {
+        target->draw(drawable, states);
     }
 }
 
+/**
+ * Dibuja una lista de vértices en el destino activo.
+ *
+ * @param vertices Puntero al primer vértice.
+ * @param vertexCount Número de vértices.
+ * @param type Tipo de primitiva.
+ * @param states Estados de render.
+ */
+void Window::draw(const sf::Vertex* vertices, size_t vertexCount,
+                  sf::PrimitiveType type, const sf::RenderStates& states) {
+    sf::RenderTarget* target = getRenderTarget();
+    if (target && vertexCount > 0) {
+        target->draw(vertices, vertexCount, type, states);
+    }
+}
+
+/**
+ * Obtiene el destino donde se dibuja la escena.
+ *
+ * @return La ventana en modo juego a resolución completa, la RenderTexture en otro caso o nullptr.
+ */
+sf::RenderTarget* Window::getRenderTarget() {
+    if (!usesSceneTarget()) {
+        return m_window;
+    }
+    if (m_renderTexture && m_renderTexture->getSize().x > 0 && m_renderTexture->getSize().y > 0) {
+        return m_renderTexture;
+    }
+    return nullptr;
+}
+
+/**
+ * Consume el aviso de pérdida del contenido de la RenderTexture.
+ *
+ * @return `true` si la escena debe redibujarse por completo.
+ */
+bool Window::consumeSceneInvalidation() {
+    bool invalidated = m_sceneInvalidated;
+    m_sceneInvalidated = false;
+    return invalidated;
+}
+
+/**
+ * Alterna entre el modo editor y el modo juego.
+ * Al entrar en modo juego se libera la RenderTexture (framebuffer y textura) salvo que
+ * la resolución dinámica la necesite; al volver al editor se obtiene de nuevo.
+ *
+ * @param gameMode `true` para dibujar directo a la ventana.
+ */
+void Window::setGameMode(bool gameMode) {
+    if (m_gameMode == gameMode || !m_window) {
+        return;
+    }
+    m_gameMode = gameMode;
+    rebuildSceneTarget();
+}
+
+/**
+ * Cambia la escala de resolución de la escena.
+ *
+ * @param scale Fracción (0-1] del tamaño de la ventana con la que se dibuja la escena.
+ */
+void Window::setResolutionScale(float scale) {
+    scale = std::max(0.1f, std::min(scale, 1.0f));
+    if (scale == m_resolutionScale) {
+        return;
+    }
+    m_resolutionScale = scale;
+    rebuildSceneTarget();
+}
+
+/**
+ * Ajusta la escena a un nuevo tamaño lógico (el de la ventana).
+ *
+ * @param width Ancho de la escena en píxeles.
+ * @param height Alto de la escena en píxeles.
+ */
+void Window::resizeScene(unsigned int width, unsigned int height) {
+    m_resizePending = false;
+    if (width == 0 || height == 0) {
+        return;
+    }
+    m_sceneLogicalSize = sf::Vector2u(width, height);
+    rebuildSceneTarget();
+}
+
+/**
+ * Obtiene de la reserva el destino de la escena para el modo, tamaño y escala actuales.
+ * La vista siempre cubre el tamaño lógico, así que el mundo visible no cambia con la
+ * escala; solo el viewport (el subrectángulo de píxeles) se reduce.
+ */
+void Window::rebuildSceneTarget() {
+    m_sceneInvalidated = true;
+
+    // Liberar primero permite que la reserva devuelva el mismo destino si aún sirve.
+    m_targetPool.release(m_renderTexture);
+    m_renderTexture = nullptr;
+
+    if (!usesSceneTarget() || m_sceneLogicalSize.x == 0 || m_sceneLogicalSize.y == 0) {
+        m_targetPool.trim();
+        return;
+    }
+
+    const unsigned int width = std::max(1u, static_cast<unsigned int>(
+        std::lround(m_sceneLogicalSize.x * m_resolutionScale)));
+    const unsigned int height = std::max(1u, static_cast<unsigned int>(
+        std::lround(m_sceneLogicalSize.y * m_resolutionScale)));
+
+    m_renderTexture = m_targetPool.acquire(width, height);
+    m_sceneSize = sf::Vector2u(width, height);
+    if (!m_renderTexture) {
+        ERROR("Window", "rebuildSceneTarget", "CHECK RENDERTEXTURE CREATION");
+        return;
+    }
+    // Filtrado bilineal al escalar la escena de vuelta al tamaño lógico.
+    m_renderTexture->setSmooth(m_resolutionScale < 1.0f);
+
+    const sf::Vector2u targetSize = m_renderTexture->getSize();
+    sf::View view(sf::FloatRect(0.0f, 0.0f, static_cast<float>(m_sceneLogicalSize.x),
+                                static_cast<float>(m_sceneLogicalSize.y)));
+    view.setViewport(sf::FloatRect(0.0f, 0.0f,
+                                   static_cast<float>(width) / targetSize.x,
+                                   static_cast<float>(height) / targetSize.y));
+    m_renderTexture->setView(view);
+}
+
 /**
  * Obtiene el puntero a la ventana SFML.
  *
@@ -124,29 +277,109 @@ sf::RenderWindow* Window::getWindow() {
 
 /**
  * Finaliza el renderizado en la RenderTexture.
+ * En modo juego con resolución reducida, además escala la escena a toda la ventana.
  */
 void Window::renderToTexture() {
-    m_renderTexture.display();
+    if (!m_renderTexture) {
+        return;
+    }
+    m_renderTexture->display();
+
+    if (m_gameMode && m_window) {
+        sf::Sprite scene(m_renderTexture->getTexture(),
+                         sf::IntRect(0, 0, m_sceneSize.x, m_sceneSize.y));
+        scene.setScale(static_cast<float>(m_sceneLogicalSize.x) / m_sceneSize.x,
+                       static_cast<float>(m_sceneLogicalSize.y) / m_sceneSize.y);
+
+        const sf::View previous = m_window->getView();
+        m_window->setView(sf::View(sf::FloatRect(0.0f, 0.0f,
+                                                 static_cast<float>(m_window->getSize().x),
+                                                 static_cast<float>(m_window->getSize().y))));
+        m_window->draw(scene, sf::BlendNone);
+        m_window->setView(previous);
+    }
 }
 
 /**
  * Muestra la RenderTexture en una ventana de ImGui.
  */
 void Window::showInImGui() {
-    const sf::Texture& texture = m_renderTexture.getTexture();
-    ImVec2 size(texture.getSize().x, texture.getSize().y);
+    if (m_gameMode || !m_renderTexture) {
+        return;
+    }
+
+    // La escena se muestra al tamaño lógico aunque se haya dibujado a menor resolución.
+    const sf::Texture& texture = m_renderTexture->getTexture();
+    ImVec2 size(m_sceneLogicalSize.x, m_sceneLogicalSize.y);
+
+    // La escena ocupa la esquina superior izquierda de la textura; en OpenGL la textura
+    // está invertida, así que esa esquina empieza en v = 1.
+    ImVec2 uvMax(static_cast<float>(m_sceneSize.x) / texture.getSize().x,
+                 1.0f - static_cast<float>(m_sceneSize.y) / texture.getSize().y);
 
     // Ventana de ImGui con título dinámico.
     ImGui::Begin("Renderizado Principal", nullptr, ImGuiWindowFlags_AlwaysAutoResize);
-    ImGui::Text("Resolución: %dx%d", texture.getSize().x, texture.getSize().y);
-    ImGui::Image(reinterpret_cast<void*>(static_cast<intptr_t>(texture.getNativeHandle())), size, ImVec2(0, 1), ImVec2(1, 0));
+    ImGui::Text("Resolución: %ux%u (escala %.2f, destino %ux%u)", m_sceneSize.x, m_sceneSize.y,
+                m_resolutionScale, texture.getSize().x, texture.getSize().y);
+    ImGui::Text("Destinos en reserva: %zu (creados: %zu)", m_targetPool.getTargetCount(),
+                m_targetPool.getAllocationCount());
+    ImGui::Image(reinterpret_cast<void*>(static_cast<intptr_t>(texture.getNativeHandle())), size, ImVec2(0, 1), uvMax);
     ImGui::End();
 }
 
+/**
+ * Calcula el rectángulo visible de la escena.
+ * La transformación inversa de la vista lleva el cuadro de recorte [-1, 1] a
+ * coordenadas de mundo; si la vista está rotada se obtiene su AABB.
+ *
+ * @return Rectángulo visible en coordenadas de mundo.
+ */
+sf::FloatRect Window::getViewBounds() const {
+    const sf::RenderTarget* target = usesSceneTarget() ? static_cast<const sf::RenderTarget*>(m_renderTexture)
+                                                       : m_window;
+    if (!target) {
+        return sf::FloatRect();
+    }
+    return target->getView().getInverseTransform().transformRect(
+        sf::FloatRect(-1.0f, -1.0f, 2.0f, 2.0f));
+}
+
+void Window::capture(FrameCapture& capture) {
+    if (usesSceneTarget() && m_renderTexture) {
+        capture.captureTexture(m_renderTexture->getTexture(),
+                               sf::IntRect(0, 0, m_sceneSize.x, m_sceneSize.y));
+    }
+    else if (m_window) {
+        capture.captureWindow(*m_window);
+    }
+}
+
+bool Window::consumeCaptureToggle() {
+    bool toggle = m_captureToggle;
+    m_captureToggle = false;
+    return toggle;
+}
+
+float Window::getPixelsPerUnit() const {
+    const sf::RenderTarget* target = usesSceneTarget() ? static_cast<const sf::RenderTarget*>(m_renderTexture)
+                                                       : m_window;
+    if (!target || target->getView().getSize().x <= 0.0f) {
+        return 1.0f;
+    }
+    const float pixels = usesSceneTarget() ? static_cast<float>(m_sceneSize.x)
+                                           : static_cast<float>(m_window->getSize().x);
+    return pixels / target->getView().getSize().x;
+}
+
 /**
  * Actualiza ImGui con el deltaTime.
  */
 void Window::update() {
+    // Reasignar la RenderTexture solo cuando el tamaño lleva un rato sin cambiar.
+    if (m_resizePending && m_resizeClock.getElapsedTime().asSeconds() >= kResizeDebounceSeconds) {
+        resizeScene(m_pendingSize.x, m_pendingSize.y);
+    }
+
     deltaTime = clock.restart();
     ImGui::SFML::Update(*m_window, deltaTime);
 }
@@ -162,6 +395,9 @@ void Window::render() {
  * Libera los recursos asociados a la ventana.
  */
 void Window::destroy() {
+    m_targetPool.release(m_renderTexture);
+    m_targetPool.trim();
+    m_renderTexture = nullptr;
     ImGui::SFML::Shutdown();
     SAFE_PTR_RELEASE(m_window);
 }